@@ -0,0 +1,160 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Measures PDX serialize plus deserialize round trips per second as the
+ * number of threads grows, which is bounded by the PdxTypeRegistry lookups
+ * every round trip makes.
+ *
+ * Usage: apache-geode_benchmarks [max threads, default 32] [seconds per run,
+ * default 3]
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxReader.hpp>
+#include <geode/PdxSerializable.hpp>
+#include <geode/PdxWriter.hpp>
+#include <geode/TypeRegistry.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxReader;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxWriter;
+using apache::geode::client::PdxWriterWithTypeCollector;
+
+class Order : public PdxSerializable {
+ public:
+  Order() = default;
+
+  Order(int32_t id, std::string symbol, double price, bool open)
+      : m_id(id), m_symbol(std::move(symbol)), m_price(price), m_open(open) {}
+
+  void toData(PdxWriter& writer) const override {
+    writer.writeInt("id", m_id);
+    writer.writeString("symbol", m_symbol);
+    writer.writeDouble("price", m_price);
+    writer.writeBoolean("open", m_open);
+  }
+
+  void fromData(PdxReader& reader) override {
+    m_id = reader.readInt("id");
+    m_symbol = reader.readString("symbol");
+    m_price = reader.readDouble("price");
+    m_open = reader.readBoolean("open");
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "Order";
+    return className;
+  }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<Order>();
+  }
+
+ private:
+  int32_t m_id = 0;
+  std::string m_symbol;
+  double m_price = 0;
+  bool m_open = false;
+};
+
+// Registers the type of Order as a server would assign it, so that the
+// benchmark runs without a cluster.
+void registerOrderType(Cache& cache, const Order& order) {
+  const int32_t typeId = 1;
+  auto registry = CacheRegionHelper::getCacheImpl(&cache)->getPdxTypeRegistry();
+  auto output = cache.createDataOutput();
+  PdxWriterWithTypeCollector writer(output, order.getClassName(), registry);
+  order.toData(writer);
+  auto type = writer.getPdxLocalType();
+  type->InitializeType();
+  type->setTypeId(typeId);
+  registry->addLocalPdxType(order.getClassName(), type);
+  registry->addPdxType(typeId, type);
+}
+
+double measure(Cache& cache, const std::shared_ptr<Order>& order,
+               int threadCount, std::chrono::seconds duration) {
+  std::atomic<bool> stop(false);
+  std::atomic<int64_t> roundTrips(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; t++) {
+    threads.emplace_back([&]() {
+      int64_t count = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        auto output = cache.createDataOutput();
+        output.writeObject(order);
+        auto input =
+            cache.createDataInput(output.getBuffer(), output.getBufferLength());
+        input.readObject();
+        count++;
+      }
+      roundTrips += count;
+    });
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(duration);
+  stop = true;
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return static_cast<double>(roundTrips.load()) / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  auto maxThreads = argc > 1 ? std::atoi(argv[1]) : 32;
+  std::chrono::seconds duration(argc > 2 ? std::atoi(argv[2]) : 3);
+
+  auto cache = CacheFactory().set("log-level", "none").create();
+  cache.getTypeRegistry().registerPdxType(Order::createDeserializable);
+  auto order = std::make_shared<Order>(7, "GEODE", 12.5, true);
+  registerOrderType(cache, *order);
+
+  std::printf("%8s %16s %16s\n", "threads", "round trips/s", "per thread/s");
+  for (int threads = 1; threads <= maxThreads; threads *= 2) {
+    auto rate = measure(cache, order, threads, duration);
+    std::printf("%8d %16.0f %16.0f\n", threads, rate, rate / threads);
+  }
+
+  cache.close();
+  return 0;
+}
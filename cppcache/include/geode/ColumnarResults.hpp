@@ -0,0 +1,149 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COLUMNARRESULTS_H_
+#define GEODE_COLUMNARRESULTS_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The storage used for a column of ColumnarResults.
+ */
+enum class ColumnType {
+  /** integral values (byte, short, int and long) widened to int64_t */
+  INT64,
+  /** floating point values (float and double) widened to double */
+  DOUBLE,
+  /** string values */
+  STRING,
+  /** any other values, or columns whose values have mixed types */
+  OBJECT
+};
+
+/**
+ * @class ColumnarResults ColumnarResults.hpp
+ *
+ * ColumnarResults are obtained by executing a Query with
+ * Query::executeColumnar. Instead of one Struct per row, the values of each
+ * field are decoded straight from the server response into a contiguous
+ * column, so that primitive and string values do not need a Cacheable
+ * allocation per value.
+ *
+ * A column holding only integral values is an INT64 column, one holding only
+ * floating point values is a DOUBLE column and one holding only strings is a
+ * STRING column. Any other column, or a column with values of mixed types, is
+ * an OBJECT column of the deserialized values. Null values are reported by
+ * isNull and are stored as the default value of the column type.
+ *
+ * The results of a query not returning structs have a single column with an
+ * empty field name.
+ */
+class APACHE_GEODE_EXPORT ColumnarResults {
+ public:
+  virtual ~ColumnarResults() noexcept = default;
+
+  /**
+   * Get the number of rows in the results.
+   */
+  virtual size_t size() const = 0;
+
+  /**
+   * Get the number of columns in the results.
+   */
+  virtual size_t getColumnCount() const = 0;
+
+  /**
+   * Get the field names of the columns.
+   */
+  virtual const std::vector<std::string>& getFieldNames() const = 0;
+
+  /**
+   * Get the index of the column of the specified field name.
+   *
+   * @throws std::invalid_argument if the field name is not found.
+   */
+  virtual size_t getFieldIndex(const std::string& fieldName) const = 0;
+
+  /**
+   * Get the storage type of the specified column.
+   *
+   * @throws std::out_of_range if the column is not found.
+   */
+  virtual ColumnType getColumnType(size_t column) const = 0;
+
+  /**
+   * Check whether the value of the specified row and column is null.
+   *
+   * @throws std::out_of_range if the row or column is not found.
+   */
+  virtual bool isNull(size_t row, size_t column) const = 0;
+
+  /**
+   * Get the values of an INT64 column.
+   *
+   * @throws std::out_of_range if the column is not found.
+   * @throws IllegalStateException if the column is not an INT64 column.
+   */
+  virtual const std::vector<int64_t>& getInt64Column(size_t column) const = 0;
+
+  /**
+   * Get the values of a DOUBLE column.
+   *
+   * @throws std::out_of_range if the column is not found.
+   * @throws IllegalStateException if the column is not a DOUBLE column.
+   */
+  virtual const std::vector<double>& getDoubleColumn(size_t column) const = 0;
+
+  /**
+   * Get the values of a STRING column.
+   *
+   * @throws std::out_of_range if the column is not found.
+   * @throws IllegalStateException if the column is not a STRING column.
+   */
+  virtual const std::vector<std::string>& getStringColumn(
+      size_t column) const = 0;
+
+  /**
+   * Get the values of an OBJECT column.
+   *
+   * @throws std::out_of_range if the column is not found.
+   * @throws IllegalStateException if the column is not an OBJECT column.
+   */
+  virtual const std::vector<std::shared_ptr<Serializable>>& getObjectColumn(
+      size_t column) const = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COLUMNARRESULTS_H_
@@ -25,7 +25,9 @@
 #include <string>
 
 #include "CacheableBuiltins.hpp"
+#include "PartialExecutionResult.hpp"
 #include "ResultCollector.hpp"
+#include "StreamingResultCollector.hpp"
 #include "internal/geode_globals.hpp"
 
 /**
@@ -116,6 +118,51 @@ class APACHE_GEODE_EXPORT Execution {
       const std::shared_ptr<ResultCollector>& rs, const std::string& func,
       std::chrono::milliseconds timeout);
 
+  /**
+   * Executes the function using its name, waiting for the servers only until
+   * the timeout has expired. The results of the servers that completed the
+   * function in time are added to the collector, while the servers that had
+   * not answered and those the function failed on are reported in the
+   * returned result instead of failing the whole execution. Failed servers
+   * are not retried. Each server is sent the time left until the deadline as
+   * its timeout, and requests still queued at the deadline are not sent.
+   * <p>
+   * This applies to FunctionService::onServers and to
+   * FunctionService::onRegion of a pool with single hop enabled once the
+   * bucket locations of the region are known; otherwise the function is
+   * executed as by execute(const std::string&, std::chrono::milliseconds)
+   * with the timeout.
+   * <p>
+   * @param func the name of the function to be executed
+   * @param timeout the time to wait for the servers to complete the
+   * function.
+   * @throws UnsupportedOperationException if called within a transaction
+   * @throws Exception if the function can not be sent to the servers
+   * @return the collector with the results of the servers that answered in
+   * time and the servers that did not
+   */
+  PartialExecutionResult executeWithDeadline(const std::string& func,
+                                             std::chrono::milliseconds timeout);
+
+  /**
+   * Executes the function using its name in the background, returning a
+   * collector from which the results can be consumed as they are received.
+   * Any collector specified by {@link #withCollector(ResultCollector)} is
+   * ignored.
+   * <p>
+   * @param func the name of the function to be executed
+   * @param capacity the maximum number of results buffered ahead of the
+   * consumer before reading from the server is suspended.
+   * @param timeout value to wait for the operation to finish before timing out.
+   * @throws IllegalArgumentException if capacity is zero
+   * @return the collector streaming the results of the execution; errors of
+   * the execution are thrown by StreamingResultCollector::hasNext
+   */
+  std::shared_ptr<StreamingResultCollector> executeStreaming(
+      const std::string& func,
+      size_t capacity = DEFAULT_STREAMING_RESULT_CAPACITY,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
  private:
   std::unique_ptr<ExecutionImpl> impl_;
 
@@ -0,0 +1,87 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PARTIALEXECUTIONRESULT_H_
+#define GEODE_PARTIALEXECUTIONRESULT_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ResultCollector.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class PartialExecutionResult PartialExecutionResult.hpp
+ *
+ * The outcome of Execution::executeWithDeadline. The collector holds the
+ * results of the servers that completed the function before the deadline;
+ * the servers that had not answered by then and the servers the function
+ * failed on are reported separately, and none of their results are added to
+ * the collector.
+ */
+class APACHE_GEODE_EXPORT PartialExecutionResult {
+ public:
+  PartialExecutionResult(std::shared_ptr<ResultCollector> collector,
+                         std::vector<std::string> timedOutServers,
+                         std::map<std::string, std::string> failedServers);
+
+  /**
+   * The collector with the results of the servers that answered in time,
+   * either a default result collector or the one specified by
+   * Execution::withCollector.
+   */
+  const std::shared_ptr<ResultCollector>& getCollector() const;
+
+  /**
+   * The endpoints of the servers that had not answered by the deadline.
+   */
+  const std::vector<std::string>& getTimedOutServers() const;
+
+  /**
+   * The endpoints of the servers the function failed on, mapped to the error
+   * of each.
+   */
+  const std::map<std::string, std::string>& getFailedServers() const;
+
+  /**
+   * Whether every server answered in time and without error.
+   */
+  bool isComplete() const;
+
+ private:
+  std::shared_ptr<ResultCollector> m_collector;
+  std::vector<std::string> m_timedOutServers;
+  std::map<std::string, std::string> m_failedServers;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PARTIALEXECUTIONRESULT_H_
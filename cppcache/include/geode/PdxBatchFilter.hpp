@@ -0,0 +1,157 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXBATCHFILTER_H_
+#define GEODE_PDXBATCHFILTER_H_
+
+#include <memory>
+#include <vector>
+
+#include "PdxFieldHandle.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class PdxInstance;
+class SerializedResult;
+
+/**
+ * Selects the PDX values of a batch that satisfy comparisons of numeric
+ * fields with constants, for example all trades with a quantity above 100
+ * and a price between 10 and 20. The conditions are combined with and.
+ *
+ * The values are evaluated in their serialized form. A condition is applied
+ * to the whole batch at a time: the field is read from the stream of each
+ * value still selected into a column, which is then compared with the
+ * constant in a single tight loop. The fields are located through the
+ * offsets captured in their handles, so no PdxInstance is deserialized,
+ * built or looked up per value.
+ *
+ * <pre>
+ * auto quantity = instances[0]->getFieldHandle("quantity");
+ * auto price = instances[0]->getFieldHandle("price");
+ * PdxBatchFilter filter;
+ * filter.where(quantity, PdxBatchFilter::Comparison::GREATER, 100)
+ *     .between(price, 10.0, 20.0);
+ * for (auto index : filter.select(instances)) {
+ *   ...
+ * }
+ * </pre>
+ *
+ * All the handles of a filter have to be resolved against the same PDX
+ * type. A filter is immutable once its conditions are added, and can be
+ * used by several threads at once.
+ */
+class APACHE_GEODE_EXPORT PdxBatchFilter {
+ public:
+  enum class Comparison {
+    EQUAL,
+    NOT_EQUAL,
+    LESS,
+    LESS_EQUAL,
+    GREATER,
+    GREATER_EQUAL
+  };
+
+  PdxBatchFilter() = default;
+
+  /**
+   * Adds the condition that the field compares to value, for fields of type
+   * boolean, byte, short, int, long and char.
+   * @throws IllegalStateException if the field is of another type or was
+   * resolved against another PDX type than the other conditions.
+   */
+  PdxBatchFilter& where(const PdxFieldHandle& field, Comparison comparison,
+                        int64_t value);
+
+  PdxBatchFilter& where(const PdxFieldHandle& field, Comparison comparison,
+                        int32_t value) {
+    return where(field, comparison, static_cast<int64_t>(value));
+  }
+
+  /**
+   * Adds the condition that the field compares to value, for fields of type
+   * float and double.
+   * @throws IllegalStateException if the field is of another type or was
+   * resolved against another PDX type than the other conditions.
+   */
+  PdxBatchFilter& where(const PdxFieldHandle& field, Comparison comparison,
+                        double value);
+
+  /** Adds the condition lower <= field <= upper. */
+  PdxBatchFilter& between(const PdxFieldHandle& field, int64_t lower,
+                          int64_t upper) {
+    return where(field, Comparison::GREATER_EQUAL, lower)
+        .where(field, Comparison::LESS_EQUAL, upper);
+  }
+
+  PdxBatchFilter& between(const PdxFieldHandle& field, int32_t lower,
+                          int32_t upper) {
+    return between(field, static_cast<int64_t>(lower),
+                   static_cast<int64_t>(upper));
+  }
+
+  PdxBatchFilter& between(const PdxFieldHandle& field, double lower,
+                          double upper) {
+    return where(field, Comparison::GREATER_EQUAL, lower)
+        .where(field, Comparison::LESS_EQUAL, upper);
+  }
+
+  /**
+   * @return the indexes of the instances that satisfy all conditions, in
+   * ascending order. Instances that aren't serialized or are of another PDX
+   * type are evaluated through their field accessors instead.
+   */
+  std::vector<size_t> select(
+      const std::vector<std::shared_ptr<PdxInstance>>& instances) const;
+
+  /**
+   * @return the indexes of the serialized PDX values that satisfy all
+   * conditions, in ascending order.
+   * @throws IllegalStateException if a value isn't a PDX value of the PDX
+   * type of the conditions.
+   */
+  std::vector<size_t> select(
+      const std::vector<std::shared_ptr<SerializedResult>>& values) const;
+
+ private:
+  struct Condition {
+    PdxFieldHandle field;
+    Comparison comparison;
+    int64_t integer;
+    double floating;
+  };
+
+  struct Row;
+
+  void addCondition(const PdxFieldHandle& field, Comparison comparison,
+                    int64_t integer, double floating);
+
+  std::vector<size_t> select(const std::vector<Row>& rows) const;
+
+  std::vector<Condition> m_conditions;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXBATCHFILTER_H_
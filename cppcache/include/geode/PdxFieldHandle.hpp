@@ -0,0 +1,87 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXFIELDHANDLE_H_
+#define GEODE_PDXFIELDHANDLE_H_
+
+#include <string>
+#include <utility>
+
+#include "PdxFieldTypes.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class PdxInstanceImpl;
+
+/**
+ * A resolved reference to a field of a PDX type, obtained once through
+ * {@link PdxInstance#getFieldHandle} and then passed to the typed field
+ * accessors of any PdxInstance of the same type. Reading through a handle
+ * skips the field name lookup, so it is the preferred way to read the same
+ * few fields from many instances.
+ *
+ * A handle stays usable with instances of a different PDX type, for example a
+ * newer version of the same class, but those reads fall back to resolving the
+ * field by name.
+ */
+class APACHE_GEODE_EXPORT PdxFieldHandle {
+ public:
+  PdxFieldHandle() = default;
+
+  /** @return the name of the field this handle refers to. */
+  const std::string& getFieldName() const { return m_fieldName; }
+
+  /** @return the type of the field this handle refers to. */
+  PdxFieldTypes getFieldType() const { return m_fieldType; }
+
+  /** @return the id of the PDX type the handle was resolved against. */
+  int32_t getPdxTypeId() const { return m_pdxTypeId; }
+
+ private:
+  PdxFieldHandle(std::string fieldName, int32_t pdxTypeId,
+                 PdxFieldTypes fieldType, bool isVariableLength,
+                 int32_t varLenOffsetIndex, int32_t relativeOffset,
+                 int32_t numberOfVarLenFields)
+      : m_fieldName(std::move(fieldName)),
+        m_pdxTypeId(pdxTypeId),
+        m_fieldType(fieldType),
+        m_isVariableLength(isVariableLength),
+        m_varLenOffsetIndex(varLenOffsetIndex),
+        m_relativeOffset(relativeOffset),
+        m_numberOfVarLenFields(numberOfVarLenFields) {}
+
+  std::string m_fieldName;
+  int32_t m_pdxTypeId = 0;
+  PdxFieldTypes m_fieldType = PdxFieldTypes::UNKNOWN;
+  bool m_isVariableLength = false;
+  int32_t m_varLenOffsetIndex = -1;
+  int32_t m_relativeOffset = 0;
+  int32_t m_numberOfVarLenFields = 0;
+
+  friend class PdxInstanceImpl;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXFIELDHANDLE_H_
@@ -0,0 +1,147 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXFIELDVIEW_H_
+#define GEODE_PDXFIELDVIEW_H_
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class PdxInstanceImpl;
+
+/**
+ * A string field of a PdxInstance read in place: the characters are those of
+ * the serialized stream, as UTF-8, without being copied. Strings whose
+ * serialized encoding differs from UTF-8 are decoded into the view instead.
+ * A null string reads as an empty one.
+ *
+ * A view shares the serialized stream it was read from, so it stays valid,
+ * with the value the field had when it was read, after the PdxInstance is
+ * modified or destroyed.
+ */
+class PdxStringView {
+ public:
+  PdxStringView() = default;
+
+  /** @return the characters of the string, not null terminated. */
+  const char* data() const { return m_decoded ? m_value.data() : m_data; }
+
+  /** @return the number of bytes in the string. */
+  size_t size() const { return m_decoded ? m_value.size() : m_size; }
+
+  bool empty() const { return size() == 0; }
+
+  /** @return a copy of the string. */
+  std::string str() const { return std::string(data(), size()); }
+
+ private:
+  PdxStringView(const char* data, size_t size,
+                std::shared_ptr<const uint8_t> stream)
+      : m_data(data), m_size(size), m_stream(std::move(stream)) {}
+
+  explicit PdxStringView(std::string value)
+      : m_value(std::move(value)), m_decoded(true) {}
+
+  const char* m_data = nullptr;
+  size_t m_size = 0;
+  std::shared_ptr<const uint8_t> m_stream;
+  std::string m_value;
+  bool m_decoded = false;
+
+  friend class PdxInstanceImpl;
+};
+
+/**
+ * An array field of a PdxInstance read in place: elements are decoded from
+ * the serialized stream as they are accessed, without copying the array out
+ * of it. A null array reads as an empty one.
+ *
+ * A view shares the serialized stream it was read from, so it stays valid,
+ * with the value the field had when it was read, after the PdxInstance is
+ * modified or destroyed.
+ */
+template <class T>
+class PdxArrayView {
+ public:
+  PdxArrayView() = default;
+
+  /** @return the number of elements in the array. */
+  size_t size() const { return m_size; }
+
+  bool empty() const { return m_size == 0; }
+
+  /** @return the element at index, which has to be less than size(). */
+  T operator[](size_t index) const {
+    auto position = m_data + index * sizeof(T);
+    Bits bits = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+      bits = static_cast<Bits>(bits << 8) | position[i];
+    }
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+
+  /** @return a copy of the array. */
+  std::vector<T> toVector() const {
+    std::vector<T> values;
+    values.reserve(m_size);
+    for (size_t i = 0; i < m_size; i++) {
+      values.push_back((*this)[i]);
+    }
+    return values;
+  }
+
+ private:
+  // Serialized elements are big-endian, read through an unsigned integer of
+  // the same width.
+  typedef typename std::conditional<
+      sizeof(T) == 1, uint8_t,
+      typename std::conditional<
+          sizeof(T) == 2, uint16_t,
+          typename std::conditional<sizeof(T) == 4, uint32_t,
+                                    uint64_t>::type>::type>::type Bits;
+
+  PdxArrayView(const uint8_t* data, size_t size,
+               std::shared_ptr<const uint8_t> stream)
+      : m_data(data), m_size(size), m_stream(std::move(stream)) {}
+
+  const uint8_t* m_data = nullptr;
+  size_t m_size = 0;
+  std::shared_ptr<const uint8_t> m_stream;
+
+  friend class PdxInstanceImpl;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXFIELDVIEW_H_
@@ -21,6 +21,8 @@
 #define GEODE_PDXINSTANCE_H_
 
 #include "CacheableBuiltins.hpp"
+#include "PdxFieldHandle.hpp"
+#include "PdxFieldView.hpp"
 #include "PdxFieldTypes.hpp"
 #include "PdxSerializable.hpp"
 
@@ -75,6 +77,19 @@ class APACHE_GEODE_EXPORT PdxInstance : public PdxSerializable {
    */
   virtual bool hasField(const std::string& fieldname) = 0;
 
+  /**
+   * Resolves the named field of this instance's PDX type into a handle that
+   * the handle based field accessors read from without looking the field up
+   * again. Resolve a handle once and reuse it across instances of the same
+   * type.
+   * @param fieldname name of the field to resolve
+   * @return handle of the named field.
+   * @throws IllegalStateException if PdxInstance doesn't has the named field.
+   *
+   * @see PdxInstance#hasField
+   */
+  virtual PdxFieldHandle getFieldHandle(const std::string& fieldname) const = 0;
+
   /**
    * Reads the named field and set its value in std::shared_ptr<Cacheable> type
    * out param. std::shared_ptr<Cacheable> type is corresponding to java object
@@ -189,6 +204,187 @@ class APACHE_GEODE_EXPORT PdxInstance : public PdxSerializable {
    */
   virtual std::string getStringField(const std::string& fieldname) const = 0;
 
+  /**
+   * Reads the bool field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type BOOLEAN or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual bool getBooleanField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the signed char field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type BYTE or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual int8_t getByteField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the int16_t field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type SHORT or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual int16_t getShortField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the int32_t field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type INT or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual int32_t getIntField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the int64_t field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type LONG or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual int64_t getLongField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the float field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type FLOAT or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual float getFloatField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the double field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type DOUBLE or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual double getDoubleField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the char field referred to by the handle.
+   * @param field handle of the field to read
+   * @throws IllegalStateException if the field is not of type CHAR or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual char16_t getCharField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the std::string field referred to by the handle.
+   * @param field handle of the field to read
+   * @return string value for field.
+   * @throws IllegalStateException if the field is not of type STRING or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual std::string getStringField(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the string field referred to by the handle in place, without
+   * copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type STRING or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxStringView getStringView(const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the signed char array field referred to by the handle in place,
+   * without copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type BYTE_ARRAY or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxArrayView<int8_t> getByteArrayView(
+      const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the int16_t array field referred to by the handle in place, without
+   * copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type SHORT_ARRAY or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxArrayView<int16_t> getShortArrayView(
+      const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the int32_t array field referred to by the handle in place, without
+   * copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type INT_ARRAY or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxArrayView<int32_t> getIntArrayView(
+      const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the int64_t array field referred to by the handle in place, without
+   * copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type LONG_ARRAY or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxArrayView<int64_t> getLongArrayView(
+      const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the float array field referred to by the handle in place, without
+   * copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type FLOAT_ARRAY or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxArrayView<float> getFloatArrayView(
+      const PdxFieldHandle& field) const = 0;
+
+  /**
+   * Reads the double array field referred to by the handle in place, without
+   * copying it out of the serialized stream.
+   * @param field handle of the field to read
+   * @return view of the field, sharing the serialized stream it reads.
+   * @throws IllegalStateException if the field is not of type DOUBLE_ARRAY or
+   * PdxInstance doesn't has the field.
+   *
+   * @see PdxInstance#getFieldHandle
+   */
+  virtual PdxArrayView<double> getDoubleArrayView(
+      const PdxFieldHandle& field) const = 0;
+
   /**
    * Reads the named field and set its value in bool array type out param.
    * bool* type is corresponding to java boolean[] type.
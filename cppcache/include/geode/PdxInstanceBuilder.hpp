@@ -0,0 +1,196 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXINSTANCEBUILDER_H_
+#define GEODE_PDXINSTANCEBUILDER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DataOutput.hpp"
+#include "PdxFieldTypes.hpp"
+#include "PdxInstance.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class CachePerfStats;
+class PdxInstanceImpl;
+class PdxType;
+class PdxTypeRegistry;
+
+/**
+ * Creates any number of PdxInstances with the fields of the PdxInstanceFactory
+ * it was obtained from, through {@link PdxInstanceFactory#createBuilder}.
+ *
+ * The PDX type and the layout of its fields are resolved once, when the
+ * builder is created. Each field keeps its serialized value between
+ * instances, starting with the value written to the factory, and the write
+ * methods only replace the bytes of the fields they are given. {@link
+ * #create} then assembles the stream into a buffer that is reused for every
+ * instance, so building instances of the same shape in a loop doesn't look
+ * up the type or allocate per field.
+ *
+ * <pre>
+ * auto factory = cache.createPdxInstanceFactory("com.example.Trade");
+ * factory.writeInt("id", 0).writeString("symbol", "").writeDouble("price", 0);
+ * auto builder = factory.createBuilder();
+ * auto id = builder.getFieldIndex("id");
+ * for (auto&& trade : trades) {
+ *   builder.writeInt(id, trade.id).writeDouble("price", trade.price);
+ *   region->put(trade.id, builder.create());
+ * }
+ * </pre>
+ *
+ * Only fields of primitive and string types can be written; fields of other
+ * types keep the value they were given in the factory. A builder is not
+ * thread safe; use one per thread.
+ */
+class APACHE_GEODE_EXPORT PdxInstanceBuilder {
+ public:
+  PdxInstanceBuilder() = delete;
+  ~PdxInstanceBuilder() noexcept;
+  PdxInstanceBuilder(const PdxInstanceBuilder& other) = delete;
+  PdxInstanceBuilder& operator=(const PdxInstanceBuilder& other) = delete;
+  PdxInstanceBuilder(PdxInstanceBuilder&& other) = default;
+
+  /**
+   * Create a {@link PdxInstance} from the current values of the fields.
+   * @return the created PdxInstance
+   */
+  std::shared_ptr<PdxInstance> create();
+
+  /**
+   * @return the index of the named field, to pass to the write methods
+   * instead of the field name.
+   * @throws IllegalStateException if there is no field of that name.
+   */
+  size_t getFieldIndex(const std::string& fieldName) const;
+
+  /**
+   * Replaces the value of the named field.
+   * @throws IllegalStateException if there is no field of that name or the
+   * field is of another type.
+   */
+  PdxInstanceBuilder& writeBoolean(const std::string& fieldName, bool value) {
+    return writeBoolean(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeByte(const std::string& fieldName, int8_t value) {
+    return writeByte(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeShort(const std::string& fieldName, int16_t value) {
+    return writeShort(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeInt(const std::string& fieldName, int32_t value) {
+    return writeInt(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeLong(const std::string& fieldName, int64_t value) {
+    return writeLong(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeFloat(const std::string& fieldName, float value) {
+    return writeFloat(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeDouble(const std::string& fieldName,
+                                  double value) {
+    return writeDouble(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeChar(const std::string& fieldName,
+                                char16_t value) {
+    return writeChar(getFieldIndex(fieldName), value);
+  }
+
+  PdxInstanceBuilder& writeString(const std::string& fieldName,
+                                  const std::string& value) {
+    return writeString(getFieldIndex(fieldName), value);
+  }
+
+  /**
+   * Replaces the value of the field at fieldIndex.
+   * @throws IllegalStateException if the index is out of range or the field
+   * is of another type.
+   */
+  PdxInstanceBuilder& writeBoolean(size_t fieldIndex, bool value);
+
+  PdxInstanceBuilder& writeByte(size_t fieldIndex, int8_t value);
+
+  PdxInstanceBuilder& writeShort(size_t fieldIndex, int16_t value);
+
+  PdxInstanceBuilder& writeInt(size_t fieldIndex, int32_t value);
+
+  PdxInstanceBuilder& writeLong(size_t fieldIndex, int64_t value);
+
+  PdxInstanceBuilder& writeFloat(size_t fieldIndex, float value);
+
+  PdxInstanceBuilder& writeDouble(size_t fieldIndex, double value);
+
+  PdxInstanceBuilder& writeChar(size_t fieldIndex, char16_t value);
+
+  PdxInstanceBuilder& writeString(size_t fieldIndex, const std::string& value);
+
+ private:
+  struct Field {
+    std::string name;
+    PdxFieldTypes type;
+    bool isVariableLength;
+    std::vector<uint8_t> bytes;
+  };
+
+  PdxInstanceBuilder(const PdxInstanceImpl& prototype,
+                     CachePerfStats& cachePerfStats,
+                     PdxTypeRegistry& pdxTypeRegistry,
+                     const CacheImpl& cacheImpl, bool enableTimeStatistics);
+
+  std::vector<uint8_t>& getFieldBytes(size_t fieldIndex, PdxFieldTypes type);
+
+  void writeBigEndian(size_t fieldIndex, PdxFieldTypes type, uint64_t value,
+                      size_t size);
+
+  int32_t getTypeId();
+
+  std::shared_ptr<PdxType> m_pdxType;
+  int32_t m_typeId;
+  uint32_t m_generation;
+  std::vector<Field> m_fields;
+  std::vector<uint8_t> m_stream;
+  std::vector<int32_t> m_offsets;
+  DataOutput m_scratch;
+  CachePerfStats& m_cachePerfStats;
+  PdxTypeRegistry& m_pdxTypeRegistry;
+  const CacheImpl& m_cacheImpl;
+  bool m_enableTimeStatistics;
+
+  friend class PdxInstanceFactory;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXINSTANCEBUILDER_H_
@@ -26,6 +26,7 @@
 #include "CacheableDate.hpp"
 #include "CacheableObjectArray.hpp"
 #include "PdxInstance.hpp"
+#include "PdxInstanceBuilder.hpp"
 #include "internal/geode_globals.hpp"
 
 namespace apache {
@@ -68,6 +69,16 @@ class APACHE_GEODE_EXPORT PdxInstanceFactory {
    */
   std::shared_ptr<PdxInstance> create();
 
+  /**
+   * Create a {@link PdxInstanceBuilder} for any number of PdxInstances with
+   * the fields written to this factory. The PDX type is registered once, and
+   * the written values are the initial values of the builder's fields.
+   * @return the created PdxInstanceBuilder
+   * @throws IllegalStateException if {@link #create} or this method was
+   * already called
+   */
+  PdxInstanceBuilder createBuilder();
+
   /**
    * Writes the named field with the given value to the serialized form.
    * The fields type is <code>char16_t</code>.
@@ -0,0 +1,89 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXPROJECTION_H_
+#define GEODE_PDXPROJECTION_H_
+
+#include <string>
+#include <vector>
+
+#include "PdxFieldHandle.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class PdxInstance;
+
+/**
+ * The fields an application reads from PDX instances, declared once up
+ * front. The fields are resolved to handles the first time an instance of a
+ * PDX type is seen, and the handles are reused for every later instance of
+ * that type. Only the declared fields are then located, through the offset
+ * table of each instance's serialized stream, and decoded.
+ *
+ * Combined with the view accessors of PdxInstance, strings and arrays are
+ * read in place instead of being copied out of the stream. Use it with
+ * instances that were read with PDX read serialized enabled, so that nothing
+ * else of the object is deserialized.
+ *
+ * <pre>
+ * PdxProjection projection({"id", "name", "prices"});
+ * for (auto&& instance : instances) {
+ *   auto& fields = projection.getFieldHandles(*instance);
+ *   auto id = instance->getIntField(fields[0]);
+ *   auto name = instance->getStringView(fields[1]);
+ *   auto prices = instance->getDoubleArrayView(fields[2]);
+ *   ...
+ * }
+ * </pre>
+ *
+ * A projection caches the handles of one type at a time and is not thread
+ * safe; use one per thread.
+ */
+class APACHE_GEODE_EXPORT PdxProjection {
+ public:
+  explicit PdxProjection(std::vector<std::string> fieldNames);
+
+  /** @return the names of the declared fields. */
+  const std::vector<std::string>& getFieldNames() const {
+    return m_fieldNames;
+  }
+
+  /**
+   * @return handles of the declared fields, in the order they were declared,
+   * for the PDX type of instance. The reference stays valid until the next
+   * call with an instance of another type.
+   * @throws IllegalStateException if instance doesn't have one of the fields.
+   */
+  const std::vector<PdxFieldHandle>& getFieldHandles(
+      const PdxInstance& instance);
+
+ private:
+  std::vector<std::string> m_fieldNames;
+  std::vector<PdxFieldHandle> m_fieldHandles;
+  int32_t m_pdxTypeId;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXPROJECTION_H_
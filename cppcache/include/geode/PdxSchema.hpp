@@ -0,0 +1,425 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PDXSCHEMA_H_
+#define GEODE_PDXSCHEMA_H_
+
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DataOutput.hpp"
+#include "PdxFieldTypes.hpp"
+#include "PdxReader.hpp"
+#include "PdxSerializable.hpp"
+#include "PdxWriter.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class Pool;
+class PdxTypeRegistry;
+
+namespace internal {
+
+/**
+ * Non template base of PdxSchemaSerializable through which PDX serialization
+ * finds the objects that can write themselves without a PdxWriter.
+ */
+class APACHE_GEODE_EXPORT PdxSchemaSerializableBase : public PdxSerializable {
+ public:
+  ~PdxSchemaSerializableBase() noexcept override;
+
+  /**
+   * Writes this object as a complete PDX stream, header included, to output.
+   * @return false if nothing was written and the object has to be serialized
+   * through toData instead.
+   */
+  virtual bool writePdxStream(DataOutput& output) const = 0;
+};
+
+}  // namespace internal
+
+/**
+ * Class independent part of a PdxSchema: the ordered field list, the stream
+ * layout derived from it and the id of the PDX type it is registered under.
+ */
+class APACHE_GEODE_EXPORT PdxSchemaLayout {
+ public:
+  /** Size of the length and type id header in front of the PDX fields. */
+  static constexpr int32_t PdxHeaderSize = 8;
+
+  PdxSchemaLayout(const PdxSchemaLayout&) = delete;
+  PdxSchemaLayout& operator=(const PdxSchemaLayout&) = delete;
+
+  /** @return the PDX class name the schema describes. */
+  const std::string& getClassName() const { return m_className; }
+
+  /** @return the number of variable length fields in the schema. */
+  int32_t getNumberOfVarLenFields() const { return m_numberOfVarLenFields; }
+
+ protected:
+  struct FieldLayout {
+    std::string name;
+    PdxFieldTypes type;
+  };
+
+  explicit PdxSchemaLayout(std::string className);
+
+  ~PdxSchemaLayout() noexcept = default;
+
+  void addField(std::string name, PdxFieldTypes type);
+
+  /**
+   * Returns the id of the PDX type described by this schema in the type
+   * registry of the output's cache, registering the type on first use. The id
+   * is cached until the registry is cleared. Returns 0 when the registry
+   * already holds a different layout for the class name, in which case
+   * objects have to be serialized through toData.
+   */
+  int32_t getTypeId(DataOutput& output) const;
+
+  /**
+   * Writes the length and type id into the header reserved at startPosition
+   * and appends the offset table for the variable length fields.
+   * @param offsets stream offsets of the variable length fields, in order
+   */
+  void writePdxHeader(DataOutput& output, size_t startPosition,
+                      int32_t typeId, const int32_t* offsets) const;
+
+  std::vector<FieldLayout> m_fields;
+
+ private:
+  int32_t registerType(PdxTypeRegistry& pdxTypeRegistry, Pool* pool) const;
+
+  std::string m_className;
+  int32_t m_numberOfVarLenFields;
+  mutable std::atomic<uint64_t> m_typeBinding;
+};
+
+/**
+ * Describes the PDX fields of class T once, in serialization order, so that
+ * instances of T are written by a writer specialized for that layout instead
+ * of a PdxWriter call per field. The PDX type id of the schema is cached, so
+ * after the first object neither the class name nor the field names are
+ * looked up again. Supported field types are bool, int8_t, int16_t, int32_t,
+ * int64_t, float, double, char16_t and std::string.
+ *
+ * A schema is usually a function local static of the class it describes:
+ * @code
+ * class Order : public PdxSchemaSerializable<Order> {
+ *  public:
+ *   static const PdxSchema<Order>& getPdxSchema() {
+ *     static const PdxSchema<Order> schema("com.example.Order",
+ *                                          {{"id", &Order::m_id},
+ *                                           {"symbol", &Order::m_symbol},
+ *                                           {"price", &Order::m_price}});
+ *     return schema;
+ *   }
+ *   ...
+ * };
+ * @endcode
+ *
+ * @see PdxSchemaSerializable
+ */
+template <class T>
+class PdxSchema : public PdxSchemaLayout {
+ public:
+  /** A named member of T. */
+  class Field {
+   public:
+    Field(std::string name, bool T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::BOOLEAN) {
+      m_member.boolean = member;
+    }
+
+    Field(std::string name, int8_t T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::BYTE) {
+      m_member.byte = member;
+    }
+
+    Field(std::string name, int16_t T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::SHORT) {
+      m_member.shortInt = member;
+    }
+
+    Field(std::string name, int32_t T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::INT) {
+      m_member.integer = member;
+    }
+
+    Field(std::string name, int64_t T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::LONG) {
+      m_member.longInt = member;
+    }
+
+    Field(std::string name, float T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::FLOAT) {
+      m_member.floatingPoint = member;
+    }
+
+    Field(std::string name, double T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::DOUBLE) {
+      m_member.doublePrecision = member;
+    }
+
+    Field(std::string name, char16_t T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::CHAR) {
+      m_member.character = member;
+    }
+
+    Field(std::string name, std::string T::*member)
+        : m_name(std::move(name)), m_type(PdxFieldTypes::STRING) {
+      m_member.string = member;
+    }
+
+   private:
+    union Member {
+      bool T::*boolean;
+      int8_t T::*byte;
+      int16_t T::*shortInt;
+      int32_t T::*integer;
+      int64_t T::*longInt;
+      float T::*floatingPoint;
+      double T::*doublePrecision;
+      char16_t T::*character;
+      std::string T::*string;
+    };
+
+    std::string m_name;
+    PdxFieldTypes m_type;
+    Member m_member;
+
+    friend class PdxSchema;
+  };
+
+  PdxSchema(std::string className, std::initializer_list<Field> fields)
+      : PdxSchemaLayout(std::move(className)) {
+    m_accessors.reserve(fields.size());
+    for (auto&& field : fields) {
+      addField(field.m_name, field.m_type);
+      m_accessors.push_back(Accessor{field.m_type, field.m_member});
+    }
+  }
+
+  /**
+   * Writes the fields of object to writer, for the serialization paths that
+   * need a PdxWriter.
+   */
+  void toData(const T& object, PdxWriter& writer) const {
+    for (size_t i = 0; i < m_accessors.size(); i++) {
+      auto& name = m_fields[i].name;
+      auto& member = m_accessors[i].member;
+      switch (m_accessors[i].type) {
+        case PdxFieldTypes::BOOLEAN:
+          writer.writeBoolean(name, object.*member.boolean);
+          break;
+        case PdxFieldTypes::BYTE:
+          writer.writeByte(name, object.*member.byte);
+          break;
+        case PdxFieldTypes::SHORT:
+          writer.writeShort(name, object.*member.shortInt);
+          break;
+        case PdxFieldTypes::INT:
+          writer.writeInt(name, object.*member.integer);
+          break;
+        case PdxFieldTypes::LONG:
+          writer.writeLong(name, object.*member.longInt);
+          break;
+        case PdxFieldTypes::FLOAT:
+          writer.writeFloat(name, object.*member.floatingPoint);
+          break;
+        case PdxFieldTypes::DOUBLE:
+          writer.writeDouble(name, object.*member.doublePrecision);
+          break;
+        case PdxFieldTypes::CHAR:
+          writer.writeChar(name, object.*member.character);
+          break;
+        case PdxFieldTypes::STRING:
+          writer.writeString(name, object.*member.string);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  /** Reads the fields of object from reader. */
+  void fromData(T& object, PdxReader& reader) const {
+    for (size_t i = 0; i < m_accessors.size(); i++) {
+      auto& name = m_fields[i].name;
+      auto& member = m_accessors[i].member;
+      switch (m_accessors[i].type) {
+        case PdxFieldTypes::BOOLEAN:
+          object.*member.boolean = reader.readBoolean(name);
+          break;
+        case PdxFieldTypes::BYTE:
+          object.*member.byte = reader.readByte(name);
+          break;
+        case PdxFieldTypes::SHORT:
+          object.*member.shortInt = reader.readShort(name);
+          break;
+        case PdxFieldTypes::INT:
+          object.*member.integer = reader.readInt(name);
+          break;
+        case PdxFieldTypes::LONG:
+          object.*member.longInt = reader.readLong(name);
+          break;
+        case PdxFieldTypes::FLOAT:
+          object.*member.floatingPoint = reader.readFloat(name);
+          break;
+        case PdxFieldTypes::DOUBLE:
+          object.*member.doublePrecision = reader.readDouble(name);
+          break;
+        case PdxFieldTypes::CHAR:
+          object.*member.character = reader.readChar(name);
+          break;
+        case PdxFieldTypes::STRING:
+          object.*member.string = reader.readString(name);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  /**
+   * Writes object as a complete PDX stream to output using the cached type id
+   * of the schema.
+   * @return false if the type could not be bound to the schema and nothing
+   * was written.
+   */
+  bool writePdxStream(const T& object, DataOutput& output) const {
+    auto typeId = getTypeId(output);
+    if (typeId == 0) {
+      return false;
+    }
+    writePdxStream(object, output, typeId);
+    return true;
+  }
+
+  /** Writes object as a complete PDX stream of the given type to output. */
+  void writePdxStream(const T& object, DataOutput& output,
+                      int32_t typeId) const {
+    auto startPosition = output.getBufferLength();
+    output.advanceCursor(PdxHeaderSize);
+
+    int32_t localOffsets[InlineOffsets];
+    std::unique_ptr<int32_t[]> allocatedOffsets;
+    auto offsets = localOffsets;
+    if (getNumberOfVarLenFields() > InlineOffsets) {
+      allocatedOffsets.reset(new int32_t[getNumberOfVarLenFields()]);
+      offsets = allocatedOffsets.get();
+    }
+    auto nextOffset = offsets;
+
+    for (auto&& accessor : m_accessors) {
+      auto& member = accessor.member;
+      switch (accessor.type) {
+        case PdxFieldTypes::BOOLEAN:
+          output.writeBoolean(object.*member.boolean);
+          break;
+        case PdxFieldTypes::BYTE:
+          output.write(object.*member.byte);
+          break;
+        case PdxFieldTypes::SHORT:
+          output.writeInt(object.*member.shortInt);
+          break;
+        case PdxFieldTypes::INT:
+          output.writeInt(object.*member.integer);
+          break;
+        case PdxFieldTypes::LONG:
+          output.writeInt(object.*member.longInt);
+          break;
+        case PdxFieldTypes::FLOAT:
+          output.writeFloat(object.*member.floatingPoint);
+          break;
+        case PdxFieldTypes::DOUBLE:
+          output.writeDouble(object.*member.doublePrecision);
+          break;
+        case PdxFieldTypes::CHAR:
+          output.writeChar(object.*member.character);
+          break;
+        case PdxFieldTypes::STRING:
+          *nextOffset++ = static_cast<int32_t>(output.getBufferLength() -
+                                               startPosition - PdxHeaderSize);
+          output.writeString(object.*member.string);
+          break;
+        default:
+          break;
+      }
+    }
+
+    writePdxHeader(output, startPosition, typeId, offsets);
+  }
+
+ private:
+  static constexpr int32_t InlineOffsets = 16;
+
+  struct Accessor {
+    PdxFieldTypes type;
+    typename Field::Member member;
+  };
+
+  std::vector<Accessor> m_accessors;
+};
+
+template <class T>
+constexpr int32_t PdxSchema<T>::InlineOffsets;
+
+/**
+ * Base for PdxSerializable classes whose fields are described by a
+ * PdxSchema. T has to provide
+ * <code>static const PdxSchema<T>& getPdxSchema()</code>; toData, fromData
+ * and getClassName are implemented from it, and PDX serialization writes the
+ * objects through the schema without a PdxWriter. T still has to be
+ * registered with the type registry like any other PdxSerializable.
+ */
+template <class T>
+class PdxSchemaSerializable : public internal::PdxSchemaSerializableBase {
+ public:
+  ~PdxSchemaSerializable() noexcept override = default;
+
+  void toData(PdxWriter& writer) const override {
+    T::getPdxSchema().toData(static_cast<const T&>(*this), writer);
+  }
+
+  void fromData(PdxReader& reader) override {
+    T::getPdxSchema().fromData(static_cast<T&>(*this), reader);
+  }
+
+  const std::string& getClassName() const override {
+    return T::getPdxSchema().getClassName();
+  }
+
+  bool writePdxStream(DataOutput& output) const override {
+    return T::getPdxSchema().writePdxStream(static_cast<const T&>(*this),
+                                            output);
+  }
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PDXSCHEMA_H_
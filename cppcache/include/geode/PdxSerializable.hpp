@@ -32,6 +32,7 @@ namespace geode {
 namespace client {
 
 class PdxReader;
+class PdxUnreadFields;
 class PdxWriter;
 
 /**
@@ -64,6 +65,15 @@ class APACHE_GEODE_EXPORT PdxSerializable : public virtual Serializable,
    * Get the Type for the Object. Equivalent to the C# Type->GetType() API.
    */
   virtual const std::string& getClassName() const = 0;
+
+ private:
+  /**
+   * Fields of a newer version of this object's PDX type that were not read
+   * when it was deserialized; written back when it is serialized again.
+   */
+  std::shared_ptr<PdxUnreadFields> m_preservedData;
+
+  friend class PdxHelper;
 };
 
 }  // namespace client
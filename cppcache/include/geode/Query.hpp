@@ -22,6 +22,8 @@
 
 #include <chrono>
 
+#include "ColumnarResults.hpp"
+#include "QueryCursor.hpp"
 #include "SelectResults.hpp"
 #include "internal/geode_globals.hpp"
 
@@ -33,6 +35,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class Region;
+
 /**
  * @class Query Query.hpp
  *
@@ -90,6 +94,89 @@ class APACHE_GEODE_EXPORT Query {
   virtual std::shared_ptr<SelectResults> execute(
       std::shared_ptr<CacheableVector> paramList,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query on the buckets of a partitioned region in
+   * parallel, instead of having a single server coordinate the query over all
+   * the members hosting the region.
+   *
+   * The query is run through the query function queryFunctionId deployed on
+   * the servers. When single hop is enabled for the pool of the region, the
+   * function is sent concurrently to each server, restricted to the buckets
+   * for which that server is the primary, and the results of all servers are
+   * merged on the client.
+   *
+   * The function is called with a CacheableVector argument holding the query
+   * string followed by the query parameters. It should execute the query on
+   * the data of its RegionFunctionContext and send the resulting rows, either
+   * one per result or as lists, which are flattened into the rows of the
+   * returned ResultSet.
+   *
+   * The rows are merged by appending the rows of each bucket, so the query
+   * must read from region only, and must not use ORDER BY, LIMIT, DISTINCT,
+   * GROUP BY or aggregate functions, which would apply to each bucket
+   * separately. Run such queries with execute instead.
+   *
+   * @param region The partitioned region the query runs on.
+   * @param queryFunctionId The id of the query function on the servers.
+   * @param paramList The query parameters list, optional.
+   * @param timeout The time to wait for the merged results of all buckets,
+   * optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms,
+   * region is null or the query reads from another region.
+   * @throws UnsupportedOperationException If the query orders, limits,
+   * groups, aggregates or selects DISTINCT rows.
+   * @throws QueryException if the query function sent an exception.
+   * @throws FunctionExecutionException if the function execution failed.
+   * @returns A smart pointer to the ResultSet of the merged rows.
+   */
+  virtual std::shared_ptr<SelectResults> executeParallel(
+      const std::shared_ptr<Region>& region, const std::string& queryFunctionId,
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query on the cache server and returns a cursor over the
+   * results. Rows become available through the cursor as soon as the part of
+   * the server response containing them has been decoded, rather than after
+   * the complete result has been received.
+   *
+   * @param paramList The query parameters list, optional.
+   * @param timeout The time to wait for query response, optional.
+   * @param readAhead The maximum number of decoded rows buffered ahead of the
+   * consumer before reading from the server is suspended, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms or
+   * readAhead is zero.
+   * @throws CacheClosedException if the cache has been closed.
+   * @returns A smart pointer to the QueryCursor. Errors occurring while the
+   * query executes are thrown by QueryCursor::hasNext.
+   */
+  virtual std::shared_ptr<QueryCursor> executeCursor(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t readAhead = DEFAULT_QUERY_CURSOR_READ_AHEAD) = 0;
+
+  /**
+   * Executes the OQL Query on the cache server and returns the results in
+   * columnar form. The values of each field are decoded directly into a
+   * column of primitive or string values where possible, avoiding the
+   * allocation of a Struct and a Cacheable per value.
+   *
+   * @param paramList The query parameters list, optional.
+   * @param timeout The time to wait for query response, optional.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms.
+   * @throws QueryException if some query error occurred at the server.
+   * @throws IllegalStateException if some error occurred.
+   * @throws NotConnectedException if no java cache server is available.
+   * @returns A smart pointer to the ColumnarResults.
+   */
+  virtual std::shared_ptr<ColumnarResults> executeColumnar(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
@@ -99,19 +186,22 @@ class APACHE_GEODE_EXPORT Query {
   virtual const std::string& getQueryString() const = 0;
 
   /**
-   * Compile the Query - client side query compilation is not supported.
+   * Compile the Query on the client. The query string part of the request
+   * message is encoded once and shared by all queries with the same query
+   * string obtained from the same QueryService, so that executions only need
+   * to serialize the bound parameters. Executions of compiled queries are
+   * recorded in the query statistics of the QueryService, and the number of
+   * parameters passed to execute is checked against the parameters
+   * ($1 .. $n) the query string references.
    *
-   * @throws UnsupportedOperationException because this is not currently
-   * supported.
+   * The query is still parsed and planned by the server on execution.
    */
   virtual void compile() = 0;
 
   /**
-   * Check whether the Query is compiled - client side query compilation
-   * is not supported.
+   * Check whether the Query has been compiled with compile().
    *
-   * @throws UnsupportedOperationException because this is not currently
-   * supported.
+   * @returns true if the query has been compiled.
    */
   virtual bool isCompiled() = 0;
 };
@@ -0,0 +1,105 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERYCURSOR_H_
+#define GEODE_QUERYCURSOR_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The default number of rows a QueryCursor decodes ahead of the consumer
+ * before it stops reading the response from the server.
+ */
+constexpr static size_t DEFAULT_QUERY_CURSOR_READ_AHEAD = 1000;
+
+/**
+ * @class QueryCursor QueryCursor.hpp
+ *
+ * A QueryCursor is obtained by executing a Query with Query::executeCursor.
+ * Unlike SelectResults, rows are handed out as soon as the chunk of the
+ * server response containing them has been decoded, so the first rows can be
+ * consumed while the remainder of the result is still being received.
+ *
+ * At most a bounded number of decoded rows is buffered ahead of the consumer;
+ * once that limit is reached reading from the server connection is suspended
+ * until the consumer catches up.
+ *
+ * Rows of a struct result are returned as Struct objects, otherwise the
+ * values themselves are returned.
+ *
+ * This class is intentionally not thread-safe. Only a single thread should
+ * consume the rows of a cursor.
+ */
+class APACHE_GEODE_EXPORT QueryCursor {
+ public:
+  virtual ~QueryCursor() noexcept = default;
+
+  /**
+   * Check whether there is another row available, waiting until the next
+   * row has been decoded or the end of the results has been reached.
+   *
+   * @throws QueryException if some query error occurred at the server.
+   * @throws TimeoutException if the server did not respond in time.
+   * @throws IllegalStateException if the cursor has been closed.
+   * @returns true if a call to next() will return a row.
+   */
+  virtual bool hasNext() = 0;
+
+  /**
+   * Get the next row of the results.
+   *
+   * @throws IllegalStateException if no more rows are available.
+   * @returns A smart pointer to the next row, a Struct for struct results.
+   */
+  virtual std::shared_ptr<Serializable> next() = 0;
+
+  /**
+   * Get the field names of a struct result. Field names are only known once
+   * the first row is available, and the vector is empty for results that are
+   * not structs.
+   *
+   * @returns a copy of the field names of the result structs.
+   */
+  virtual std::vector<std::string> getFieldNames() = 0;
+
+  /**
+   * Close the cursor, discarding any rows that have not been consumed. The
+   * remainder of the server response is drained and dropped.
+   */
+  virtual void close() = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERYCURSOR_H_
@@ -108,6 +108,18 @@ class APACHE_GEODE_EXPORT ResultCollector {
    * @since 6.5
    */
   virtual void clearResults() = 0;
+
+  /**
+   * Whether the results are to be added to this ResultCollector in their
+   * serialized form, as SerializedResult objects referring to the bytes
+   * received from the server, instead of being deserialized first. This
+   * avoids the cost of deserializing results that are only passed on, and
+   * allows the ResultCollector to deserialize only the results it needs.
+   *
+   * Exceptions sent by the function are still added as
+   * UserFunctionExecutionException.
+   */
+  virtual bool isSerializedResults() const { return false; }
 };
 
 }  // namespace client
@@ -0,0 +1,71 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SERIALIZEDRESULT_H_
+#define GEODE_SERIALIZEDRESULT_H_
+
+#include <memory>
+
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class SerializedResult SerializedResult.hpp
+ *
+ * A function execution result in the serialized form in which it was
+ * received from the server. It is added to a ResultCollector instead of the
+ * deserialized result when ResultCollector::isSerializedResults returns true.
+ *
+ * The bytes refer to the buffer the response was read into, without copying.
+ * They remain valid for as long as the SerializedResult is referenced.
+ */
+class APACHE_GEODE_EXPORT SerializedResult : public Serializable {
+ public:
+  ~SerializedResult() noexcept override = default;
+
+  /**
+   * Get the serialized bytes of the result, starting with its type id.
+   */
+  virtual const uint8_t* getBytes() const = 0;
+
+  /**
+   * Get the number of serialized bytes of the result.
+   */
+  virtual size_t getLength() const = 0;
+
+  /**
+   * Deserialize the result. The result is deserialized again on every call.
+   * The cache the result was received by must not have been closed.
+   */
+  virtual std::shared_ptr<Serializable> deserialize() const = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SERIALIZEDRESULT_H_
@@ -0,0 +1,93 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTOR_H_
+#define GEODE_STREAMINGRESULTCOLLECTOR_H_
+
+#include <memory>
+
+#include "ResultCollector.hpp"
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The default number of function results a StreamingResultCollector buffers
+ * ahead of the consumer before it stops reading the response from the
+ * server.
+ */
+constexpr static size_t DEFAULT_STREAMING_RESULT_CAPACITY = 1000;
+
+/**
+ * @class StreamingResultCollector StreamingResultCollector.hpp
+ *
+ * A StreamingResultCollector is obtained by executing a function with
+ * Execution::executeStreaming. The function executes in the background and
+ * its results can be consumed as soon as they have been received, instead of
+ * after the function has completed.
+ *
+ * At most a bounded number of results is buffered ahead of the consumer;
+ * once that limit is reached reading from the server connection is suspended
+ * until the consumer catches up. Consumed results are not retained by the
+ * collector.
+ *
+ * This class is intentionally not thread-safe. Only a single thread should
+ * consume the results of a collector.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  ~StreamingResultCollector() noexcept override = default;
+
+  /**
+   * Check whether there is another result, blocking until one has been
+   * received or the function execution has completed.
+   *
+   * @throws IllegalStateException if the collector has been closed.
+   * @throws FunctionExecutionException if results already consumed were
+   * invalidated by the function being re-executed.
+   * @throws Exception any exception of the function execution.
+   */
+  virtual bool hasNext() = 0;
+
+  /**
+   * Get the next result.
+   *
+   * @throws IllegalStateException if there is no next result.
+   */
+  virtual std::shared_ptr<Cacheable> next() = 0;
+
+  /**
+   * Stop consuming results. Results still received from the server are
+   * discarded. Waits for the function execution to complete.
+   */
+  virtual void close() = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTOR_H_
@@ -242,6 +242,19 @@ class APACHE_GEODE_EXPORT SystemProperties {
    */
   uint32_t logDiskSpaceLimit() const { return m_logDiskSpaceLimit; }
 
+  /**
+   * Returns the log-queue-size, the number of log lines that can wait for
+   * the background log writer. 0 means lines are written by the thread
+   * logging them.
+   */
+  uint32_t logQueueSize() const { return m_logQueueSize; }
+
+  /**
+   * Returns true if log lines are dropped, rather than waited on, when the
+   * log queue is full.
+   */
+  bool logQueueDropWhenFull() const { return m_logQueueDropWhenFull; }
+
   /**
    * Returns the stat-file-space-limit.
    */
@@ -252,6 +265,20 @@ class APACHE_GEODE_EXPORT SystemProperties {
    */
   uint32_t statsDiskSpaceLimit() const { return m_statsDiskSpaceLimit; }
 
+  /**
+   * Returns the port on which statistics are served in OpenMetrics format,
+   * or 0 if they are not served.
+   */
+  uint16_t statisticExporterPort() const { return m_statisticExporterPort; }
+
+  /**
+   * Returns the address on which statistics are served in OpenMetrics
+   * format.
+   */
+  const std::string& statisticExporterBindAddress() const {
+    return m_statisticExporterBindAddress;
+  }
+
   uint32_t connectionPoolSize() const { return m_connectionPoolSize; }
   void setjavaConnectionPoolSize(uint32_t size) { m_connectionPoolSize = size; }
 
@@ -267,6 +294,13 @@ class APACHE_GEODE_EXPORT SystemProperties {
     m_enableChunkHandlerThread = set;
   }
 
+  /**
+   * Returns the number of threads decoding the chunks of large query,
+   * function execution and getAll responses in parallel, 0 if the chunks are
+   * decoded by the thread handling them.
+   */
+  uint32_t chunkDecodeThreads() const { return m_chunkDecodeThreads; }
+
   /**
    * Returns true if app wants to clear pdx type ids when client disconnect.
    * deafult is false.
@@ -283,6 +317,19 @@ class APACHE_GEODE_EXPORT SystemProperties {
     m_onClientDisconnectClearPdxTypeIds = set;
   }
 
+  /**
+   * Returns true if pools fetch all registered pdx types and enums from the
+   * server when they start, instead of one at a time on first use.
+   * Default is false.
+   */
+  bool pdxPrefetchTypes() const { return m_pdxPrefetchTypes; }
+
+  /**
+   * Set to true to fetch all registered pdx types and enums when a pool
+   * starts.
+   */
+  void setPdxPrefetchTypes(bool set) { m_pdxPrefetchTypes = set; }
+
   /** Return the security Diffie-Hellman secret key algorithm */
   const std::string& securityClientDhAlgo() const {
     return m_securityClientDhAlgo;
@@ -376,10 +423,15 @@ class APACHE_GEODE_EXPORT SystemProperties {
 
   uint32_t m_logFileSizeLimit;
   uint32_t m_logDiskSpaceLimit;
+  uint32_t m_logQueueSize;
+  bool m_logQueueDropWhenFull;
 
   uint32_t m_statsFileSizeLimit;
   uint32_t m_statsDiskSpaceLimit;
 
+  uint16_t m_statisticExporterPort;
+  std::string m_statisticExporterBindAddress;
+
   uint32_t m_connectionPoolSize;
 
   int32_t m_heapLRULimit;
@@ -420,7 +472,9 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::chrono::seconds m_suspendedTxTimeout;
   std::chrono::milliseconds m_tombstoneTimeout;
   bool m_enableChunkHandlerThread;
+  uint32_t m_chunkDecodeThreads;
   bool m_onClientDisconnectClearPdxTypeIds;
+  bool m_pdxPrefetchTypes;
 
   /**
    * Processes the given property/value pair, saving
@@ -36,6 +36,9 @@ class CacheableObjectArray;
  * modification
  * using the {@link #setField} method.
  * To get a WritablePdxInstance call {@link PdxInstance#createWriter}.
+ * Serializing it after setField replaces its serialized stream, so it must
+ * not be read by other threads while it is modified or serialized. Field
+ * views read before keep the stream they were read from.
  */
 class APACHE_GEODE_EXPORT WritablePdxInstance : public PdxInstance {
  public:
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/ColumnarResults.hpp>
+#include <geode/QueryService.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+#include "framework/Cluster.h"
+#include "framework/Framework.h"
+#include "framework/Gfsh.h"
+
+namespace {
+
+using apache::geode::client::ColumnType;
+using apache::geode::client::RegionShortcut;
+
+TEST(ColumnarQueryTest, structFieldsAreDecodedIntoColumns) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto cache = cluster.createCache();
+  auto region = cache.createRegionFactory(RegionShortcut::PROXY)
+                    .setPoolName("default")
+                    .create("region");
+
+  const int numEntries = 100;
+  for (int i = 0; i < numEntries; i++) {
+    region->put(i, std::to_string(i));
+  }
+
+  auto results =
+      cache.getQueryService()
+          ->newQuery("SELECT e.key, e.value FROM /region.entries e")
+          ->executeColumnar();
+
+  ASSERT_EQ(numEntries, results->size());
+  ASSERT_EQ(2, results->getColumnCount());
+  ASSERT_EQ(ColumnType::INT64, results->getColumnType(0));
+  ASSERT_EQ(ColumnType::STRING, results->getColumnType(1));
+
+  const auto& keys = results->getInt64Column(0);
+  const auto& values = results->getStringColumn(1);
+  std::unordered_map<int64_t, std::string> rows;
+  for (size_t row = 0; row < results->size(); row++) {
+    rows.emplace(keys[row], values[row]);
+  }
+  EXPECT_EQ(numEntries, rows.size());
+  for (auto&& row : rows) {
+    EXPECT_EQ(std::to_string(row.first), row.second);
+  }
+}
+
+TEST(ColumnarQueryTest, resultSetHasSingleColumn) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto cache = cluster.createCache();
+  auto region = cache.createRegionFactory(RegionShortcut::PROXY)
+                    .setPoolName("default")
+                    .create("region");
+
+  for (int i = 0; i < 10; i++) {
+    region->put(i, static_cast<double>(i) / 2);
+  }
+
+  auto results = cache.getQueryService()
+                     ->newQuery("SELECT * FROM /region")
+                     ->executeColumnar();
+
+  ASSERT_EQ(10, results->size());
+  ASSERT_EQ(1, results->getColumnCount());
+  ASSERT_EQ(ColumnType::DOUBLE, results->getColumnType(0));
+  EXPECT_EQ(10, results->getDoubleColumn(0).size());
+}
+
+}  // namespace
@@ -0,0 +1,117 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/QueryCursor.hpp>
+#include <geode/QueryService.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+#include <geode/Struct.hpp>
+
+#include "framework/Cluster.h"
+#include "framework/Framework.h"
+#include "framework/Gfsh.h"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+using apache::geode::client::Struct;
+
+std::shared_ptr<Region> setupRegion(Cache& cache) {
+  auto region = cache.createRegionFactory(RegionShortcut::PROXY)
+                    .setPoolName("default")
+                    .create("region");
+
+  return region;
+}
+
+TEST(QueryCursorTest, cursorReturnsAllRowsWithSmallReadAhead) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto cache = cluster.createCache();
+  auto region = setupRegion(cache);
+
+  const int numEntries = 1000;
+  for (int i = 0; i < numEntries; i++) {
+    region->put(i, std::to_string(i));
+  }
+
+  auto cursor = cache.getQueryService()
+                    ->newQuery("SELECT e.key, e.value FROM /region.entries e")
+                    ->executeCursor(nullptr, std::chrono::seconds(15), 10);
+
+  std::unordered_map<int, std::string> rows;
+  while (cursor->hasNext()) {
+    auto row = std::dynamic_pointer_cast<Struct>(cursor->next());
+    ASSERT_NE(nullptr, row);
+    ASSERT_EQ(2, row->size());
+    auto key = std::dynamic_pointer_cast<CacheableInt32>((*row)[0]);
+    auto value = std::dynamic_pointer_cast<CacheableString>((*row)[1]);
+    ASSERT_NE(nullptr, key);
+    ASSERT_NE(nullptr, value);
+    rows.emplace(key->value(), value->value());
+  }
+
+  ASSERT_EQ(2, cursor->getFieldNames().size());
+  EXPECT_EQ(numEntries, rows.size());
+  for (auto&& row : rows) {
+    EXPECT_EQ(std::to_string(row.first), row.second);
+  }
+}
+
+TEST(QueryCursorTest, closeBeforeConsumingAllRows) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto cache = cluster.createCache();
+  auto region = setupRegion(cache);
+
+  for (int i = 0; i < 100; i++) {
+    region->put(i, i);
+  }
+
+  auto cursor = cache.getQueryService()
+                    ->newQuery("SELECT * FROM /region")
+                    ->executeCursor(nullptr, std::chrono::seconds(15), 1);
+  ASSERT_TRUE(cursor->hasNext());
+  EXPECT_NE(nullptr, cursor->next());
+  cursor->close();
+
+  EXPECT_THROW(cursor->hasNext(),
+               apache::geode::client::IllegalStateException);
+}
+
+}  // namespace
@@ -369,3 +369,25 @@ BEGIN_TEST(LOGFN)
     }
   }
 END_TEST(LOGFN)
+
+BEGIN_TEST(ASYNC_QUEUE)
+  {
+    Log::init(LogLevel::Config, "logfile");
+    Log::startAsync(16, false);
+
+    Log::debug("Debug Message");
+    Log::config("Config Message");
+    Log::info("Info Message");
+    Log::warning("Warning Message");
+    Log::error("Error Message");
+
+    // close() writes the queued lines before closing the file
+    Log::close();
+    int lines = numOfLinesInFile("logfile.log");
+    printf("lines = %d\n", lines);
+    ASSERT(lines == 4 + LENGTH_OF_BANNER,
+           "Expected 4 + LENGTH_OF_BANNER lines.");
+    ASSERT(Log::droppedLineCount() == 0, "Expected no dropped lines.");
+    unlink("logfile.log");
+  }
+END_TEST(ASYNC_QUEUE)
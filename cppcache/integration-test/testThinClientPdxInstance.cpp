@@ -21,8 +21,10 @@
 #include <ace/High_Res_Timer.h>
 #include <ace/Date_Time.h>
 
+#include <geode/PdxBatchFilter.hpp>
 #include <geode/PdxInstance.hpp>
 #include <geode/PdxInstanceFactory.hpp>
+#include <geode/PdxProjection.hpp>
 #include <geode/WritablePdxInstance.hpp>
 
 #include "fw_dunit.hpp"
@@ -60,8 +62,10 @@ using apache::geode::client::CacheHelper;
 using apache::geode::client::CacheRegionHelper;
 using apache::geode::client::IllegalStateException;
 using apache::geode::client::LocalRegion;
+using apache::geode::client::PdxBatchFilter;
 using apache::geode::client::PdxFieldTypes;
 using apache::geode::client::PdxInstance;
+using apache::geode::client::PdxProjection;
 using apache::geode::client::PdxSerializable;
 using apache::geode::client::Properties;
 using apache::geode::client::WritablePdxInstance;
@@ -952,6 +956,72 @@ DUNIT_TASK_DEFINITION(CLIENT2, accessPdxInstance)
     ASSERT(pIPtr->getFieldType("m_string") == PdxFieldTypes::STRING,
            "Type Value STRING Mismatch");
 
+    auto intField = pIPtr->getFieldHandle("m_int32");
+    ASSERT(intField.getFieldType() == PdxFieldTypes::INT,
+           "Handle Type Value INT Mismatch");
+    ASSERT(pIPtr->getIntField(intField) == pdxobjPtr->getInt(),
+           "int32 handle values should be equal");
+    ASSERT(pIPtr->getLongField(pIPtr->getFieldHandle("m_long")) ==
+               pdxobjPtr->getLong(),
+           "int64 handle values should be equal");
+    ASSERT(pIPtr->getDoubleField(pIPtr->getFieldHandle("m_double")) ==
+               pdxobjPtr->getDouble(),
+           "double handle values should be equal");
+    ASSERT(pIPtr->getStringField(pIPtr->getFieldHandle("m_string")) ==
+               pdxobjPtr->getString(),
+           "string handle values should be equal");
+    try {
+      pIPtr->getLongField(intField);
+      FAIL("Expected IllegalStateException for mismatched handle type");
+    } catch (IllegalStateException &) {
+      LOG("Got expected IllegalStateException for mismatched handle type");
+    }
+
+    PdxProjection projection({"m_string", "m_int32Array", "m_longArray"});
+    auto &projected = projection.getFieldHandles(*pIPtr);
+    ASSERT(&projection.getFieldHandles(*pIPtr) == &projected,
+           "projection handles should be reused for the same type");
+    ASSERT(pIPtr->getStringView(projected[0]).str() == pdxobjPtr->getString(),
+           "string view should be equal");
+    auto intArrayView = pIPtr->getIntArrayView(projected[1]);
+    ASSERT(static_cast<int32_t>(intArrayView.size()) ==
+               pdxobjPtr->getIntArrayLength(),
+           "int array view length should be equal");
+    ASSERT(intArrayView.toVector() == pIPtr->getIntArrayField("m_int32Array"),
+           "int array view should be equal");
+    auto longArrayView = pIPtr->getLongArrayView(projected[2]);
+    ASSERT(longArrayView.toVector() == pIPtr->getLongArrayField("m_longArray"),
+           "long array view should be equal");
+    try {
+      pIPtr->getLongArrayView(projected[1]);
+      FAIL("Expected IllegalStateException for mismatched view type");
+    } catch (IllegalStateException &) {
+      LOG("Got expected IllegalStateException for mismatched view type");
+    }
+
+    auto longField = pIPtr->getFieldHandle("m_long");
+    auto doubleField = pIPtr->getFieldHandle("m_double");
+    std::vector<std::shared_ptr<PdxInstance>> batch{pIPtr, pIPtr};
+    PdxBatchFilter matching;
+    matching.where(intField, PdxBatchFilter::Comparison::EQUAL,
+                   pdxobjPtr->getInt())
+        .between(longField, pdxobjPtr->getLong(), pdxobjPtr->getLong())
+        .where(doubleField, PdxBatchFilter::Comparison::LESS_EQUAL,
+               pdxobjPtr->getDouble());
+    ASSERT(matching.select(batch) == std::vector<size_t>({0, 1}),
+           "batch filter should select all matching instances");
+    PdxBatchFilter notMatching;
+    notMatching.where(longField, PdxBatchFilter::Comparison::GREATER,
+                      pdxobjPtr->getLong());
+    ASSERT(notMatching.select(batch).empty(),
+           "batch filter should select no instance");
+    try {
+      notMatching.where(intField, PdxBatchFilter::Comparison::EQUAL, 1.0);
+      FAIL("Expected IllegalStateException for mismatched filter type");
+    } catch (IllegalStateException &) {
+      LOG("Got expected IllegalStateException for mismatched filter type");
+    }
+
     auto stringArrayVal = pIPtr->getStringArrayField("m_stringArray");
     ASSERT(pdxobjPtr->getStringArrayLength() ==
                static_cast<int32_t>(stringArrayVal.size()),
@@ -2529,6 +2599,40 @@ DUNIT_TASK_DEFINITION(CLIENT1, pdxIFPutGetTest)
     ASSERT(rawPP1->equals(*rawPP2, false) == true,
            "ParentPdx objects should be equal.");
 
+    auto builderFactory =
+        cacheHelper->getCache()->createPdxInstanceFactory("PdxTests.Builder");
+    builderFactory.writeInt("m_id", 0);
+    builderFactory.writeString("m_name", "");
+    builderFactory.writeDouble("m_price", 0);
+    builderFactory.writeIntArray("m_lots", std::vector<int32_t>{1, 2});
+    auto builder = builderFactory.createBuilder();
+    auto idIndex = builder.getFieldIndex("m_id");
+    for (int32_t id = 1; id <= 3; id++) {
+      auto name = std::string(static_cast<size_t>(id * 200), 'n');
+      auto built = builder.writeInt(idIndex, id)
+                       .writeString("m_name", name)
+                       .writeDouble("m_price", id * 1.5)
+                       .create();
+      auto expectedFactory = cacheHelper->getCache()->createPdxInstanceFactory(
+          "PdxTests.Builder");
+      expectedFactory.writeInt("m_id", id);
+      expectedFactory.writeString("m_name", name);
+      expectedFactory.writeDouble("m_price", id * 1.5);
+      expectedFactory.writeIntArray("m_lots", std::vector<int32_t>{1, 2});
+      auto expected = expectedFactory.create();
+      ASSERT(*built == *expected, "built PdxInstance should be equal");
+      ASSERT(built->getStringField("m_name") == name,
+             "built string field should be equal");
+      ASSERT(built->getIntArrayField("m_lots") == std::vector<int32_t>({1, 2}),
+             "built field kept from the factory should be equal");
+    }
+    try {
+      builder.writeLong(idIndex, 1);
+      FAIL("Expected IllegalStateException for mismatched builder field");
+    } catch (IllegalStateException &) {
+      LOG("Got expected IllegalStateException for mismatched builder field");
+    }
+
     LOG("pdxIFPutGetTest complete.");
   }
 END_TASK_DEFINITION
@@ -1343,20 +1343,17 @@ DUNIT_TASK_DEFINITION(CLIENT1, getPutAtVersionOne15)
            "Line_272");
 
     regPtr0->put(keyport, pRet);
-    auto testNumberOfPreservedData =
-        TestUtils::testNumberOfPreservedData(*CacheRegionHelper::getCacheImpl(
-            CacheHelper::getHelper().getCache().get()));
+    auto testHasPreservedData = TestUtils::testHasPreservedData(*pRet);
     LOGDEBUG(
         "NIL:getPutAtVersionOne15 m_useWeakHashMap = %d and "
-        "TestUtils::testNumberOfPreservedData() = %d",
-        m_useWeakHashMap, testNumberOfPreservedData);
+        "TestUtils::testHasPreservedData() = %d",
+        m_useWeakHashMap, testHasPreservedData);
     if (m_useWeakHashMap == false) {
-      ASSERT(testNumberOfPreservedData == 0,
-             "testNumberOfPreservedData should be zero at Line_288");
+      ASSERT(!testHasPreservedData,
+             "testHasPreservedData should be false at Line_288");
     } else {
-      ASSERT(
-          testNumberOfPreservedData > 0,
-          "testNumberOfPreservedData should be Greater than zero at Line_292");
+      ASSERT(testHasPreservedData,
+             "testHasPreservedData should be true at Line_292");
     }
   }
 END_TASK_DEFINITION
@@ -1376,16 +1373,14 @@ DUNIT_TASK_DEFINITION(CLIENT2, getPutAtVersionTwo16)
         "Objects of type PdxTypes1V2 should be equal at getPutAtVersionTwo14");
 
     regPtr0->put(keyport, pRet);
-    auto testNumberOfPreservedData =
-        TestUtils::testNumberOfPreservedData(*CacheRegionHelper::getCacheImpl(
-            CacheHelper::getHelper().getCache().get()));
+    auto testHasPreservedData = TestUtils::testHasPreservedData(*pRet);
     if (m_useWeakHashMap == false) {
-      ASSERT(testNumberOfPreservedData == 0,
-             "getPutAtVersionTwo16:testNumberOfPreservedData should be zero");
+      ASSERT(!testHasPreservedData,
+             "getPutAtVersionTwo16:testHasPreservedData should be false");
     } else {
       // it has extra fields, so no need to preserve data
-      ASSERT(testNumberOfPreservedData == 0,
-             "getPutAtVersionTwo16:testNumberOfPreservedData should be zero");
+      ASSERT(!testHasPreservedData,
+             "getPutAtVersionTwo16:testHasPreservedData should be false");
     }
   }
 END_TASK_DEFINITION
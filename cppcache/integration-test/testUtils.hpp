@@ -39,6 +39,7 @@
 // #include <DistributedRegion.hpp>
 #include <DistributedSystemImpl.hpp>
 #include <CacheImpl.hpp>
+#include <PdxHelper.hpp>
 
 namespace { // NOLINT(google-build-namespaces)
 
@@ -47,6 +48,8 @@ using apache::geode::client::CacheableKey;
 using apache::geode::client::CacheableString;
 using apache::geode::client::CacheImpl;
 using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxHelper;
+using apache::geode::client::PdxSerializable;
 using apache::geode::client::Region;
 using apache::geode::client::RegionInternal;
 
@@ -62,8 +65,8 @@ class TestUtils {
     return CacheRegionHelper::getCacheImpl(cptr.get());
   }
 
-  static size_t testNumberOfPreservedData(const CacheImpl& cacheImpl) {
-    return cacheImpl.getPdxTypeRegistry()->testNumberOfPreservedData();
+  static bool testHasPreservedData(const PdxSerializable& pdxObject) {
+    return PdxHelper::getPreservedData(pdxObject) != nullptr;
   }
 
   static bool waitForKey(std::shared_ptr<CacheableKey>& keyPtr,
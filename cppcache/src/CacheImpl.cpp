@@ -92,6 +92,11 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
     LOGINFO("Heap LRU eviction controller thread started");
   }
 
+  if (prop.chunkDecodeThreads() > 0) {
+    m_chunkDecodePool = std::unique_ptr<ThreadPool>(
+        new ThreadPool(prop.chunkDecodeThreads()));
+  }
+
   m_expiryTaskManager->begin();
 
   m_initialized = true;
@@ -104,7 +109,8 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
         std::unique_ptr<StatisticsManager>(new StatisticsManager(
             prop.statisticsArchiveFile().c_str(),
             prop.statisticsSampleInterval(), prop.statisticsEnabled(), this,
-            prop.statsFileSizeLimit(), prop.statsDiskSpaceLimit()));
+            prop.statsFileSizeLimit(), prop.statsDiskSpaceLimit(),
+            prop.statisticExporterPort(), prop.statisticExporterBindAddress()));
     m_cacheStats =
         new CachePerfStats(m_statisticsManager->getStatisticsFactory());
   } catch (const NullPointerException&) {
@@ -801,6 +807,10 @@ std::shared_ptr<SerializationRegistry> CacheImpl::getSerializationRegistry()
 }
 
 ThreadPool* CacheImpl::getThreadPool() { return m_threadPool; }
+
+ThreadPool* CacheImpl::getChunkDecodePool() const {
+  return m_chunkDecodePool.get();
+}
 std::shared_ptr<CacheTransactionManager>
 CacheImpl::getCacheTransactionManager() {
   this->throwIfClosed();
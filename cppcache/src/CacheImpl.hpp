@@ -310,6 +310,12 @@ class APACHE_GEODE_EXPORT CacheImpl : private NonCopyable,
 
   ThreadPool* getThreadPool();
 
+  /**
+   * The pool decoding response chunks in parallel, nullptr unless
+   * chunk-decode-threads is set.
+   */
+  ThreadPool* getChunkDecodePool() const;
+
   inline const std::shared_ptr<AuthInitialize>& getAuthInitialize() {
     return m_authInitialize;
   }
@@ -396,6 +402,7 @@ class APACHE_GEODE_EXPORT CacheImpl : private NonCopyable,
   std::shared_ptr<SerializationRegistry> m_serializationRegistry;
   std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
   ThreadPool* m_threadPool;
+  std::unique_ptr<ThreadPool> m_chunkDecodePool;
   const std::shared_ptr<AuthInitialize> m_authInitialize;
   std::unique_ptr<TypeRegistry> m_typeRegistry;
 
@@ -573,6 +573,38 @@ ClientMetadataService::getServerToFilterMapFESHOP(
   }
   return serverToKeysMap;
 }
+
+std::shared_ptr<ClientMetadataService::ServerToKeysMap>
+ClientMetadataService::getServerToBucketsMapFESHOP(
+    const BucketSet& buckets, const std::shared_ptr<Region>& region,
+    bool optimizeForWrite) {
+  auto cptr = getClientMetadata(region->getFullPath());
+
+  if (!cptr) {
+    enqueueForMetadataRefresh(region->getFullPath(), 0);
+    return nullptr;
+  }
+
+  const auto serverToBuckets =
+      groupByServerToBuckets(cptr, buckets, optimizeForWrite);
+
+  if (serverToBuckets == nullptr) {
+    return nullptr;
+  }
+
+  auto serverToKeysMap =
+      std::make_shared<ServerToKeysMap>(serverToBuckets->size());
+  for (const auto& serverToBucket : *serverToBuckets) {
+    auto bucketKeys = std::make_shared<CacheableHashSet>(
+        static_cast<int32_t>(serverToBucket.second->size()));
+    for (const auto& bucket : *serverToBucket.second) {
+      bucketKeys->insert(CacheableInt32::create(bucket));
+    }
+    serverToKeysMap->emplace(serverToBucket.first, bucketKeys);
+  }
+  return serverToKeysMap;
+}
+
 std::shared_ptr<BucketServerLocation> ClientMetadataService::findNextServer(
     const ClientMetadataService::ServerToBucketsMap& serverToBucketsMap,
     const ClientMetadataService::BucketSet& currentBucketSet) {
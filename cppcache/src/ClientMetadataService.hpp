@@ -191,6 +191,15 @@ class ClientMetadataService : public ACE_Task_Base,
       const std::shared_ptr<CacheableVector>& keySet,
       const std::shared_ptr<Region>& region, bool isPrimary);
 
+  /**
+   * The servers to execute a function on the given buckets of the region
+   * mapped to the ids of their buckets, nullptr if there is no metadata for
+   * the region.
+   */
+  std::shared_ptr<ServerToKeysMap> getServerToBucketsMapFESHOP(
+      const BucketSet& buckets, const std::shared_ptr<Region>& region,
+      bool optimizeForWrite);
+
   std::shared_ptr<ClientMetadataService::ServerToBucketsMap>
   groupByServerToAllBuckets(const std::shared_ptr<Region>& region,
                             bool optimizeForWrite);
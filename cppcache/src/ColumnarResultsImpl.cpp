@@ -0,0 +1,272 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarResultsImpl.hpp"
+
+#include <stdexcept>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+ColumnarResultsImpl::ColumnarResultsImpl(
+    const std::vector<std::string>& fieldNames)
+    : m_fieldNames(fieldNames), m_valueCount(0) {
+  if (m_fieldNames.empty()) {
+    m_fieldNames.emplace_back();
+  }
+  for (size_t i = 0; i < m_fieldNames.size(); i++) {
+    m_fieldNameIndexMap.emplace(m_fieldNames[i], i);
+  }
+  m_columns.resize(m_fieldNames.size());
+}
+
+size_t ColumnarResultsImpl::size() const {
+  return m_valueCount / m_columns.size();
+}
+
+size_t ColumnarResultsImpl::getColumnCount() const { return m_columns.size(); }
+
+const std::vector<std::string>& ColumnarResultsImpl::getFieldNames() const {
+  return m_fieldNames;
+}
+
+size_t ColumnarResultsImpl::getFieldIndex(const std::string& fieldName) const {
+  const auto& iter = m_fieldNameIndexMap.find(fieldName);
+  if (iter != m_fieldNameIndexMap.end()) {
+    return iter->second;
+  } else {
+    throw std::invalid_argument("fieldname not found");
+  }
+}
+
+ColumnType ColumnarResultsImpl::getColumnType(size_t column) const {
+  return getColumn(column).getType();
+}
+
+bool ColumnarResultsImpl::isNull(size_t row, size_t column) const {
+  return getColumn(column).isNull(row);
+}
+
+const std::vector<int64_t>& ColumnarResultsImpl::getInt64Column(
+    size_t column) const {
+  return getColumn(column).getInt64s();
+}
+
+const std::vector<double>& ColumnarResultsImpl::getDoubleColumn(
+    size_t column) const {
+  return getColumn(column).getDoubles();
+}
+
+const std::vector<std::string>& ColumnarResultsImpl::getStringColumn(
+    size_t column) const {
+  return getColumn(column).getStrings();
+}
+
+const std::vector<std::shared_ptr<Serializable>>&
+ColumnarResultsImpl::getObjectColumn(size_t column) const {
+  return getColumn(column).getObjects();
+}
+
+void ColumnarResultsImpl::appendNull() { nextColumn().appendNull(); }
+
+void ColumnarResultsImpl::appendInt64(int64_t value) {
+  nextColumn().appendInt64(value);
+}
+
+void ColumnarResultsImpl::appendDouble(double value) {
+  nextColumn().appendDouble(value);
+}
+
+void ColumnarResultsImpl::appendString(std::string value) {
+  nextColumn().appendString(std::move(value));
+}
+
+void ColumnarResultsImpl::appendObject(std::shared_ptr<Serializable> value) {
+  if (value == nullptr) {
+    appendNull();
+  } else if (auto v = std::dynamic_pointer_cast<CacheableInt64>(value)) {
+    appendInt64(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableInt32>(value)) {
+    appendInt64(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableInt16>(value)) {
+    appendInt64(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableByte>(value)) {
+    appendInt64(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableDouble>(value)) {
+    appendDouble(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableFloat>(value)) {
+    appendDouble(v->value());
+  } else if (auto v = std::dynamic_pointer_cast<CacheableString>(value)) {
+    appendString(v->value());
+  } else {
+    nextColumn().appendObject(std::move(value));
+  }
+}
+
+const ColumnarResultsImpl::Column& ColumnarResultsImpl::getColumn(
+    size_t column) const {
+  if (column >= m_columns.size()) {
+    throw std::out_of_range("ColumnarResults: column not found.");
+  }
+  return m_columns[column];
+}
+
+ColumnarResultsImpl::Column::Column()
+    : m_typed(false), m_type(ColumnType::OBJECT) {}
+
+void ColumnarResultsImpl::Column::appendNull() {
+  m_nulls.push_back(true);
+  switch (m_typed ? m_type : ColumnType::OBJECT) {
+    case ColumnType::INT64:
+      m_int64s.push_back(0);
+      break;
+    case ColumnType::DOUBLE:
+      m_doubles.push_back(0);
+      break;
+    case ColumnType::STRING:
+      m_strings.emplace_back();
+      break;
+    case ColumnType::OBJECT:
+      m_objects.push_back(nullptr);
+      break;
+  }
+}
+
+void ColumnarResultsImpl::Column::appendInt64(int64_t value) {
+  if (accept(ColumnType::INT64)) {
+    m_int64s.push_back(value);
+  } else {
+    m_objects.push_back(CacheableInt64::create(value));
+  }
+  m_nulls.push_back(false);
+}
+
+void ColumnarResultsImpl::Column::appendDouble(double value) {
+  if (accept(ColumnType::DOUBLE)) {
+    m_doubles.push_back(value);
+  } else {
+    m_objects.push_back(CacheableDouble::create(value));
+  }
+  m_nulls.push_back(false);
+}
+
+void ColumnarResultsImpl::Column::appendString(std::string value) {
+  if (accept(ColumnType::STRING)) {
+    m_strings.push_back(std::move(value));
+  } else {
+    m_objects.push_back(CacheableString::create(std::move(value)));
+  }
+  m_nulls.push_back(false);
+}
+
+void ColumnarResultsImpl::Column::appendObject(
+    std::shared_ptr<Serializable> value) {
+  accept(ColumnType::OBJECT);
+  m_objects.push_back(std::move(value));
+  m_nulls.push_back(false);
+}
+
+const std::vector<int64_t>& ColumnarResultsImpl::Column::getInt64s() const {
+  if (m_type != ColumnType::INT64) {
+    throw IllegalStateException("ColumnarResults: not an INT64 column.");
+  }
+  return m_int64s;
+}
+
+const std::vector<double>& ColumnarResultsImpl::Column::getDoubles() const {
+  if (m_type != ColumnType::DOUBLE) {
+    throw IllegalStateException("ColumnarResults: not a DOUBLE column.");
+  }
+  return m_doubles;
+}
+
+const std::vector<std::string>& ColumnarResultsImpl::Column::getStrings()
+    const {
+  if (m_type != ColumnType::STRING) {
+    throw IllegalStateException("ColumnarResults: not a STRING column.");
+  }
+  return m_strings;
+}
+
+const std::vector<std::shared_ptr<Serializable>>&
+ColumnarResultsImpl::Column::getObjects() const {
+  if (m_type != ColumnType::OBJECT) {
+    throw IllegalStateException("ColumnarResults: not an OBJECT column.");
+  }
+  return m_objects;
+}
+
+/**
+ * Prepares the column for a non-null value of the given type. Returns false
+ * if the value has to be added boxed to the OBJECT column instead.
+ */
+bool ColumnarResultsImpl::Column::accept(ColumnType type) {
+  if (!m_typed) {
+    // only nulls so far, which are held as nullptr objects until typed
+    m_typed = true;
+    m_type = type;
+    if (type != ColumnType::OBJECT) {
+      m_objects.clear();
+      m_objects.shrink_to_fit();
+      m_int64s.resize(type == ColumnType::INT64 ? m_nulls.size() : 0);
+      m_doubles.resize(type == ColumnType::DOUBLE ? m_nulls.size() : 0);
+      m_strings.resize(type == ColumnType::STRING ? m_nulls.size() : 0);
+    }
+    return true;
+  } else if (m_type == type) {
+    return true;
+  } else if (m_type != ColumnType::OBJECT) {
+    boxValues();
+  }
+  return false;
+}
+
+void ColumnarResultsImpl::Column::boxValues() {
+  m_objects.reserve(m_nulls.size() + 1);
+  for (size_t row = 0; row < m_nulls.size(); row++) {
+    if (m_nulls[row]) {
+      m_objects.push_back(nullptr);
+      continue;
+    }
+    switch (m_type) {
+      case ColumnType::INT64:
+        m_objects.push_back(CacheableInt64::create(m_int64s[row]));
+        break;
+      case ColumnType::DOUBLE:
+        m_objects.push_back(CacheableDouble::create(m_doubles[row]));
+        break;
+      case ColumnType::STRING:
+        m_objects.push_back(CacheableString::create(std::move(m_strings[row])));
+        break;
+      case ColumnType::OBJECT:
+        break;
+    }
+  }
+  m_type = ColumnType::OBJECT;
+  std::vector<int64_t>().swap(m_int64s);
+  std::vector<double>().swap(m_doubles);
+  std::vector<std::string>().swap(m_strings);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,143 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COLUMNARRESULTSIMPL_H_
+#define GEODE_COLUMNARRESULTSIMPL_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <geode/ColumnarResults.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * ColumnarResults built up value by value in the row-major order in which
+ * the server sends the fields of the result structs.
+ */
+class APACHE_GEODE_EXPORT ColumnarResultsImpl : public ColumnarResults {
+ public:
+  /**
+   * @param fieldNames the field names of the result structs, or empty for
+   * results that are not structs.
+   */
+  explicit ColumnarResultsImpl(const std::vector<std::string>& fieldNames);
+
+  ~ColumnarResultsImpl() noexcept override = default;
+
+  size_t size() const override;
+
+  size_t getColumnCount() const override;
+
+  const std::vector<std::string>& getFieldNames() const override;
+
+  size_t getFieldIndex(const std::string& fieldName) const override;
+
+  ColumnType getColumnType(size_t column) const override;
+
+  bool isNull(size_t row, size_t column) const override;
+
+  const std::vector<int64_t>& getInt64Column(size_t column) const override;
+
+  const std::vector<double>& getDoubleColumn(size_t column) const override;
+
+  const std::vector<std::string>& getStringColumn(
+      size_t column) const override;
+
+  const std::vector<std::shared_ptr<Serializable>>& getObjectColumn(
+      size_t column) const override;
+
+  /** total number of values added so far, across all columns */
+  inline size_t getValueCount() const { return m_valueCount; }
+
+  /** whether the values added so far make up complete rows */
+  inline bool isComplete() const {
+    return m_valueCount % m_columns.size() == 0;
+  }
+
+  void appendNull();
+
+  void appendInt64(int64_t value);
+
+  void appendDouble(double value);
+
+  void appendString(std::string value);
+
+  /**
+   * Add a deserialized value, unboxing the primitive and string Cacheables
+   * into their typed column.
+   */
+  void appendObject(std::shared_ptr<Serializable> value);
+
+ private:
+  class Column {
+   public:
+    Column();
+
+    inline ColumnType getType() const { return m_type; }
+    inline size_t size() const { return m_nulls.size(); }
+    inline bool isNull(size_t row) const { return m_nulls.at(row); }
+
+    void appendNull();
+    void appendInt64(int64_t value);
+    void appendDouble(double value);
+    void appendString(std::string value);
+    void appendObject(std::shared_ptr<Serializable> value);
+
+    const std::vector<int64_t>& getInt64s() const;
+    const std::vector<double>& getDoubles() const;
+    const std::vector<std::string>& getStrings() const;
+    const std::vector<std::shared_ptr<Serializable>>& getObjects() const;
+
+   private:
+    // the column type is decided by the first non-null value
+    bool m_typed;
+    ColumnType m_type;
+    std::vector<bool> m_nulls;
+    std::vector<int64_t> m_int64s;
+    std::vector<double> m_doubles;
+    std::vector<std::string> m_strings;
+    std::vector<std::shared_ptr<Serializable>> m_objects;
+
+    bool accept(ColumnType type);
+    void boxValues();
+  };
+
+  std::vector<std::string> m_fieldNames;
+  std::unordered_map<std::string, size_t> m_fieldNameIndexMap;
+  std::vector<Column> m_columns;
+  size_t m_valueCount;
+
+  inline Column& nextColumn() {
+    return m_columns[m_valueCount++ % m_columns.size()];
+  }
+
+  const Column& getColumn(size_t column) const;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COLUMNARRESULTSIMPL_H_
@@ -0,0 +1,120 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeadlineExecution.hpp"
+
+#include <algorithm>
+#include <map>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "util/Log.hpp"
+#include "util/exception.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+ServerResultBuffer::ServerResultBuffer(bool serializedResults)
+    : m_serializedResults(serializedResults),
+      m_results(CacheableVector::create()) {}
+
+std::shared_ptr<CacheableVector> ServerResultBuffer::getResult(
+    std::chrono::milliseconds) {
+  return m_results;
+}
+
+void ServerResultBuffer::addResult(const std::shared_ptr<Cacheable>& result) {
+  m_results->push_back(result);
+}
+
+void ServerResultBuffer::endResults() {}
+
+void ServerResultBuffer::clearResults() { m_results->clear(); }
+
+bool ServerResultBuffer::isSerializedResults() const {
+  return m_serializedResults;
+}
+
+DeadlineExecution::DeadlineExecution(std::chrono::milliseconds timeout,
+                                     std::shared_ptr<ResultCollector> rc)
+    : m_deadline(std::chrono::steady_clock::now() + timeout),
+      m_rc(std::move(rc)) {}
+
+std::chrono::milliseconds DeadlineExecution::getRemaining() const {
+  auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      m_deadline - std::chrono::steady_clock::now());
+  return std::max(remaining, std::chrono::milliseconds(1));
+}
+
+std::shared_ptr<ServerResultBuffer> DeadlineExecution::createBuffer() const {
+  return std::make_shared<ServerResultBuffer>(m_rc != nullptr &&
+                                              m_rc->isSerializedResults());
+}
+
+void DeadlineExecution::add(std::shared_ptr<ServerFunctionExecution> execution,
+                            std::shared_ptr<ServerResultBuffer> buffer) {
+  m_executions.emplace_back(std::move(execution), std::move(buffer));
+}
+
+PartialExecutionResult DeadlineExecution::await() {
+  std::vector<std::string> timedOutServers;
+  std::map<std::string, std::string> failedServers;
+
+  for (const auto& entry : m_executions) {
+    const auto& execution = entry.first;
+    GfErrType err = GF_NOERR;
+    if (!execution->getResult(err, m_deadline)) {
+      LOGDEBUG("DeadlineExecution::await: no reply from %s by the deadline",
+               execution->getServer().c_str());
+      timedOutServers.push_back(execution->getServer());
+      execution->abandon(execution);
+      continue;
+    }
+    if (err == GF_TIMOUT || err == GF_CLIENT_WAIT_TIMEOUT) {
+      timedOutServers.push_back(execution->getServer());
+      continue;
+    }
+    auto failure = execution->getFailure(err);
+    if (!failure.empty()) {
+      LOGDEBUG("DeadlineExecution::await: execution on %s failed: %s",
+               execution->getServer().c_str(), failure.c_str());
+      failedServers.emplace(execution->getServer(), std::move(failure));
+      continue;
+    }
+    for (const auto& result : *entry.second->getResult()) {
+      m_rc->addResult(result);
+    }
+  }
+  m_executions.clear();
+
+  return PartialExecutionResult(m_rc, std::move(timedOutServers),
+                                std::move(failedServers));
+}
+
+std::string DeadlineExecution::describe(GfErrType err) {
+  try {
+    GfErrTypeToException("Execute", err);
+  } catch (const Exception& exception) {
+    return exception.getName() + ": " + exception.what();
+  }
+  return "";
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,131 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_DEADLINEEXECUTION_H_
+#define GEODE_DEADLINEEXECUTION_H_
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geode/PartialExecutionResult.hpp>
+#include <geode/ResultCollector.hpp>
+
+#include "ErrType.hpp"
+#include "ThreadPool.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * The execution of a function on a single server, run by the thread pool.
+ */
+class ServerFunctionExecution : public PooledWork<GfErrType> {
+ public:
+  ~ServerFunctionExecution() override = default;
+
+  /** the endpoint the function is executed on */
+  virtual std::string getServer() = 0;
+
+  /**
+   * The error the execution failed with given the result of execute, empty
+   * if the execution succeeded.
+   */
+  virtual std::string getFailure(GfErrType err) = 0;
+};
+
+/**
+ * Holds the results of the function execution on one server until the
+ * server has completed in time.
+ */
+class ServerResultBuffer : public ResultCollector {
+ public:
+  explicit ServerResultBuffer(bool serializedResults);
+  ~ServerResultBuffer() noexcept override = default;
+
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+  void addResult(const std::shared_ptr<Cacheable>& result) override;
+  void endResults() override;
+  void clearResults() override;
+  bool isSerializedResults() const override;
+
+ private:
+  const bool m_serializedResults;
+  std::shared_ptr<CacheableVector> m_results;
+};
+
+/**
+ * Collects the results of a function executed in parallel on several servers
+ * until a deadline. Each server gets its own ServerResultBuffer and a request
+ * timeout that ends at the deadline; the results of a server are added to
+ * the result collector only once it completed in time without error. The
+ * executions still pending at the deadline are abandoned, so that those not
+ * yet started do not occupy a pool thread.
+ */
+class DeadlineExecution {
+ public:
+  DeadlineExecution(std::chrono::milliseconds timeout,
+                    std::shared_ptr<ResultCollector> rc);
+
+  DeadlineExecution(const DeadlineExecution&) = delete;
+  DeadlineExecution& operator=(const DeadlineExecution&) = delete;
+
+  /**
+   * The time left until the deadline, at least one millisecond so that it can
+   * be used as a request timeout.
+   */
+  std::chrono::milliseconds getRemaining() const;
+
+  /** a buffer for the results of the execution on one server */
+  std::shared_ptr<ServerResultBuffer> createBuffer() const;
+
+  /**
+   * Adds the execution on one server, which must have been given to the
+   * thread pool already.
+   */
+  void add(std::shared_ptr<ServerFunctionExecution> execution,
+           std::shared_ptr<ServerResultBuffer> buffer);
+
+  /**
+   * Waits for the executions until the deadline, adding the results of the
+   * servers that completed to the result collector.
+   */
+  PartialExecutionResult await();
+
+  /** the description of an error, as the message of its exception */
+  static std::string describe(GfErrType err);
+
+ private:
+  const std::chrono::steady_clock::time_point m_deadline;
+  const std::shared_ptr<ResultCollector> m_rc;
+  std::vector<std::pair<std::shared_ptr<ServerFunctionExecution>,
+                        std::shared_ptr<ServerResultBuffer>>>
+      m_executions;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_DEADLINEEXECUTION_H_
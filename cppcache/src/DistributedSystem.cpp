@@ -81,6 +81,10 @@ DistributedSystem DistributedSystem::create(
   } else {
     Log::setLogLevel(systemProperties->logLevel());
   }
+  if (systemProperties->logQueueSize() > 0) {
+    Log::startAsync(systemProperties->logQueueSize(),
+                    systemProperties->logQueueDropWhenFull());
+  }
 
   try {
     CppCacheLibrary::getProductDir();
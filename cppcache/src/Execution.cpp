@@ -59,6 +59,17 @@ std::shared_ptr<ResultCollector> Execution::execute(
   return impl_->execute(routingObj, args, rs, func, timeout);
 }
 
+PartialExecutionResult Execution::executeWithDeadline(
+    const std::string& func, std::chrono::milliseconds timeout) {
+  return impl_->executeWithDeadline(func, timeout);
+}
+
+std::shared_ptr<StreamingResultCollector> Execution::executeStreaming(
+    const std::string& func, size_t capacity,
+    std::chrono::milliseconds timeout) {
+  return impl_->executeStreaming(func, capacity, timeout);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
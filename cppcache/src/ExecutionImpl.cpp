@@ -23,7 +23,10 @@
 #include <geode/ExceptionTypes.hpp>
 #include <geode/internal/geode_globals.hpp>
 
+#include "DeadlineExecution.hpp"
 #include "NoResult.hpp"
+#include "PreparedFunction.hpp"
+#include "StreamingResultCollectorImpl.hpp"
 #include "ThinClientPoolDM.hpp"
 #include "ThinClientRegion.hpp"
 #include "UserAttributes.hpp"
@@ -33,8 +36,6 @@ namespace apache {
 namespace geode {
 namespace client {
 
-FunctionToFunctionAttributes ExecutionImpl::m_func_attrs;
-std::recursive_mutex ExecutionImpl::m_func_attrs_lock;
 Execution ExecutionImpl::withFilter(
     std::shared_ptr<CacheableVector> routingObj) {
   if (routingObj == nullptr) {
@@ -72,13 +73,36 @@ Execution ExecutionImpl::withCollector(std::shared_ptr<ResultCollector> rs) {
                         m_authenticatedView)));
 }
 
-std::vector<int8_t>* ExecutionImpl::getFunctionAttributes(
+std::shared_ptr<PreparedFunction> ExecutionImpl::getPreparedFunction(
     const std::string& func) {
-  auto&& itr = m_func_attrs.find(func);
-  if (itr != m_func_attrs.end()) {
-    return itr->second;
+  auto tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get());
+  if (tcrdm == nullptr) {
+    throw IllegalArgumentException(
+        "Execute: pool cast to ThinClientPoolDM failed");
   }
-  return nullptr;
+  auto prepared = tcrdm->getPreparedFunction(func);
+  if (prepared == nullptr) {
+    std::vector<int8_t>* attr = nullptr;
+    GfErrType err = GF_NOERR;
+    if (m_region != nullptr) {
+      err = dynamic_cast<ThinClientRegion*>(m_region.get())
+                ->getFuncAttributes(func, &attr);
+    } else {
+      err = getFuncAttributes(func, &attr);
+    }
+    std::unique_ptr<std::vector<int8_t>> attributes(attr);
+    if (err != GF_NOERR) {
+      GfErrTypeToException("Execute::GET_FUNCTION_ATTRIBUTES", err);
+    }
+    if (attributes == nullptr) {
+      throw MessageException(
+          "Execute::GET_FUNCTION_ATTRIBUTES: no attributes for function " +
+          func);
+    }
+    prepared = tcrdm->addPreparedFunction(std::make_shared<PreparedFunction>(
+        func, PreparedFunction::toFlags(*attributes)));
+  }
+  return prepared;
 }
 
 std::shared_ptr<ResultCollector> ExecutionImpl::execute(
@@ -100,41 +124,16 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
     LOGDEBUG("ExecutionImpl::execute function on authenticated cache");
     gua.setAuthenticatedView(m_authenticatedView);
   }
-  bool serverHasResult = false;
-  bool serverIsHA = false;
-  bool serverOptimizeForWrite = false;
-
-  auto&& attr = getFunctionAttributes(func);
-  {
-    if (attr == nullptr) {
-      std::lock_guard<decltype(m_func_attrs_lock)> _guard(m_func_attrs_lock);
-      GfErrType err = GF_NOERR;
-      attr = getFunctionAttributes(func);
-      if (attr == nullptr) {
-        if (m_region != nullptr) {
-          err = dynamic_cast<ThinClientRegion*>(m_region.get())
-                    ->getFuncAttributes(func, &attr);
-        } else if (m_pool != nullptr) {
-          err = getFuncAttributes(func, &attr);
-        }
-        if (err != GF_NOERR) {
-          GfErrTypeToException("Execute::GET_FUNCTION_ATTRIBUTES", err);
-        }
-        if (!attr->empty() && err == GF_NOERR) {
-          m_func_attrs[func] = attr;
-        }
-      }
-    }
-  }
-  serverHasResult = ((attr->at(0) == 1) ? true : false);
-  serverIsHA = ((attr->at(1) == 1) ? true : false);
-  serverOptimizeForWrite = ((attr->at(2) == 1) ? true : false);
+  auto prepared = getPreparedFunction(func);
+  const bool serverHasResult = prepared->hasResult();
+  const uint8_t isHAHasResultOptimizeForWrite = prepared->getFlags();
 
   LOGDEBUG(
       "ExecutionImpl::execute got functionAttributes from srver for function = "
       "%s serverHasResult = %d "
       " serverIsHA = %d serverOptimizeForWrite = %d ",
-      func.c_str(), serverHasResult, serverIsHA, serverOptimizeForWrite);
+      func.c_str(), serverHasResult, prepared->isHA(),
+      prepared->isOptimizeForWrite());
 
   if (serverHasResult == false) {
     m_rc = std::make_shared<NoResult>();
@@ -142,19 +141,6 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
     m_rc = std::make_shared<DefaultResultCollector>();
   }
 
-  uint8_t isHAHasResultOptimizeForWrite = 0;
-  if (serverIsHA) {
-    isHAHasResultOptimizeForWrite = isHAHasResultOptimizeForWrite | 1;
-  }
-
-  if (serverHasResult) {
-    isHAHasResultOptimizeForWrite = isHAHasResultOptimizeForWrite | 2;
-  }
-
-  if (serverOptimizeForWrite) {
-    isHAHasResultOptimizeForWrite = isHAHasResultOptimizeForWrite | 4;
-  }
-
   LOGDEBUG("ExecutionImpl::execute: isHAHasResultOptimizeForWrite = %d",
            isHAHasResultOptimizeForWrite);
   TXState* txState = TSSTXStateWrapper::s_geodeTSSTXState->getTXState();
@@ -183,48 +169,38 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
           txState == nullptr) {  // For transactions we should not create
                                  // multiple threads
         LOGDEBUG("ExecutionImpl::execute: m_routingObj is empty");
-        auto serverToBucketsMap = cms->groupByServerToAllBuckets(
-            m_region,
-            /*serverOptimizeForWrite*/ (isHAHasResultOptimizeForWrite & 4) ==
-                4);
-        if (!serverToBucketsMap || serverToBucketsMap->empty()) {
+        auto serverToKeysMap =
+            getServerToBucketsMap(*cms, prepared->isOptimizeForWrite());
+        if (!serverToKeysMap) {
           LOGDEBUG(
               "ExecutionImpl::execute: m_routingObj is empty and locationMap "
               "is also empty so use old FE onRegion");
           std::dynamic_pointer_cast<ThinClientRegion>(m_region)
               ->executeFunction(
-                  func, m_args, m_routingObj, isHAHasResultOptimizeForWrite,
-                  m_rc, (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
+                  *prepared, m_args, m_routingObj,
+                  isHAHasResultOptimizeForWrite, m_rc,
+                  (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
                   timeout);
           cms->enqueueForMetadataRefresh(m_region->getFullPath(), 0);
         } else {
-          // convert server to bucket map to server to key map where bucket id
-          // is key.
-          auto serverToKeysMap =
-              std::make_shared<ClientMetadataService::ServerToKeysMap>(
-                  serverToBucketsMap->size());
-          for (const auto& entry : *serverToBucketsMap) {
-            auto keys = std::make_shared<CacheableHashSet>(
-                static_cast<int32_t>(entry.second->size()));
-            for (const auto& bucket : *(entry.second)) {
-              keys->insert(CacheableInt32::create(bucket));
-            }
-            serverToKeysMap->emplace(entry.first, keys);
-          }
           LOGDEBUG(
               "ExecutionImpl::execute: withoutFilter and locationMap is not "
               "empty");
           bool reExecute = std::dynamic_pointer_cast<ThinClientRegion>(m_region)
                                ->executeFunctionSH(
-                                   func, m_args, isHAHasResultOptimizeForWrite,
-                                   m_rc, serverToKeysMap, failedNodes, timeout,
-                                   /*allBuckets*/ true);
+                                   *prepared, m_args,
+                                   isHAHasResultOptimizeForWrite, m_rc,
+                                   serverToKeysMap, failedNodes,
+                                   (isHAHasResultOptimizeForWrite & 1)
+                                       ? retryAttempts
+                                       : 0,
+                                   timeout, /*allBuckets*/ true);
           if (reExecute) {  // Fallback to old FE onREgion
             if (isHAHasResultOptimizeForWrite & 1) {  // isHA = true
               m_rc->clearResults();
               auto rs =
                   std::dynamic_pointer_cast<ThinClientRegion>(m_region)
-                      ->reExecuteFunction(func, m_args, m_routingObj,
+                      ->reExecuteFunction(*prepared, m_args, m_routingObj,
                                           isHAHasResultOptimizeForWrite, m_rc,
                                           (isHAHasResultOptimizeForWrite & 1)
                                               ? retryAttempts
@@ -234,8 +210,8 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
               m_rc->clearResults();
               dynamic_cast<ThinClientRegion*>(m_region.get())
                   ->executeFunction(
-                      func, m_args, m_routingObj, isHAHasResultOptimizeForWrite,
-                      m_rc,
+                      *prepared, m_args, m_routingObj,
+                      isHAHasResultOptimizeForWrite, m_rc,
                       (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
                       timeout);
             }
@@ -245,8 +221,8 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
         LOGDEBUG("executeFunction onRegion WithFilter size equal to 1 ");
         dynamic_cast<ThinClientRegion*>(m_region.get())
             ->executeFunction(
-                func, m_args, m_routingObj, isHAHasResultOptimizeForWrite, m_rc,
-                (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
+                *prepared, m_args, m_routingObj, isHAHasResultOptimizeForWrite,
+                m_rc, (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
                 timeout);
       } else {
         if (txState == nullptr) {
@@ -259,8 +235,8 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
                 "so use old FE onRegion");
             dynamic_cast<ThinClientRegion*>(m_region.get())
                 ->executeFunction(
-                    func, m_args, m_routingObj, isHAHasResultOptimizeForWrite,
-                    m_rc,
+                    *prepared, m_args, m_routingObj,
+                    isHAHasResultOptimizeForWrite, m_rc,
                     (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
                     timeout);
             cms->enqueueForMetadataRefresh(m_region->getFullPath(), 0);
@@ -270,16 +246,19 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
                 "empty");
             bool reExecute =
                 dynamic_cast<ThinClientRegion*>(m_region.get())
-                    ->executeFunctionSH(func, m_args,
+                    ->executeFunctionSH(*prepared, m_args,
                                         isHAHasResultOptimizeForWrite, m_rc,
-                                        serverToKeysMap, failedNodes, timeout,
-                                        /*allBuckets*/ false);
+                                        serverToKeysMap, failedNodes,
+                                        (isHAHasResultOptimizeForWrite & 1)
+                                            ? retryAttempts
+                                            : 0,
+                                        timeout, /*allBuckets*/ false);
             if (reExecute) {  // Fallback to old FE onREgion
               if (isHAHasResultOptimizeForWrite & 1) {  // isHA = true
                 m_rc->clearResults();
                 auto rs =
                     dynamic_cast<ThinClientRegion*>(m_region.get())
-                        ->reExecuteFunction(func, m_args, m_routingObj,
+                        ->reExecuteFunction(*prepared, m_args, m_routingObj,
                                             isHAHasResultOptimizeForWrite, m_rc,
                                             (isHAHasResultOptimizeForWrite & 1)
                                                 ? retryAttempts
@@ -289,7 +268,7 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
                 m_rc->clearResults();
                 dynamic_cast<ThinClientRegion*>(m_region.get())
                     ->executeFunction(
-                        func, m_args, m_routingObj,
+                        *prepared, m_args, m_routingObj,
                         isHAHasResultOptimizeForWrite, m_rc,
                         (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
                         timeout);
@@ -299,16 +278,18 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
         } else {  // For transactions use old way
           dynamic_cast<ThinClientRegion*>(m_region.get())
               ->executeFunction(
-                  func, m_args, m_routingObj, isHAHasResultOptimizeForWrite,
-                  m_rc, (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
+                  *prepared, m_args, m_routingObj,
+                  isHAHasResultOptimizeForWrite, m_rc,
+                  (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
                   timeout);
         }
       }
     } else {  // w/o single hop, Fallback to old FE onREgion
       dynamic_cast<ThinClientRegion*>(m_region.get())
           ->executeFunction(
-              func, m_args, m_routingObj, isHAHasResultOptimizeForWrite, m_rc,
-              (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0, timeout);
+              *prepared, m_args, m_routingObj, isHAHasResultOptimizeForWrite,
+              m_rc, (isHAHasResultOptimizeForWrite & 1) ? retryAttempts : 0,
+              timeout);
     }
     /*    } catch (TransactionDataNodeHasDepartedException e) {
                     if(txState == nullptr)
@@ -344,7 +325,7 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
     }
     if (m_allServer == false) {
       executeOnPool(
-          func, isHAHasResultOptimizeForWrite,
+          *prepared, isHAHasResultOptimizeForWrite,
           (isHAHasResultOptimizeForWrite & 1) ? m_pool->getRetryAttempts() : 0,
           timeout);
       if (serverHasResult == true) {
@@ -353,13 +334,155 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
       }
       return m_rc;
     }
-    executeOnAllServers(func, isHAHasResultOptimizeForWrite, timeout);
+    executeOnAllServers(*prepared, isHAHasResultOptimizeForWrite, timeout);
   } else {
     throw IllegalStateException("Execution::execute: should not be here");
   }
   return m_rc;
 }
 
+PartialExecutionResult ExecutionImpl::executeWithDeadline(
+    const std::string& func, std::chrono::milliseconds timeout) {
+  LOGDEBUG("ExecutionImpl::executeWithDeadline: ");
+  GuardUserAttributes gua;
+  if (m_authenticatedView != nullptr) {
+    gua.setAuthenticatedView(m_authenticatedView);
+  }
+  if (TSSTXStateWrapper::s_geodeTSSTXState->getTXState() != nullptr) {
+    throw UnsupportedOperationException(
+        "Execution::executeWithDeadline: Transaction function execution is "
+        "not supported");
+  }
+  auto tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get());
+  if (tcrdm == nullptr) {
+    throw IllegalArgumentException(
+        "Execute: pool cast to ThinClientPoolDM failed");
+  }
+  auto prepared = getPreparedFunction(func);
+
+  std::shared_ptr<ClientMetadataService::ServerToKeysMap> serverToKeysMap;
+  const bool allBuckets = !m_routingObj || m_routingObj->empty();
+  if (m_region != nullptr && m_pool->getPRSingleHopEnabled()) {
+    auto cms = tcrdm->getClientMetaDataService();
+    if (allBuckets) {
+      serverToKeysMap =
+          getServerToBucketsMap(*cms, prepared->isOptimizeForWrite());
+    } else {
+      serverToKeysMap = cms->getServerToFilterMapFESHOP(
+          m_routingObj, m_region, prepared->isOptimizeForWrite());
+    }
+    if (!serverToKeysMap || serverToKeysMap->empty()) {
+      cms->enqueueForMetadataRefresh(m_region->getFullPath(), 0);
+      serverToKeysMap = nullptr;
+    }
+  }
+
+  if ((m_region != nullptr && !serverToKeysMap) ||
+      (m_region == nullptr && !m_allServer)) {
+    // the servers are not known, so the timeout bounds the whole execution
+    LOGDEBUG(
+        "ExecutionImpl::executeWithDeadline: no servers to wait for, use "
+        "execute");
+    return PartialExecutionResult(execute(func, timeout), {}, {});
+  }
+
+  if (!prepared->hasResult()) {
+    m_rc = std::make_shared<NoResult>();
+  } else if (m_rc == nullptr) {
+    m_rc = std::make_shared<DefaultResultCollector>();
+  }
+
+  DeadlineExecution execution(timeout, m_rc);
+  if (m_region != nullptr) {
+    dynamic_cast<ThinClientRegion*>(m_region.get())
+        ->executeFunctionSH(*prepared, m_args, prepared->getFlags(),
+                            serverToKeysMap, execution, allBuckets);
+  } else {
+    auto err = tcrdm->sendRequestToAllServers(*prepared, prepared->getFlags(),
+                                              m_args, execution);
+    if (err != GF_NOERR) {
+      LOGDEBUG("ExecutionImpl::executeWithDeadline errorred: %d", err);
+      throw FunctionExecutionException(
+          "Execute: failed to execute function on servers.");
+    }
+  }
+
+  auto result = execution.await();
+  if (prepared->hasResult()) {
+    m_rc->endResults();
+  }
+  if (m_region != nullptr && !result.isComplete()) {
+    tcrdm->getClientMetaDataService()->enqueueForMetadataRefresh(
+        m_region->getFullPath(), 0);
+  }
+  return result;
+}
+
+std::shared_ptr<ClientMetadataService::ServerToKeysMap>
+ExecutionImpl::getServerToBucketsMap(ClientMetadataService& cms,
+                                     bool optimizeForWrite) {
+  auto serverToBucketsMap =
+      cms.groupByServerToAllBuckets(m_region, optimizeForWrite);
+  if (!serverToBucketsMap || serverToBucketsMap->empty()) {
+    return nullptr;
+  }
+  // convert server to bucket map to server to key map where bucket id is key.
+  auto serverToKeysMap =
+      std::make_shared<ClientMetadataService::ServerToKeysMap>(
+          serverToBucketsMap->size());
+  for (const auto& entry : *serverToBucketsMap) {
+    auto keys = std::make_shared<CacheableHashSet>(
+        static_cast<int32_t>(entry.second->size()));
+    for (const auto& bucket : *(entry.second)) {
+      keys->insert(CacheableInt32::create(bucket));
+    }
+    serverToKeysMap->emplace(entry.first, keys);
+  }
+  return serverToKeysMap;
+}
+
+std::shared_ptr<StreamingResultCollector> ExecutionImpl::executeStreaming(
+    const std::string& func, size_t capacity,
+    std::chrono::milliseconds timeout) {
+  if (capacity == 0) {
+    throw IllegalArgumentException(
+        "Execution::executeStreaming: capacity must be greater than zero");
+  }
+  if (TSSTXStateWrapper::s_geodeTSSTXState->getTXState() != nullptr) {
+    throw UnsupportedOperationException(
+        "Execution::executeStreaming: Transaction function execution is not "
+        "supported");
+  }
+  auto tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get());
+  if (tcrdm == nullptr) {
+    throw IllegalArgumentException(
+        "Execute: pool cast to ThinClientPoolDM failed");
+  }
+  // Results are added by the thread handling the response chunks, which the
+  // collector blocks for backpressure; that thread can only be blocked when
+  // it is not the shared chunk handler thread (see RemoteQueryCursor).
+  bool bounded = !tcrdm->getConnectionManager()
+                      .getCacheImpl()
+                      ->getDistributedSystem()
+                      .getSystemProperties()
+                      .enableChunkHandlerThread();
+  auto collector =
+      std::make_shared<StreamingResultCollectorImpl>(capacity, bounded);
+
+  auto routingObj = m_routingObj;
+  auto args = m_args;
+  auto region = m_region;
+  auto allServer = m_allServer;
+  auto pool = m_pool;
+  auto authenticatedView = m_authenticatedView;
+  collector->start([=](const std::shared_ptr<ResultCollector>& rc) {
+    ExecutionImpl execution(routingObj, args, rc, region, allServer, pool,
+                            authenticatedView);
+    execution.execute(func, timeout);
+  });
+  return collector;
+}
+
 GfErrType ExecutionImpl::getFuncAttributes(const std::string& func,
                                            std::vector<int8_t>** attr) {
   ThinClientPoolDM* tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get());
@@ -413,7 +536,7 @@ void ExecutionImpl::addResults(
   }
 }
 
-void ExecutionImpl::executeOnAllServers(const std::string& func,
+void ExecutionImpl::executeOnAllServers(const PreparedFunction& func,
                                         uint8_t getResult,
                                         std::chrono::milliseconds timeout) {
   ThinClientPoolDM* tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get());
@@ -423,7 +546,7 @@ void ExecutionImpl::executeOnAllServers(const std::string& func,
   }
   std::shared_ptr<CacheableString> exceptionPtr = nullptr;
   GfErrType err = tcrdm->sendRequestToAllServers(
-      func.c_str(), getResult, timeout, m_args, m_rc, exceptionPtr);
+      func, getResult, timeout, m_args, m_rc, exceptionPtr);
   if (exceptionPtr != nullptr && err != GF_NOERR) {
     LOGDEBUG("Execute errorred: %d", err);
     // throw FunctionExecutionException( "Execute: failed to execute function
@@ -455,7 +578,7 @@ void ExecutionImpl::executeOnAllServers(const std::string& func,
   }
 }
 std::shared_ptr<CacheableVector> ExecutionImpl::executeOnPool(
-    const std::string& func, uint8_t getResult, int32_t retryAttempts,
+    const PreparedFunction& func, uint8_t getResult, int32_t retryAttempts,
     std::chrono::milliseconds timeout) {
   ThinClientPoolDM* tcrdm = dynamic_cast<ThinClientPoolDM*>(m_pool.get());
   if (tcrdm == nullptr) {
@@ -487,11 +610,10 @@ std::shared_ptr<CacheableVector> ExecutionImpl::executeOnPool(
   }
 
   while (attempt <= retryAttempts) {
-    std::string funcName(func);
     TcrMessageExecuteFunction msg(
         new DataOutput(
             tcrdm->getConnectionManager().getCacheImpl()->createDataOutput()),
-        funcName, m_args, getResult, tcrdm, timeout);
+        func, m_args, getResult, tcrdm, timeout);
     TcrMessageReply reply(true, tcrdm);
     ChunkedFunctionExecutionResponse* resultCollector(
         new ChunkedFunctionExecutionResponse(reply, (getResult & 2) == 2,
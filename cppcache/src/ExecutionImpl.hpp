@@ -20,23 +20,26 @@
 #ifndef GEODE_EXECUTIONIMPL_H_
 #define GEODE_EXECUTIONIMPL_H_
 
-#include <map>
-#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <geode/AuthenticatedView.hpp>
 #include <geode/CacheableBuiltins.hpp>
 #include <geode/Execution.hpp>
+#include <geode/PartialExecutionResult.hpp>
 #include <geode/Region.hpp>
 #include <geode/ResultCollector.hpp>
+#include <geode/StreamingResultCollector.hpp>
 
+#include "ClientMetadataService.hpp"
 #include "ErrType.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
-typedef std::map<std::string, std::vector<int8_t>*>
-    FunctionToFunctionAttributes;
+class PreparedFunction;
 
 class ExecutionImpl {
  public:
@@ -75,6 +78,13 @@ class ExecutionImpl {
       const std::string& func,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
 
+  virtual PartialExecutionResult executeWithDeadline(
+      const std::string& func, std::chrono::milliseconds timeout);
+
+  virtual std::shared_ptr<StreamingResultCollector> executeStreaming(
+      const std::string& func, size_t capacity,
+      std::chrono::milliseconds timeout);
+
   static void addResults(std::shared_ptr<ResultCollector>& collector,
                          const std::shared_ptr<CacheableVector>& results);
 
@@ -107,19 +117,28 @@ class ExecutionImpl {
   bool m_allServer;
   std::shared_ptr<Pool> m_pool;
   AuthenticatedView* m_authenticatedView;
-  static std::recursive_mutex m_func_attrs_lock;
-  static FunctionToFunctionAttributes m_func_attrs;
-  //  std::vector<int8_t> m_attributes;
 
   std::shared_ptr<CacheableVector> executeOnPool(
-      const std::string& func, uint8_t getResult, int32_t retryAttempts,
+      const PreparedFunction& func, uint8_t getResult, int32_t retryAttempts,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
 
   void executeOnAllServers(
-      const std::string& func, uint8_t getResult,
+      const PreparedFunction& func, uint8_t getResult,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
 
-  std::vector<int8_t>* getFunctionAttributes(const std::string& func);
+  /**
+   * the function cached by the pool, fetching its attributes from a server
+   * on first use
+   */
+  std::shared_ptr<PreparedFunction> getPreparedFunction(
+      const std::string& func);
+
+  /**
+   * the servers holding the buckets of the region mapped to the ids of those
+   * buckets, nullptr if there is no metadata for the region yet
+   */
+  std::shared_ptr<ClientMetadataService::ServerToKeysMap> getServerToBucketsMap(
+      ClientMetadataService& cms, bool optimizeForWrite);
   GfErrType getFuncAttributes(const std::string& func,
                               std::vector<int8_t>** attr);
 };
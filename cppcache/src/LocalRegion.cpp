@@ -316,7 +316,7 @@ std::shared_ptr<Cacheable> LocalRegion::get(
   int64_t sampleStartNanos = startStatOpTime();
   GfErrType err = getNoThrow(key, rptr, aCallbackArgument);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetTimeId(),
-                   sampleStartNanos);
+                   m_regionStats->getGetLatencyId(), sampleStartNanos);
 
   // rptr = handleReplay(err, rptr);
 
@@ -334,7 +334,7 @@ void LocalRegion::put(const std::shared_ptr<CacheableKey>& key,
   GfErrType err = putNoThrow(key, value, aCallbackArgument, oldValue, -1,
                              CacheEventFlags::NORMAL, versionTag);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
-                   sampleStartNanos);
+                   m_regionStats->getPutLatencyId(), sampleStartNanos);
   //  handleReplay(err, nullptr);
   GfErrTypeToException("Region::put", err);
 }
@@ -3153,6 +3153,12 @@ void LocalRegion::updateStatOpTime(Statistics* statistics, int32_t statId,
     Utils::updateStatOpTime(statistics, statId, start);
   }
 }
+void LocalRegion::updateStatOpTime(Statistics* statistics, int32_t statId,
+                                   int32_t histogramId, int64_t start) {
+  if (m_enableTimeStatistics) {
+    Utils::updateStatOpTime(statistics, statId, histogramId, start);
+  }
+}
 
 void LocalRegion::acquireGlobals(bool) {}
 
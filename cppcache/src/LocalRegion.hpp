@@ -504,6 +504,8 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
   int64_t startStatOpTime();
   void updateStatOpTime(Statistics* m_regionStats, int32_t statId,
                         int64_t start);
+  void updateStatOpTime(Statistics* m_regionStats, int32_t statId,
+                        int32_t histogramId, int64_t start);
 
   /* protected attributes */
   std::string m_name;
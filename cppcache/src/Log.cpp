@@ -18,9 +18,11 @@
 #include "util/Log.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <cinttypes>
+#include <condition_variable>
 #include <ctime>
 #include <mutex>
 #include <string>
@@ -47,6 +49,7 @@
 #include "Assert.hpp"
 #include "geodeBanner.hpp"
 #include "util/chrono/time_point.hpp"
+#include "util/concurrent/bounded_mpsc_queue.hpp"
 
 #if defined(_WIN32)
 #include <io.h>
@@ -95,6 +98,12 @@ FILE* g_log = nullptr;
 ACE_utsname g_uname;
 pid_t g_pid = 0;
 
+// Set while logging is asynchronous. Threads about to queue a line are
+// counted in g_asyncLogProducers so that stopping can wait for them.
+std::atomic<client::AsyncLogWriter*> g_asyncLogWriter(nullptr);
+std::atomic<int32_t> g_asyncLogProducers(0);
+std::atomic<uint64_t> g_droppedLogLines(0);
+
 }  // namespace globals
 }  // namespace log
 }  // namespace geode
@@ -161,8 +170,11 @@ namespace client {
 
 LogLevel Log::s_logLevel = LogLevel::Default;
 
+using apache::geode::log::globals::g_asyncLogProducers;
+using apache::geode::log::globals::g_asyncLogWriter;
 using apache::geode::log::globals::g_bytesWritten;
 using apache::geode::log::globals::g_diskSpaceLimit;
+using apache::geode::log::globals::g_droppedLogLines;
 using apache::geode::log::globals::g_fileInfo;
 using apache::geode::log::globals::g_fileInfoPair;
 using apache::geode::log::globals::g_fileSizeLimit;
@@ -178,6 +190,136 @@ using apache::geode::log::globals::g_uname;
 
 /*****************************************************************************/
 
+/**
+ * Formats and writes the log-lines queued by logging threads on a thread of
+ * its own.
+ */
+class AsyncLogWriter {
+ public:
+  AsyncLogWriter(uint32_t queueSize, bool dropWhenFull)
+      : m_queue(queueSize),
+        m_dropWhenFull(dropWhenFull),
+        m_reportedDrops(g_droppedLogLines.load()),
+        m_running(true),
+        m_waiting(false),
+        m_blockedProducers(0),
+        m_thread(&AsyncLogWriter::run, this) {}
+
+  /** Writes what is left in the queue and stops the thread. */
+  ~AsyncLogWriter() {
+    {
+      std::lock_guard<std::mutex> guard(m_waitMutex);
+      m_running = false;
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+  }
+
+  void put(LogLevel level, const char* msg) {
+    Record record{level, std::chrono::system_clock::now(),
+                  hacks::aceThreadId(ACE_OS::thr_self()), msg};
+    if (m_dropWhenFull) {
+      if (!m_queue.try_push(record)) {
+        g_droppedLogLines++;
+        return;
+      }
+    } else if (!m_queue.try_push(record)) {
+      // Retried under the mutex, which the writer takes after draining a
+      // batch, so the notification can't be missed.
+      std::unique_lock<std::mutex> lock(m_waitMutex);
+      m_blockedProducers++;
+      m_wakeUp.notify_one();
+      m_spaceAvailable.wait(
+          lock, [this, &record] { return m_queue.try_push(record); });
+      m_blockedProducers--;
+    }
+    if (m_waiting) {
+      wakeUp();
+    }
+  }
+
+ private:
+  struct Record {
+    LogLevel level;
+    std::chrono::system_clock::time_point time;
+    uint64_t threadId;
+    std::string message;
+  };
+
+  // Bounds how long a burst of queued lines holds the log mutex.
+  static const int MaxBatchSize = 256;
+
+  void wakeUp() {
+    std::lock_guard<std::mutex> guard(m_waitMutex);
+    m_wakeUp.notify_one();
+  }
+
+  void run() {
+    Record record;
+    for (;;) {
+      int written = 0;
+      {
+        std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
+        reportDrops();
+        while (written < MaxBatchSize && m_queue.try_pop(record)) {
+          try {
+            Log::write(record.level, record.time, record.threadId,
+                       record.message.c_str(), false);
+          } catch (const Exception&) {
+            // Nobody to report to; lose the line like a failed write.
+          }
+          written++;
+        }
+        if (written > 0) {
+          Log::flush();
+        }
+      }
+      if (written > 0) {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        if (m_blockedProducers > 0) {
+          m_spaceAvailable.notify_all();
+        }
+      } else {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        if (!m_running && m_queue.empty()) {
+          break;
+        }
+        // A producer checks m_waiting without the mutex and may miss it
+        // being set, so don't sleep for long.
+        m_waiting = true;
+        if (m_running && m_queue.empty()) {
+          m_wakeUp.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        m_waiting = false;
+      }
+    }
+  }
+
+  void reportDrops() {
+    auto drops = g_droppedLogLines.load();
+    if (drops != m_reportedDrops) {
+      auto msg = std::to_string(drops - m_reportedDrops) +
+                 " log lines were dropped because the log queue was full";
+      Log::write(LogLevel::Warning, std::chrono::system_clock::now(),
+                 hacks::aceThreadId(ACE_OS::thr_self()), msg.c_str(), false);
+      m_reportedDrops = drops;
+    }
+  }
+
+  util::concurrent::bounded_mpsc_queue<Record> m_queue;
+  const bool m_dropWhenFull;
+  uint64_t m_reportedDrops;
+  bool m_running;
+  std::atomic<bool> m_waiting;
+  int32_t m_blockedProducers;
+  std::mutex m_waitMutex;
+  std::condition_variable m_wakeUp;
+  std::condition_variable m_spaceAvailable;
+  std::thread m_thread;
+};
+
+/*****************************************************************************/
+
 void Log::init(LogLevel level, const char* logFileName, int32_t logFileLimit,
                int64_t logDiskSpaceLimit) {
   if (g_log != nullptr) {
@@ -352,6 +494,8 @@ void Log::init(LogLevel level, const char* logFileName, int32_t logFileLimit,
 }
 
 void Log::close() {
+  stopAsync();
+
   std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
 
   std::string oldfile;
@@ -372,6 +516,25 @@ void Log::close() {
   }
 }
 
+void Log::startAsync(uint32_t queueSize, bool dropWhenFull) {
+  stopAsync();
+  g_asyncLogWriter = new AsyncLogWriter(queueSize, dropWhenFull);
+}
+
+void Log::stopAsync() {
+  auto writer = g_asyncLogWriter.exchange(nullptr);
+  if (writer == nullptr) {
+    return;
+  }
+  // Let threads that already picked up the writer finish queueing.
+  while (g_asyncLogProducers > 0) {
+    std::this_thread::yield();
+  }
+  delete writer;
+}
+
+uint64_t Log::droppedLineCount() { return g_droppedLogLines; }
+
 void Log::writeBanner() {
   if (g_logFileWithExt == nullptr) {
     return;
@@ -511,15 +674,21 @@ LogLevel Log::charsToLevel(const std::string& chars) {
 }
 
 char* Log::formatLogLine(char* buf, LogLevel level) {
+  return formatLogLine(buf, level, std::chrono::system_clock::now(),
+                       hacks::aceThreadId(ACE_OS::thr_self()));
+}
+
+char* Log::formatLogLine(char* buf, LogLevel level,
+                         std::chrono::system_clock::time_point time,
+                         uint64_t threadId) {
   if (g_pid == 0) {
     g_pid = boost::this_process::get_id();
     ACE_OS::uname(&g_uname);
   }
   const size_t MINBUFSIZE = 128;
-  auto now = std::chrono::system_clock::now();
-  auto secs = std::chrono::system_clock::to_time_t(now);
+  auto secs = std::chrono::system_clock::to_time_t(time);
   auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
-      now - std::chrono::system_clock::from_time_t(secs));
+      time - std::chrono::system_clock::from_time_t(secs));
   auto tm_val = apache::geode::util::chrono::localtime(secs);
   auto pbuf = buf;
   pbuf += std::snprintf(pbuf, 15, "[%s ", Log::levelToChars(level));
@@ -529,7 +698,7 @@ char* Log::formatLogLine(char* buf, LogLevel level) {
   pbuf += std::strftime(pbuf, MINBUFSIZE, "%Z ", &tm_val);
 
   std::snprintf(pbuf, 300, "%s:%d %" PRIu64 "] ", g_uname.nodename, g_pid,
-                hacks::aceThreadId(ACE_OS::thr_self()));
+                threadId);
 
   return buf;
 }
@@ -540,16 +709,36 @@ void Log::put(LogLevel level, const std::string& msg) {
 
 // int g_count = 0;
 void Log::put(LogLevel level, const char* msg) {
+  // Only count the producer once logging looks asynchronous; stopAsync clears
+  // the writer before waiting, so the second load sees whether it is still
+  // safe to use.
+  if (g_asyncLogWriter.load(std::memory_order_relaxed) != nullptr) {
+    g_asyncLogProducers++;
+    if (auto writer = g_asyncLogWriter.load()) {
+      writer->put(level, msg);
+      g_asyncLogProducers--;
+      return;
+    }
+    g_asyncLogProducers--;
+  }
+
   std::lock_guard<decltype(g_logMutex)> guard(g_logMutex);
+  write(level, std::chrono::system_clock::now(),
+        hacks::aceThreadId(ACE_OS::thr_self()), msg, true);
+}
 
+void Log::write(LogLevel level, std::chrono::system_clock::time_point time,
+                uint64_t threadId, const char* msg, bool flush) {
   g_fileInfo fileInfo;
 
   char buf[256] = {0};
   char fullpath[512] = {0};
 
   if (!g_logFile) {
-    fprintf(stdout, "%s%s\n", formatLogLine(buf, level), msg);
-    fflush(stdout);
+    fprintf(stdout, "%s%s\n", formatLogLine(buf, level, time, threadId), msg);
+    if (flush) {
+      fflush(stdout);
+    }
     // TODO: ignoring for now; probably store the log-lines for possible
     // future logging if log-file gets initialized properly
 
@@ -568,7 +757,7 @@ void Log::put(LogLevel level, const char* msg) {
       }
     }
 
-    formatLogLine(buf, level);
+    formatLogLine(buf, level, time, threadId);
     size_t numChars = static_cast<int>(std::strlen(buf) + std::strlen(msg));
     g_bytesWritten +=
         numChars + 2;  // bcoz we have to count trailing new line (\n)
@@ -680,12 +869,20 @@ void Log::put(LogLevel level, const char* msg) {
       // process to terminate
       fclose(g_log);
       g_log = nullptr;
-    } else {
+    } else if (flush) {
       fflush(g_log);
     }
   }
 }
 
+void Log::flush() {
+  if (!g_logFile) {
+    fflush(stdout);
+  } else if (g_log) {
+    fflush(g_log);
+  }
+}
+
 void Log::putThrow(LogLevel level, const char* msg, const Exception& ex) {
   std::string message = "Geode exception " + ex.getName() +
                         " thrown: " + ex.getMessage() + "\n" + msg;
@@ -0,0 +1,94 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OrderedChunkDecoder.hpp"
+
+#include <chrono>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+OrderedChunkDecoder::DecodeWork::DecodeWork(Decode decode)
+    : m_decode(std::move(decode)) {}
+
+std::exception_ptr OrderedChunkDecoder::DecodeWork::getError() const {
+  return m_error;
+}
+
+OrderedChunkDecoder::Apply OrderedChunkDecoder::DecodeWork::execute(void) {
+  try {
+    return m_decode();
+  } catch (...) {
+    m_error = std::current_exception();
+    return nullptr;
+  }
+}
+
+OrderedChunkDecoder::OrderedChunkDecoder(ThreadPool& pool) : m_pool(pool) {}
+
+OrderedChunkDecoder::~OrderedChunkDecoder() { discard(); }
+
+void OrderedChunkDecoder::submit(Decode decode) {
+  auto work = std::make_shared<DecodeWork>(std::move(decode));
+  m_pool.perform(work.get());
+  m_pending.push_back(std::move(work));
+
+  while (applyNext(false)) {
+  }
+}
+
+void OrderedChunkDecoder::drain() {
+  while (applyNext(true)) {
+  }
+}
+
+void OrderedChunkDecoder::discard() {
+  for (const auto& work : m_pending) {
+    work->getResult();
+  }
+  m_pending.clear();
+}
+
+bool OrderedChunkDecoder::applyNext(bool wait) {
+  if (m_pending.empty()) {
+    return false;
+  }
+
+  Apply apply;
+  const auto& work = m_pending.front();
+  if (wait) {
+    apply = work->getResult();
+  } else if (!work->getResult(apply, std::chrono::steady_clock::now())) {
+    return false;
+  }
+
+  auto error = work->getError();
+  m_pending.pop_front();
+  if (error) {
+    discard();
+    std::rethrow_exception(error);
+  }
+  if (apply) {
+    apply();
+  }
+  return true;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,98 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_ORDEREDCHUNKDECODER_H_
+#define GEODE_ORDEREDCHUNKDECODER_H_
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+
+#include "ThreadPool.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Decodes the chunks of a response on a thread pool, applying the decoded
+ * chunks to the response in the order the chunks were submitted. Decoding
+ * must not touch the state of the response; only the function returned by
+ * the decode changes it, and those functions run on the submitting thread.
+ */
+class OrderedChunkDecoder {
+ public:
+  /** applies a decoded chunk to the response */
+  typedef std::function<void()> Apply;
+
+  /** decodes a chunk, returning how to apply it */
+  typedef std::function<Apply()> Decode;
+
+  explicit OrderedChunkDecoder(ThreadPool& pool);
+
+  /** waits for the decodes still running, discarding them */
+  ~OrderedChunkDecoder();
+
+  OrderedChunkDecoder(const OrderedChunkDecoder&) = delete;
+  OrderedChunkDecoder& operator=(const OrderedChunkDecoder&) = delete;
+
+  /**
+   * Queues the decode of a chunk on the pool, then applies the chunks
+   * submitted earlier whose decode already completed.
+   */
+  void submit(Decode decode);
+
+  /**
+   * Waits for all submitted decodes and applies them in order. If a decode
+   * failed, the remaining chunks are discarded and its exception is thrown.
+   */
+  void drain();
+
+  /** waits for all submitted decodes without applying them */
+  void discard();
+
+ private:
+  class DecodeWork : public PooledWork<Apply> {
+   public:
+    explicit DecodeWork(Decode decode);
+
+    /** the exception thrown by the decode, if any */
+    std::exception_ptr getError() const;
+
+   protected:
+    Apply execute(void) override;
+
+   private:
+    Decode m_decode;
+    std::exception_ptr m_error;
+  };
+
+  /** applies the first pending chunk, waiting for its decode if wait */
+  bool applyNext(bool wait);
+
+  ThreadPool& m_pool;
+  std::deque<std::shared_ptr<DecodeWork>> m_pending;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_ORDEREDCHUNKDECODER_H_
@@ -0,0 +1,168 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelQueryResultCollector.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/UserFunctionExecutionException.hpp>
+
+#include "QueryScanner.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+using Token = QueryScanner::Token;
+
+/** @return the region path starting with the '/' at tokens[start] */
+std::string regionPathAt(const std::vector<Token>& tokens, size_t start) {
+  std::string path;
+  auto end = tokens[start].position;
+  for (auto i = start; i < tokens.size() && tokens[i].position == end; ++i) {
+    const auto& token = tokens[i];
+    if (token.type != QueryScanner::TokenType::WORD &&
+        !QueryScanner::isSymbol(token, '/') &&
+        !QueryScanner::isSymbol(token, '-')) {
+      break;
+    }
+    path += token.text;
+    end += token.text.length();
+  }
+  return path;
+}
+
+/** checks the regions iterated by the FROM clause starting at tokens[start] */
+void checkRegionPaths(const std::vector<Token>& tokens, size_t start,
+                      const std::string& regionPath) {
+  int depth = 0;
+  bool iteratorStart = true;
+  for (auto i = start; i < tokens.size(); ++i) {
+    const auto& token = tokens[i];
+    if (depth == 0 && QueryScanner::isSymbol(token, '/') &&
+        (iteratorStart || QueryScanner::isKeyword(tokens[i - 1], "IN"))) {
+      auto path = regionPathAt(tokens, i);
+      if (path != regionPath) {
+        throw IllegalArgumentException("Query::executeParallel: query on " +
+                                       path + " cannot run on the buckets of " +
+                                       regionPath);
+      }
+    }
+    iteratorStart = false;
+    if (QueryScanner::isSymbol(token, '(')) {
+      ++depth;
+    } else if (QueryScanner::isSymbol(token, ')')) {
+      if (depth-- == 0) {
+        return;
+      }
+    } else if (depth == 0) {
+      if (QueryScanner::isSymbol(token, ',')) {
+        iteratorStart = true;
+      } else if (QueryScanner::isKeyword(token, "WHERE") ||
+                 QueryScanner::isKeyword(token, "ORDER") ||
+                 QueryScanner::isKeyword(token, "GROUP") ||
+                 QueryScanner::isKeyword(token, "LIMIT")) {
+        return;
+      }
+    }
+  }
+}
+
+bool isAggregate(const Token& token) {
+  return QueryScanner::isKeyword(token, "COUNT") ||
+         QueryScanner::isKeyword(token, "SUM") ||
+         QueryScanner::isKeyword(token, "AVG") ||
+         QueryScanner::isKeyword(token, "MIN") ||
+         QueryScanner::isKeyword(token, "MAX");
+}
+
+}  // namespace
+
+ParallelQueryResultCollector::ParallelQueryResultCollector()
+    : m_rows(CacheableVector::create()), m_ready(false) {}
+
+std::shared_ptr<CacheableVector> ParallelQueryResultCollector::getResult(
+    std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  if (!m_readyCondition.wait_for(lk, timeout, [this] { return m_ready; })) {
+    throw FunctionExecutionException(
+        "Result is not ready, endResults callback is called before invoking "
+        "getResult() method");
+  }
+  if (!m_error.empty()) {
+    throw QueryException("Query::executeParallel: " + m_error);
+  }
+  return m_rows;
+}
+
+void ParallelQueryResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  if (auto list = std::dynamic_pointer_cast<CacheableArrayList>(result)) {
+    m_rows->insert(m_rows->end(), list->begin(), list->end());
+  } else if (auto vector = std::dynamic_pointer_cast<CacheableVector>(result)) {
+    m_rows->insert(m_rows->end(), vector->begin(), vector->end());
+  } else if (auto ex = std::dynamic_pointer_cast<UserFunctionExecutionException>(
+                 result)) {
+    if (m_error.empty()) {
+      m_error = ex->getMessage();
+    }
+  } else {
+    m_rows->push_back(result);
+  }
+}
+
+void ParallelQueryResultCollector::endResults() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_ready = true;
+  }
+  m_readyCondition.notify_all();
+}
+
+void ParallelQueryResultCollector::clearResults() {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  m_rows->clear();
+  m_error.clear();
+}
+
+void ParallelQueryResultCollector::checkQuery(const std::string& queryString,
+                                              const std::string& regionPath) {
+  const auto tokens = QueryScanner::scan(queryString);
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    const auto& token = tokens[i];
+    const auto next = i + 1 < tokens.size() ? &tokens[i + 1] : nullptr;
+    if (QueryScanner::isKeyword(token, "DISTINCT") ||
+        QueryScanner::isKeyword(token, "LIMIT") ||
+        ((QueryScanner::isKeyword(token, "ORDER") ||
+          QueryScanner::isKeyword(token, "GROUP")) &&
+         next && QueryScanner::isKeyword(*next, "BY")) ||
+        (isAggregate(token) && next && QueryScanner::isSymbol(*next, '('))) {
+      throw UnsupportedOperationException(
+          "Query::executeParallel: " + token.text +
+          " cannot be applied to the rows of each bucket separately");
+    }
+    if (QueryScanner::isKeyword(token, "FROM")) {
+      checkRegionPaths(tokens, i + 1, regionPath);
+    }
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,91 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PARALLELQUERYRESULTCOLLECTOR_H_
+#define GEODE_PARALLELQUERYRESULTCOLLECTOR_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ResultCollector.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Merges the results of a query function executed on the buckets of each
+ * server into a single list of rows. A list sent by the function is
+ * flattened into its elements, any other value is a row by itself.
+ */
+class APACHE_GEODE_EXPORT ParallelQueryResultCollector
+    : public ResultCollector {
+ public:
+  ParallelQueryResultCollector();
+
+  ~ParallelQueryResultCollector() noexcept override = default;
+
+  /**
+   * @throws QueryException if the query function sent an exception
+   * @throws FunctionExecutionException if the results are not complete
+   * within the timeout
+   */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  void clearResults() override;
+
+  /**
+   * Checks that the rows of queryString run on the buckets of the region at
+   * regionPath can be merged by appending them. Ordering, limits, DISTINCT,
+   * grouping and aggregates apply to the rows of each bucket only, and a
+   * query on another region does not match the bucket filter.
+   *
+   * @throws UnsupportedOperationException if the query orders, limits,
+   * groups, aggregates or selects DISTINCT rows
+   * @throws IllegalArgumentException if the query reads from a region other
+   * than regionPath
+   */
+  static void checkQuery(const std::string& queryString,
+                         const std::string& regionPath);
+
+ private:
+  std::shared_ptr<CacheableVector> m_rows;
+  std::string m_error;
+  bool m_ready;
+  std::condition_variable m_readyCondition;
+  std::mutex m_mutex;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PARALLELQUERYRESULTCOLLECTOR_H_
@@ -0,0 +1,53 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PartialExecutionResult.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+PartialExecutionResult::PartialExecutionResult(
+    std::shared_ptr<ResultCollector> collector,
+    std::vector<std::string> timedOutServers,
+    std::map<std::string, std::string> failedServers)
+    : m_collector(std::move(collector)),
+      m_timedOutServers(std::move(timedOutServers)),
+      m_failedServers(std::move(failedServers)) {}
+
+const std::shared_ptr<ResultCollector>& PartialExecutionResult::getCollector()
+    const {
+  return m_collector;
+}
+
+const std::vector<std::string>& PartialExecutionResult::getTimedOutServers()
+    const {
+  return m_timedOutServers;
+}
+
+const std::map<std::string, std::string>&
+PartialExecutionResult::getFailedServers() const {
+  return m_failedServers;
+}
+
+bool PartialExecutionResult::isComplete() const {
+  return m_timedOutServers.empty() && m_failedServers.empty();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,317 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PdxBatchFilter.hpp>
+
+#include <cstring>
+#include <functional>
+#include <memory>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/PdxInstance.hpp>
+#include <geode/SerializedResult.hpp>
+
+#include "PdxHelper.hpp"
+#include "PdxInstanceImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+// A value of the batch: its PDX stream, without the length and type id
+// header, or the instance to read the fields from when there is no stream
+// of the filter's type.
+struct PdxBatchFilter::Row {
+  const uint8_t* stream;
+  int32_t length;
+  const PdxInstance* instance;
+  // keeps the stream of an instance valid if the instance is modified
+  std::shared_ptr<const uint8_t> owner;
+};
+
+namespace {
+
+bool isIntegral(PdxFieldTypes type) {
+  switch (type) {
+    case PdxFieldTypes::BOOLEAN:
+    case PdxFieldTypes::BYTE:
+    case PdxFieldTypes::SHORT:
+    case PdxFieldTypes::INT:
+    case PdxFieldTypes::LONG:
+    case PdxFieldTypes::CHAR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+int fieldSize(PdxFieldTypes type) {
+  switch (type) {
+    case PdxFieldTypes::BOOLEAN:
+    case PdxFieldTypes::BYTE:
+      return 1;
+    case PdxFieldTypes::SHORT:
+    case PdxFieldTypes::CHAR:
+      return 2;
+    case PdxFieldTypes::INT:
+    case PdxFieldTypes::FLOAT:
+      return 4;
+    default:
+      return 8;
+  }
+}
+
+uint64_t readBigEndian(const uint8_t* position, int size) {
+  uint64_t value = 0;
+  for (int i = 0; i < size; i++) {
+    value = (value << 8) | position[i];
+  }
+  return value;
+}
+
+int64_t readIntegral(const PdxFieldHandle& field, const uint8_t* position) {
+  auto bits = readBigEndian(position, fieldSize(field.getFieldType()));
+  switch (field.getFieldType()) {
+    case PdxFieldTypes::BOOLEAN:
+      return bits != 0;
+    case PdxFieldTypes::BYTE:
+      return static_cast<int8_t>(bits);
+    case PdxFieldTypes::SHORT:
+      return static_cast<int16_t>(bits);
+    case PdxFieldTypes::CHAR:
+      return static_cast<uint16_t>(bits);
+    case PdxFieldTypes::INT:
+      return static_cast<int32_t>(bits);
+    default:
+      return static_cast<int64_t>(bits);
+  }
+}
+
+int64_t readIntegral(const PdxFieldHandle& field,
+                     const PdxInstance& instance) {
+  switch (field.getFieldType()) {
+    case PdxFieldTypes::BOOLEAN:
+      return instance.getBooleanField(field);
+    case PdxFieldTypes::BYTE:
+      return instance.getByteField(field);
+    case PdxFieldTypes::SHORT:
+      return instance.getShortField(field);
+    case PdxFieldTypes::CHAR:
+      return instance.getCharField(field);
+    case PdxFieldTypes::INT:
+      return instance.getIntField(field);
+    default:
+      return instance.getLongField(field);
+  }
+}
+
+double readFloating(const PdxFieldHandle& field, const uint8_t* position) {
+  if (field.getFieldType() == PdxFieldTypes::FLOAT) {
+    auto bits = static_cast<uint32_t>(readBigEndian(position, 4));
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  auto bits = readBigEndian(position, 8);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+double readFloating(const PdxFieldHandle& field, const PdxInstance& instance) {
+  if (field.getFieldType() == PdxFieldTypes::FLOAT) {
+    return instance.getFloatField(field);
+  }
+  return instance.getDoubleField(field);
+}
+
+// Keeps the selected indexes whose column value passes the comparison. The
+// loop has no branch on the comparison result, so that the compiler can
+// vectorize it.
+template <class T, class Compare>
+void compact(const std::vector<T>& column, T value, Compare compare,
+             std::vector<size_t>& selection) {
+  size_t selected = 0;
+  for (size_t i = 0; i < column.size(); i++) {
+    selection[selected] = selection[i];
+    selected += compare(column[i], value) ? 1 : 0;
+  }
+  selection.resize(selected);
+}
+
+template <class T>
+void compact(const std::vector<T>& column, T value,
+             PdxBatchFilter::Comparison comparison,
+             std::vector<size_t>& selection) {
+  switch (comparison) {
+    case PdxBatchFilter::Comparison::EQUAL:
+      compact(column, value, std::equal_to<T>(), selection);
+      break;
+    case PdxBatchFilter::Comparison::NOT_EQUAL:
+      compact(column, value, std::not_equal_to<T>(), selection);
+      break;
+    case PdxBatchFilter::Comparison::LESS:
+      compact(column, value, std::less<T>(), selection);
+      break;
+    case PdxBatchFilter::Comparison::LESS_EQUAL:
+      compact(column, value, std::less_equal<T>(), selection);
+      break;
+    case PdxBatchFilter::Comparison::GREATER:
+      compact(column, value, std::greater<T>(), selection);
+      break;
+    case PdxBatchFilter::Comparison::GREATER_EQUAL:
+      compact(column, value, std::greater_equal<T>(), selection);
+      break;
+  }
+}
+
+}  // namespace
+
+PdxBatchFilter& PdxBatchFilter::where(const PdxFieldHandle& field,
+                                      Comparison comparison, int64_t value) {
+  if (!isIntegral(field.getFieldType())) {
+    throw IllegalStateException("PdxBatchFilter field " +
+                                field.getFieldName() +
+                                " is not of an integral type");
+  }
+  addCondition(field, comparison, value, 0);
+  return *this;
+}
+
+PdxBatchFilter& PdxBatchFilter::where(const PdxFieldHandle& field,
+                                      Comparison comparison, double value) {
+  if (field.getFieldType() != PdxFieldTypes::FLOAT &&
+      field.getFieldType() != PdxFieldTypes::DOUBLE) {
+    throw IllegalStateException("PdxBatchFilter field " +
+                                field.getFieldName() +
+                                " is not of a floating point type");
+  }
+  addCondition(field, comparison, 0, value);
+  return *this;
+}
+
+void PdxBatchFilter::addCondition(const PdxFieldHandle& field,
+                                  Comparison comparison, int64_t integer,
+                                  double floating) {
+  if (!m_conditions.empty() &&
+      m_conditions.front().field.getPdxTypeId() != field.getPdxTypeId()) {
+    throw IllegalStateException("PdxBatchFilter field " +
+                                field.getFieldName() +
+                                " is of another PDX type than the others");
+  }
+  m_conditions.push_back(Condition{field, comparison, integer, floating});
+}
+
+std::vector<size_t> PdxBatchFilter::select(
+    const std::vector<std::shared_ptr<PdxInstance>>& instances) const {
+  auto typeId =
+      m_conditions.empty() ? 0 : m_conditions.front().field.getPdxTypeId();
+
+  std::vector<Row> rows;
+  rows.reserve(instances.size());
+  for (auto&& instance : instances) {
+    auto instanceImpl = dynamic_cast<const PdxInstanceImpl*>(instance.get());
+    auto stream = instanceImpl != nullptr && typeId != 0 &&
+                          instanceImpl->getPdxTypeId() == typeId
+                      ? instanceImpl->getPdxStream()
+                      : nullptr;
+    if (stream != nullptr) {
+      rows.push_back(Row{stream.get(), instanceImpl->getPdxStreamLength(),
+                         nullptr, stream});
+    } else {
+      rows.push_back(Row{nullptr, 0, instance.get(), nullptr});
+    }
+  }
+  return select(rows);
+}
+
+std::vector<size_t> PdxBatchFilter::select(
+    const std::vector<std::shared_ptr<SerializedResult>>& values) const {
+  auto typeId =
+      m_conditions.empty() ? 0 : m_conditions.front().field.getPdxTypeId();
+
+  // DSCode, then the length and type id header of PdxHelper::serializePdx.
+  const size_t pdxHeaderSize = 1 + 4 + 4;
+
+  std::vector<Row> rows;
+  rows.reserve(values.size());
+  for (auto&& value : values) {
+    auto bytes = const_cast<uint8_t*>(value->getBytes());
+    if (value->getLength() < pdxHeaderSize ||
+        static_cast<DSCode>(bytes[0]) != DSCode::PDX) {
+      throw IllegalStateException("PdxBatchFilter value is not a PDX value");
+    }
+    auto length = PdxHelper::readInt32(bytes + 1);
+    if (length < 0 ||
+        value->getLength() - pdxHeaderSize < static_cast<size_t>(length)) {
+      throw OutOfRangeException("PdxBatchFilter PDX value is truncated");
+    }
+    if (typeId != 0 && PdxHelper::readInt32(bytes + 5) != typeId) {
+      throw IllegalStateException(
+          "PdxBatchFilter value is of another PDX type than the fields");
+    }
+    rows.push_back(Row{bytes + pdxHeaderSize, length, nullptr, nullptr});
+  }
+  return select(rows);
+}
+
+std::vector<size_t> PdxBatchFilter::select(const std::vector<Row>& rows) const {
+  std::vector<size_t> selection(rows.size());
+  for (size_t i = 0; i < selection.size(); i++) {
+    selection[i] = i;
+  }
+
+  std::vector<int64_t> integers;
+  std::vector<double> floatings;
+  for (auto&& condition : m_conditions) {
+    if (selection.empty()) {
+      break;
+    }
+    auto& field = condition.field;
+    auto size = fieldSize(field.getFieldType());
+
+    // Gather the field of the values still selected into a column.
+    if (isIntegral(field.getFieldType())) {
+      integers.resize(selection.size());
+      for (size_t i = 0; i < selection.size(); i++) {
+        auto& row = rows[selection[i]];
+        integers[i] =
+            row.stream ? readIntegral(field, PdxInstanceImpl::locateField(
+                                                 field, row.stream,
+                                                 row.length, size))
+                       : readIntegral(field, *row.instance);
+      }
+      compact(integers, condition.integer, condition.comparison, selection);
+    } else {
+      floatings.resize(selection.size());
+      for (size_t i = 0; i < selection.size(); i++) {
+        auto& row = rows[selection[i]];
+        floatings[i] =
+            row.stream ? readFloating(field, PdxInstanceImpl::locateField(
+                                                 field, row.stream,
+                                                 row.length, size))
+                       : readFloating(field, *row.instance);
+      }
+      compact(floatings, condition.floating, condition.comparison, selection);
+    }
+  }
+  return selection;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
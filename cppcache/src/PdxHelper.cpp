@@ -19,6 +19,7 @@
 
 #include <geode/Cache.hpp>
 #include <geode/DataInput.hpp>
+#include <geode/PdxSchema.hpp>
 #include <geode/PoolManager.hpp>
 
 #include "CacheRegionHelper.hpp"
@@ -27,6 +28,7 @@
 #include "PdxInstanceImpl.hpp"
 #include "PdxLocalReader.hpp"
 #include "PdxReaderWithTypeCollector.hpp"
+#include "PdxRemotePreservedData.hpp"
 #include "PdxRemoteReader.hpp"
 #include "PdxRemoteWriter.hpp"
 #include "PdxType.hpp"
@@ -63,6 +65,9 @@ void PdxHelper::serializePdx(
           piPt, DataOutputInternal::getPool(output));
       pdxII->setPdxId(typeId);
     }
+    if (pdxII->writePatchedPdxStream(output)) {
+      return;
+    }
     auto plw = PdxLocalWriter(output, piPt, pdxTypeRegistry);
     pdxII->toData(plw);
     plw.endObjectWriting();  // now write typeid
@@ -75,6 +80,22 @@ void PdxHelper::serializePdx(
     return;
   }
 
+  // Schema described classes write themselves with a cached type id, without
+  // the class name lookup and the PdxWriter calls below.
+  if (auto schemaObject =
+          dynamic_cast<const internal::PdxSchemaSerializableBase*>(
+              pdxObject.get())) {
+    auto startPosition = output.getBufferLength();
+    if (!getPreservedData(*pdxObject) &&
+        schemaObject->writePdxStream(output)) {
+      uint8_t* stPos = const_cast<uint8_t*>(output.getBuffer()) + startPosition;
+      int pdxLen = PdxHelper::readInt32(stPos);
+      cachePerfStats.incPdxSerialization(
+          pdxLen + 1 + 2 * 4);  // pdxLen + 93 DSID + len + typeID
+      return;
+    }
+  }
+
   auto&& className = pdxObject->getClassName();
   auto localPdxType = pdxTypeRegistry->getLocalPdxType(className);
 
@@ -111,7 +132,7 @@ void PdxHelper::serializePdx(
     // trick here?
 
     auto createPdxRemoteWriter = [&]() -> PdxRemoteWriter {
-      if (auto pd = pdxTypeRegistry->getPreserveData(pdxObject)) {
+      if (auto pd = getPreservedData(*pdxObject)) {
         auto mergedPdxType = pdxTypeRegistry->getPdxType(pd->getMergedTypeId());
         return PdxRemoteWriter(output, mergedPdxType, pd, pdxTypeRegistry);
       } else {
@@ -167,13 +188,7 @@ std::shared_ptr<PdxSerializable> PdxHelper::deserializePdx(DataInput& dataInput,
       pdxObjectptr->fromData(prr);
       auto mergedVersion = pdxTypeRegistry->getMergedType(pType->getTypeId());
 
-      auto preserveData = prr.getPreservedData(mergedVersion, pdxObjectptr);
-      if (preserveData != nullptr) {
-        pdxTypeRegistry->setPreserveData(
-            pdxObjectptr, preserveData,
-            cacheImpl
-                ->getExpiryTaskManager());  // it will set data in weakhashmap
-      }
+      pdxObjectptr->m_preservedData = prr.getPreservedData(mergedVersion);
       prr.moveStream();
     }
   } else {
@@ -228,11 +243,7 @@ std::shared_ptr<PdxSerializable> PdxHelper::deserializePdx(DataInput& dataInput,
 
         auto mergedVersion = pdxTypeRegistry->getMergedType(pType->getTypeId());
 
-        if (auto preserveData =
-                prtc.getPreservedData(mergedVersion, pdxObjectptr)) {
-          pdxTypeRegistry->setPreserveData(pdxObjectptr, preserveData,
-                                           cacheImpl->getExpiryTaskManager());
-        }
+        pdxObjectptr->m_preservedData = prtc.getPreservedData(mergedVersion);
       }
       prtc.moveStream();
     } else {  // remote reader will come here as local type is there
@@ -249,11 +260,7 @@ std::shared_ptr<PdxSerializable> PdxHelper::deserializePdx(DataInput& dataInput,
 
       auto mergedVersion = pdxTypeRegistry->getMergedType(pType->getTypeId());
 
-      auto preserveData = prr.getPreservedData(mergedVersion, pdxObjectptr);
-      if (preserveData != nullptr) {
-        pdxTypeRegistry->setPreserveData(pdxObjectptr, preserveData,
-                                         cacheImpl->getExpiryTaskManager());
-      }
+      pdxObjectptr->m_preservedData = prr.getPreservedData(mergedVersion);
       prr.moveStream();
     }
   }
@@ -334,6 +341,12 @@ void PdxHelper::createMergedType(std::shared_ptr<PdxType> localType,
   }
 }
 
+std::shared_ptr<PdxRemotePreservedData> PdxHelper::getPreservedData(
+    const PdxSerializable& pdxObject) {
+  return std::dynamic_pointer_cast<PdxRemotePreservedData>(
+      pdxObject.m_preservedData);
+}
+
 int32_t PdxHelper::readInt32(uint8_t* offsetPosition) {
   int32_t data = offsetPosition[0];
   data = (data << 8) | offsetPosition[1];
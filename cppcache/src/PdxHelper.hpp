@@ -30,6 +30,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class PdxRemotePreservedData;
+
 class PdxHelper {
  private:
   static void createMergedType(std::shared_ptr<PdxType> localType,
@@ -77,6 +79,13 @@ class PdxHelper {
       int enumId, std::shared_ptr<PdxTypeRegistry> pdxTypeRegistry);
 
   static CacheImpl* getCacheImpl();
+
+  /**
+   * Returns the unread fields kept on the object when it was deserialized
+   * from a newer version of its type, or nullptr if there are none.
+   */
+  static std::shared_ptr<PdxRemotePreservedData> getPreservedData(
+      const PdxSerializable& pdxObject);
 };
 }  // namespace client
 }  // namespace geode
@@ -0,0 +1,213 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PdxInstanceBuilder.hpp>
+
+#include <cstring>
+
+#include "CacheImpl.hpp"
+#include "DataOutputInternal.hpp"
+#include "PdxInstanceImpl.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+PdxInstanceBuilder::PdxInstanceBuilder(const PdxInstanceImpl& prototype,
+                                       CachePerfStats& cachePerfStats,
+                                       PdxTypeRegistry& pdxTypeRegistry,
+                                       const CacheImpl& cacheImpl,
+                                       bool enableTimeStatistics)
+    : m_pdxType(prototype.getPdxType()),
+      m_typeId(prototype.getPdxTypeId()),
+      m_generation(pdxTypeRegistry.getGeneration()),
+      m_scratch(cacheImpl.createDataOutput()),
+      m_cachePerfStats(cachePerfStats),
+      m_pdxTypeRegistry(pdxTypeRegistry),
+      m_cacheImpl(cacheImpl),
+      m_enableTimeStatistics(enableTimeStatistics) {
+  std::vector<std::vector<uint8_t>> fieldBytes;
+  prototype.getSerializedFields(fieldBytes);
+
+  auto pdxFieldList = m_pdxType->getPdxFieldTypes();
+  m_fields.reserve(pdxFieldList->size());
+  size_t streamLength = 0;
+  for (size_t i = 0; i < pdxFieldList->size(); i++) {
+    auto& pdxField = pdxFieldList->at(i);
+    streamLength += fieldBytes[i].size();
+    m_fields.push_back(Field{pdxField->getFieldName(), pdxField->getTypeId(),
+                             pdxField->IsVariableLengthType(),
+                             std::move(fieldBytes[i])});
+    if (pdxField->IsVariableLengthType()) {
+      m_offsets.push_back(0);
+    }
+  }
+  // room for the widest offsets and for values growing a little
+  m_stream.reserve(2 * streamLength + 4 * m_offsets.size());
+}
+
+PdxInstanceBuilder::~PdxInstanceBuilder() noexcept = default;
+
+std::shared_ptr<PdxInstance> PdxInstanceBuilder::create() {
+  m_stream.clear();
+  m_offsets.clear();
+  for (auto&& field : m_fields) {
+    if (field.isVariableLength) {
+      m_offsets.push_back(static_cast<int32_t>(m_stream.size()));
+    }
+    m_stream.insert(m_stream.end(), field.bytes.begin(), field.bytes.end());
+  }
+
+  // Same offset width rules as PdxLocalWriter::calculateLenWithOffsets.
+  auto fieldsLength = static_cast<int32_t>(m_stream.size());
+  auto totalOffsets =
+      static_cast<int32_t>(m_offsets.empty() ? 0 : m_offsets.size() - 1);
+  size_t offsetSize = 4;
+  if (fieldsLength + totalOffsets <= 0xff) {
+    offsetSize = 1;
+  } else if (fieldsLength + 2 * totalOffsets <= 0xffff) {
+    offsetSize = 2;
+  }
+  for (auto i = totalOffsets; i > 0; i--) {
+    auto offset = static_cast<uint32_t>(m_offsets[i]);
+    for (auto shift = 8 * offsetSize; shift > 0; shift -= 8) {
+      m_stream.push_back(static_cast<uint8_t>(offset >> (shift - 8)));
+    }
+  }
+
+  return std::make_shared<PdxInstanceImpl>(
+      m_stream.data(), static_cast<int>(m_stream.size()), getTypeId(),
+      m_cachePerfStats, m_pdxTypeRegistry, m_cacheImpl,
+      m_enableTimeStatistics);
+}
+
+int32_t PdxInstanceBuilder::getTypeId() {
+  // A cleared registry has forgotten the type, so register it again.
+  auto generation = m_pdxTypeRegistry.getGeneration();
+  if (generation != m_generation) {
+    m_typeId = m_pdxTypeRegistry.getPDXIdForType(
+        m_pdxType, DataOutputInternal::getPool(m_scratch));
+    m_generation = generation;
+  }
+  return m_typeId;
+}
+
+size_t PdxInstanceBuilder::getFieldIndex(const std::string& fieldName) const {
+  for (size_t i = 0; i < m_fields.size(); i++) {
+    if (m_fields[i].name == fieldName) {
+      return i;
+    }
+  }
+  throw IllegalStateException("PdxInstanceBuilder doesn't have field " +
+                              fieldName);
+}
+
+std::vector<uint8_t>& PdxInstanceBuilder::getFieldBytes(size_t fieldIndex,
+                                                        PdxFieldTypes type) {
+  if (fieldIndex >= m_fields.size()) {
+    throw IllegalStateException("PdxInstanceBuilder doesn't have field " +
+                                std::to_string(fieldIndex));
+  }
+  auto& field = m_fields[fieldIndex];
+  if (field.type != type) {
+    throw IllegalStateException("type of field " + field.name +
+                                " not matched");
+  }
+  return field.bytes;
+}
+
+void PdxInstanceBuilder::writeBigEndian(size_t fieldIndex, PdxFieldTypes type,
+                                        uint64_t value, size_t size) {
+  auto& bytes = getFieldBytes(fieldIndex, type);
+  bytes.resize(size);
+  for (size_t i = size; i > 0; i--) {
+    bytes[i - 1] = static_cast<uint8_t>(value);
+    value >>= 8;
+  }
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeBoolean(size_t fieldIndex,
+                                                     bool value) {
+  writeBigEndian(fieldIndex, PdxFieldTypes::BOOLEAN, value ? 1 : 0, 1);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeByte(size_t fieldIndex,
+                                                  int8_t value) {
+  writeBigEndian(fieldIndex, PdxFieldTypes::BYTE, static_cast<uint8_t>(value),
+                 1);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeShort(size_t fieldIndex,
+                                                   int16_t value) {
+  writeBigEndian(fieldIndex, PdxFieldTypes::SHORT,
+                 static_cast<uint16_t>(value), 2);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeInt(size_t fieldIndex,
+                                                 int32_t value) {
+  writeBigEndian(fieldIndex, PdxFieldTypes::INT, static_cast<uint32_t>(value),
+                 4);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeLong(size_t fieldIndex,
+                                                  int64_t value) {
+  writeBigEndian(fieldIndex, PdxFieldTypes::LONG, static_cast<uint64_t>(value),
+                 8);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeFloat(size_t fieldIndex,
+                                                   float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  writeBigEndian(fieldIndex, PdxFieldTypes::FLOAT, bits, 4);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeDouble(size_t fieldIndex,
+                                                    double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  writeBigEndian(fieldIndex, PdxFieldTypes::DOUBLE, bits, 8);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeChar(size_t fieldIndex,
+                                                  char16_t value) {
+  writeBigEndian(fieldIndex, PdxFieldTypes::CHAR, value, 2);
+  return *this;
+}
+
+PdxInstanceBuilder& PdxInstanceBuilder::writeString(size_t fieldIndex,
+                                                    const std::string& value) {
+  auto& bytes = getFieldBytes(fieldIndex, PdxFieldTypes::STRING);
+  m_scratch.reset();
+  m_scratch.writeString(value);
+  bytes.assign(m_scratch.getBuffer(),
+               m_scratch.getBuffer() + m_scratch.getBufferLength());
+  return *this;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -54,6 +54,11 @@ std::shared_ptr<PdxInstance> PdxInstanceFactory::create() {
 
   return std::move(pi);
 }
+PdxInstanceBuilder PdxInstanceFactory::createBuilder() {
+  auto pi = std::static_pointer_cast<PdxInstanceImpl>(create());
+  return PdxInstanceBuilder(*pi, m_cachePerfStats, m_pdxTypeRegistry,
+                            m_cacheImpl, m_enableTimeStatistics);
+}
 PdxInstanceFactory& PdxInstanceFactory::writeChar(const std::string& fieldName,
                                                   char16_t value) {
   isFieldAdded(fieldName);
@@ -18,6 +18,9 @@
 #include "PdxInstanceImpl.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 
 #include <geode/Cache.hpp>
 #include <geode/PdxFieldTypes.hpp>
@@ -49,6 +52,21 @@ std::shared_ptr<PdxFieldType> PdxInstanceImpl::m_DefaultPdxFieldType(
     new PdxFieldType("default", "default", PdxFieldTypes::UNKNOWN,
                      -1 /*field index*/, false, 1, -1 /*var len field idx*/));
 
+namespace {
+
+const int64_t NoHashCode = std::numeric_limits<int64_t>::min();
+
+template <typename T>
+T readBigEndian(const uint8_t* position) {
+  typename std::make_unsigned<T>::type value = 0;
+  for (size_t i = 0; i < sizeof(T); i++) {
+    value = static_cast<decltype(value)>(value << 8) | position[i];
+  }
+  return static_cast<T>(value);
+}
+
+}  // namespace
+
 bool sortFunc(std::shared_ptr<PdxFieldType> field1,
               std::shared_ptr<PdxFieldType> field2) {
   const auto diff = field1->getFieldName().compare(field2->getFieldName());
@@ -59,23 +77,23 @@ bool sortFunc(std::shared_ptr<PdxFieldType> field1,
   }
 }
 
-PdxInstanceImpl::~PdxInstanceImpl() noexcept {
-  _GEODE_SAFE_DELETE_ARRAY(m_buffer);
-}
+PdxInstanceImpl::~PdxInstanceImpl() noexcept = default;
 
 PdxInstanceImpl::PdxInstanceImpl(uint8_t* buffer, int length, int typeId,
                                  CachePerfStats& cacheStats,
                                  PdxTypeRegistry& pdxTypeRegistry,
                                  const CacheImpl& cacheImpl,
                                  bool enableTimeStatistics)
-    : m_buffer(DataInput::getBufferCopy(buffer, length)),
+    : m_buffer(DataInput::getBufferCopy(buffer, length),
+               std::default_delete<uint8_t[]>()),
       m_bufferLength(length),
       m_typeId(typeId),
       m_pdxType(nullptr),
       m_cacheStats(cacheStats),
       m_pdxTypeRegistry(pdxTypeRegistry),
       m_cacheImpl(cacheImpl),
-      m_enableTimeStatistics(enableTimeStatistics) {
+      m_enableTimeStatistics(enableTimeStatistics),
+      m_hashCode(NoHashCode) {
   LOGDEBUG("PdxInstanceImpl::m_bufferLength = %d ", m_bufferLength);
 }
 
@@ -93,7 +111,8 @@ PdxInstanceImpl::PdxInstanceImpl(FieldVsValues fieldVsValue,
       m_cacheStats(cacheStats),
       m_pdxTypeRegistry(pdxTypeRegistry),
       m_cacheImpl(cacheImpl),
-      m_enableTimeStatistics(enableTimeStatistics) {
+      m_enableTimeStatistics(enableTimeStatistics),
+      m_hashCode(NoHashCode) {
   m_pdxType->InitializeType();  // to generate static position map
 }
 
@@ -256,7 +275,7 @@ std::shared_ptr<WritablePdxInstance> PdxInstanceImpl::createWriter() {
   LOGDEBUG("PdxInstanceImpl::createWriter m_bufferLength = %d m_typeId = %d ",
            m_bufferLength, m_typeId);
   return std::make_shared<PdxInstanceImpl>(
-      m_buffer, m_bufferLength, m_typeId, m_cacheStats, m_pdxTypeRegistry,
+      m_buffer.get(), m_bufferLength, m_typeId, m_cacheStats, m_pdxTypeRegistry,
       m_cacheImpl,
       m_enableTimeStatistics);  // need to create duplicate byte stream);
 }
@@ -641,13 +660,18 @@ int PdxInstanceImpl::deepArrayHashCode(std::shared_ptr<Cacheable> obj) {
 }
 
 int32_t PdxInstanceImpl::hashcode() const {
+  auto cachedHashCode = m_hashCode.load(std::memory_order_relaxed);
+  if (cachedHashCode != NoHashCode) {
+    return static_cast<int32_t>(cachedHashCode);
+  }
+
   int hashCode = 1;
 
   auto pt = getPdxType();
 
   auto pdxIdentityFieldList = getIdentityPdxFields(pt);
 
-  auto dataInput = m_cacheImpl.createDataInput(m_buffer, m_bufferLength);
+  auto dataInput = m_cacheImpl.createDataInput(m_buffer.get(), m_bufferLength);
 
   for (uint32_t i = 0; i < pdxIdentityFieldList.size(); i++) {
     auto pField = pdxIdentityFieldList.at(i);
@@ -705,13 +729,160 @@ int32_t PdxInstanceImpl::hashcode() const {
       }
     }
   }
+  m_hashCode.store(hashCode, std::memory_order_relaxed);
   return hashCode;
 }
 
-void PdxInstanceImpl::updatePdxStream(uint8_t* newPdxStream, int len) {
-  m_buffer = DataInput::getBufferCopy(newPdxStream, len);
+void PdxInstanceImpl::updatePdxStream(const uint8_t* newPdxStream, int len) {
+  m_hashCode.store(NoHashCode, std::memory_order_relaxed);
+  // views read from the replaced stream share it and keep it alive
+  m_buffer.reset(DataInput::getBufferCopy(newPdxStream, len),
+                 std::default_delete<uint8_t[]>());
   m_bufferLength = len;
 }
+
+bool PdxInstanceImpl::writePatchedPdxStream(DataOutput& output) {
+  if (m_buffer == nullptr || m_typeId == 0) {
+    return false;
+  }
+  auto pt = getPdxType();
+  if (pt == nullptr) {
+    return false;
+  }
+  if (!m_updatedFields.empty()) {
+    applyUpdatedFields(pt);
+  }
+
+  output.writeInt(static_cast<int32_t>(m_bufferLength));
+  output.writeInt(static_cast<int32_t>(m_typeId));
+  output.writeBytesOnly(m_buffer.get(), m_bufferLength);
+  return true;
+}
+
+void PdxInstanceImpl::applyUpdatedFields(std::shared_ptr<PdxType> pt) {
+  struct FieldUpdate {
+    int fieldIndex;
+    int start;
+    int end;
+    size_t valueStart;
+    size_t valueEnd;
+  };
+
+  auto dataInput = m_cacheImpl.createDataInput(m_buffer.get(), m_bufferLength);
+  auto pdxFieldList = pt->getPdxFieldTypes();
+  auto fieldCount = static_cast<int>(pdxFieldList->size());
+
+  // Serialize the new values one after the other into a scratch buffer,
+  // remembering which bytes of the current stream each of them replaces.
+  auto values = m_cacheImpl.createDataOutput();
+  auto valueWriter =
+      PdxLocalWriter(values, pt, m_pdxTypeRegistry.shared_from_this());
+  std::vector<FieldUpdate> updates;
+  bool sameSize = true;
+  for (int i = 0; i < fieldCount; i++) {
+    auto& currPf = pdxFieldList->at(i);
+    auto&& iter = m_updatedFields.find(currPf->getFieldName());
+    if (iter == m_updatedFields.end() || iter->second == nullptr) {
+      continue;
+    }
+    auto valueStart = values.getBufferLength();
+    writeField(valueWriter, currPf->getFieldName(), currPf->getTypeId(),
+               iter->second);
+    auto valueEnd = values.getBufferLength();
+    int start = getOffset(dataInput, pt, currPf->getSequenceId());
+    int end = getNextFieldPosition(dataInput, i + 1, pt);
+    updates.push_back({i, start, end, valueStart, valueEnd});
+    sameSize =
+        sameSize && static_cast<size_t>(end - start) == valueEnd - valueStart;
+  }
+  m_updatedFields.clear();
+
+  if (updates.empty()) {
+    return;
+  }
+
+  // Values that keep their width are overwritten in place, leaving the
+  // offset table as it is. A stream still shared with views is copied
+  // first, so that they keep reading the values they were created for.
+  if (sameSize) {
+    if (m_buffer.use_count() > 1) {
+      updatePdxStream(m_buffer.get(), m_bufferLength);
+    }
+    m_hashCode.store(NoHashCode, std::memory_order_relaxed);
+    for (const auto& update : updates) {
+      std::memcpy(m_buffer.get() + update.start,
+                  values.getBuffer() + update.valueStart,
+                  update.valueEnd - update.valueStart);
+    }
+    return;
+  }
+
+  // Otherwise splice the new values between the unchanged runs of the
+  // stream and rebuild the offset table for the shifted fields.
+  auto spliced = m_cacheImpl.createDataOutput();
+  std::vector<int32_t> offsets;
+  size_t nextUpdate = 0;
+  int copiedTo = 0;
+  int shift = 0;
+  for (int i = 0; i < fieldCount; i++) {
+    auto& currPf = pdxFieldList->at(i);
+    if (nextUpdate < updates.size() && updates[nextUpdate].fieldIndex == i) {
+      const auto& update = updates[nextUpdate++];
+      if (currPf->IsVariableLengthType()) {
+        offsets.push_back(update.start + shift);
+      }
+      auto valueLength = update.valueEnd - update.valueStart;
+      spliced.writeBytesOnly(m_buffer.get() + copiedTo, update.start - copiedTo);
+      spliced.writeBytesOnly(values.getBuffer() + update.valueStart,
+                             valueLength);
+      copiedTo = update.end;
+      shift += static_cast<int>(valueLength) - (update.end - update.start);
+    } else if (currPf->IsVariableLengthType()) {
+      offsets.push_back(getOffset(dataInput, pt, currPf->getSequenceId()) +
+                        shift);
+    }
+  }
+  int serializedLength = getSerializedLength(dataInput, pt);
+  spliced.writeBytesOnly(m_buffer.get() + copiedTo, serializedLength - copiedTo);
+
+  // Same offset width rules as PdxLocalWriter::calculateLenWithOffsets.
+  auto fieldsLength = static_cast<int32_t>(spliced.getBufferLength());
+  auto totalOffsets =
+      static_cast<int32_t>(offsets.empty() ? 0 : offsets.size() - 1);
+  if (fieldsLength + totalOffsets <= 0xff) {
+    for (auto i = totalOffsets; i > 0; i--) {
+      spliced.write(static_cast<uint8_t>(offsets[i]));
+    }
+  } else if (fieldsLength + 2 * totalOffsets <= 0xffff) {
+    for (auto i = totalOffsets; i > 0; i--) {
+      spliced.writeInt(static_cast<uint16_t>(offsets[i]));
+    }
+  } else {
+    for (auto i = totalOffsets; i > 0; i--) {
+      spliced.writeInt(static_cast<uint32_t>(offsets[i]));
+    }
+  }
+
+  updatePdxStream(spliced.getBuffer(),
+                  static_cast<int>(spliced.getBufferLength()));
+}
+void PdxInstanceImpl::getSerializedFields(
+    std::vector<std::vector<uint8_t>>& fieldBytes) const {
+  if (m_buffer == nullptr) {
+    throw IllegalStateException("PdxInstance is not serialized yet");
+  }
+  auto pt = getPdxType();
+  auto dataInput = m_cacheImpl.createDataInput(m_buffer.get(), m_bufferLength);
+  auto fieldCount = pt->getTotalFields();
+  fieldBytes.resize(fieldCount);
+  int start = 0;
+  for (int i = 0; i < fieldCount; i++) {
+    int end = getNextFieldPosition(dataInput, i + 1, pt);
+    fieldBytes[i].assign(m_buffer.get() + start, m_buffer.get() + end);
+    start = end;
+  }
+}
+
 std::shared_ptr<PdxType> PdxInstanceImpl::getPdxType() const {
   if (m_typeId == 0) {
     if (m_pdxType == nullptr) {
@@ -738,6 +909,196 @@ bool PdxInstanceImpl::hasField(const std::string& fieldname) {
   return (pft != nullptr);
 }
 
+PdxFieldHandle PdxInstanceImpl::getFieldHandle(
+    const std::string& fieldname) const {
+  auto pt = getPdxType();
+  auto pft = pt->getPdxField(fieldname);
+
+  if (!pft) {
+    throw IllegalStateException("PdxInstance doesn't have field " + fieldname);
+  }
+
+  return PdxFieldHandle(fieldname, m_typeId, pft->getTypeId(),
+                        pft->IsVariableLengthType(),
+                        pft->getVarLenOffsetIndex(), pft->getRelativeOffset(),
+                        pt->getNumberOfVarLenFields());
+}
+
+bool PdxInstanceImpl::getBooleanField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::BOOLEAN, 1)) {
+    return *position == 1;
+  }
+  return getBooleanField(field.getFieldName());
+}
+
+int8_t PdxInstanceImpl::getByteField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::BYTE, 1)) {
+    return static_cast<int8_t>(*position);
+  }
+  return getByteField(field.getFieldName());
+}
+
+int16_t PdxInstanceImpl::getShortField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::SHORT, 2)) {
+    return readBigEndian<int16_t>(position);
+  }
+  return getShortField(field.getFieldName());
+}
+
+int32_t PdxInstanceImpl::getIntField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::INT, 4)) {
+    return readBigEndian<int32_t>(position);
+  }
+  return getIntField(field.getFieldName());
+}
+
+int64_t PdxInstanceImpl::getLongField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::LONG, 8)) {
+    return readBigEndian<int64_t>(position);
+  }
+  return getLongField(field.getFieldName());
+}
+
+float PdxInstanceImpl::getFloatField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::FLOAT, 4)) {
+    auto bits = readBigEndian<uint32_t>(position);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  return getFloatField(field.getFieldName());
+}
+
+double PdxInstanceImpl::getDoubleField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::DOUBLE, 8)) {
+    auto bits = readBigEndian<uint64_t>(position);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  return getDoubleField(field.getFieldName());
+}
+
+char16_t PdxInstanceImpl::getCharField(const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::CHAR, 2)) {
+    return readBigEndian<char16_t>(position);
+  }
+  return getCharField(field.getFieldName());
+}
+
+std::string PdxInstanceImpl::getStringField(
+    const PdxFieldHandle& field) const {
+  if (auto position = getFieldPosition(field, PdxFieldTypes::STRING, 1)) {
+    auto dataInput = m_cacheImpl.createDataInput(
+        position, static_cast<size_t>(m_buffer.get() + m_bufferLength - position));
+    return dataInput.readString();
+  }
+  return getStringField(field.getFieldName());
+}
+
+PdxStringView PdxInstanceImpl::getStringView(
+    const PdxFieldHandle& field) const {
+  auto position = getViewPosition(field, PdxFieldTypes::STRING);
+  auto dataInput = m_cacheImpl.createDataInput(
+      position, static_cast<size_t>(m_buffer.get() + m_bufferLength - position));
+
+  size_t length = 0;
+  switch (static_cast<DSCode>(dataInput.read())) {
+    case DSCode::CacheableNullString:
+      return PdxStringView();
+    case DSCode::CacheableASCIIString:
+      length = static_cast<uint16_t>(dataInput.readInt16());
+      break;
+    case DSCode::CacheableASCIIStringHuge:
+      length = static_cast<uint32_t>(dataInput.readInt32());
+      break;
+    case DSCode::CacheableString: {
+      // Java's modified UTF-8 only differs from UTF-8 in how it encodes NUL
+      // and supplementary characters, which start with 0xC0 and 0xED.
+      length = static_cast<uint16_t>(dataInput.readInt16());
+      auto chars = dataInput.currentBufferPosition();
+      if (dataInput.getBytesRemaining() >= length &&
+          std::memchr(chars, 0xC0, length) == nullptr &&
+          std::memchr(chars, 0xED, length) == nullptr) {
+        break;
+      }
+      return PdxStringView(getStringField(field));
+    }
+    default:
+      return PdxStringView(getStringField(field));
+  }
+
+  if (dataInput.getBytesRemaining() < length) {
+    throw OutOfRangeException("PdxInstance field " + field.getFieldName() +
+                              " lies outside of the serialized stream");
+  }
+  return PdxStringView(
+      reinterpret_cast<const char*>(dataInput.currentBufferPosition()),
+      length, m_buffer);
+}
+
+template <class T>
+PdxArrayView<T> PdxInstanceImpl::getArrayView(const PdxFieldHandle& field,
+                                              PdxFieldTypes fieldType) const {
+  auto position = getViewPosition(field, fieldType);
+  auto dataInput = m_cacheImpl.createDataInput(
+      position, static_cast<size_t>(m_buffer.get() + m_bufferLength - position));
+
+  auto length = dataInput.readArrayLength();
+  if (length <= 0) {
+    return PdxArrayView<T>();
+  }
+  if (dataInput.getBytesRemaining() / sizeof(T) <
+      static_cast<size_t>(length)) {
+    throw OutOfRangeException("PdxInstance field " + field.getFieldName() +
+                              " lies outside of the serialized stream");
+  }
+  return PdxArrayView<T>(dataInput.currentBufferPosition(),
+                         static_cast<size_t>(length), m_buffer);
+}
+
+PdxArrayView<int8_t> PdxInstanceImpl::getByteArrayView(
+    const PdxFieldHandle& field) const {
+  return getArrayView<int8_t>(field, PdxFieldTypes::BYTE_ARRAY);
+}
+
+PdxArrayView<int16_t> PdxInstanceImpl::getShortArrayView(
+    const PdxFieldHandle& field) const {
+  return getArrayView<int16_t>(field, PdxFieldTypes::SHORT_ARRAY);
+}
+
+PdxArrayView<int32_t> PdxInstanceImpl::getIntArrayView(
+    const PdxFieldHandle& field) const {
+  return getArrayView<int32_t>(field, PdxFieldTypes::INT_ARRAY);
+}
+
+PdxArrayView<int64_t> PdxInstanceImpl::getLongArrayView(
+    const PdxFieldHandle& field) const {
+  return getArrayView<int64_t>(field, PdxFieldTypes::LONG_ARRAY);
+}
+
+PdxArrayView<float> PdxInstanceImpl::getFloatArrayView(
+    const PdxFieldHandle& field) const {
+  return getArrayView<float>(field, PdxFieldTypes::FLOAT_ARRAY);
+}
+
+PdxArrayView<double> PdxInstanceImpl::getDoubleArrayView(
+    const PdxFieldHandle& field) const {
+  return getArrayView<double>(field, PdxFieldTypes::DOUBLE_ARRAY);
+}
+
+const uint8_t* PdxInstanceImpl::getViewPosition(
+    const PdxFieldHandle& field, PdxFieldTypes fieldType) const {
+  if (m_buffer == nullptr || m_typeId == 0) {
+    throw IllegalStateException("PdxInstance field " + field.getFieldName() +
+                                " can't be viewed before it is serialized");
+  }
+  if (auto position = getFieldPosition(field, fieldType, 1)) {
+    return position;
+  }
+  return getFieldPosition(getFieldHandle(field.getFieldName()), fieldType, 1);
+}
+
 bool PdxInstanceImpl::getBooleanField(const std::string& fieldname) const {
   auto dataInput = getDataInputForField(fieldname);
   return dataInput.readBoolean();
@@ -1060,7 +1421,7 @@ std::string PdxInstanceImpl::toString() const {
 }
 
 std::shared_ptr<PdxSerializable> PdxInstanceImpl::getObject() {
-  auto dataInput = m_cacheImpl.createDataInput(m_buffer, m_bufferLength);
+  auto dataInput = m_cacheImpl.createDataInput(m_buffer.get(), m_bufferLength);
   int64_t sampleStartNanos =
       m_enableTimeStatistics ? Utils::startStatOpTime() : 0;
   //[ToDo] do we have to call incPdxDeSerialization here?
@@ -1127,15 +1488,26 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
     return false;
   }
 
+  // With the same type on both sides identity fields line up one to one and
+  // identical streams need no field by field comparison.
+  bool sameType = m_typeId != 0 && m_typeId == otherPdx->m_typeId;
+  if (sameType && m_buffer != nullptr && otherPdx->m_buffer != nullptr &&
+      m_bufferLength == otherPdx->m_bufferLength &&
+      std::memcmp(m_buffer.get(), otherPdx->m_buffer.get(), m_bufferLength) == 0) {
+    return true;
+  }
+
   auto myPdxIdentityFieldList = getIdentityPdxFields(myPdxType);
   auto otherPdxIdentityFieldList = otherPdx->getIdentityPdxFields(otherPdxType);
 
-  equatePdxFields(myPdxIdentityFieldList, otherPdxIdentityFieldList);
-  equatePdxFields(otherPdxIdentityFieldList, myPdxIdentityFieldList);
+  if (!sameType) {
+    equatePdxFields(myPdxIdentityFieldList, otherPdxIdentityFieldList);
+    equatePdxFields(otherPdxIdentityFieldList, myPdxIdentityFieldList);
+  }
 
-  auto myDataInput = m_cacheImpl.createDataInput(m_buffer, m_bufferLength);
+  auto myDataInput = m_cacheImpl.createDataInput(m_buffer.get(), m_bufferLength);
   auto otherDataInput =
-      m_cacheImpl.createDataInput(otherPdx->m_buffer, otherPdx->m_bufferLength);
+      m_cacheImpl.createDataInput(otherPdx->m_buffer.get(), otherPdx->m_bufferLength);
 
   PdxFieldTypes fieldTypeId;
   for (size_t i = 0; i < myPdxIdentityFieldList.size(); i++) {
@@ -1182,6 +1554,13 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
         break;
       }
       case PdxFieldTypes::OBJECT: {
+        // Equal bytes are equal objects; only different bytes need the
+        // objects themselves compared.
+        if (sameType &&
+            compareRawBytes(*otherPdx, myPdxType, myPFT, myDataInput,
+                            otherPdxType, otherPFT, otherDataInput)) {
+          break;
+        }
         std::shared_ptr<Cacheable> object = nullptr;
         std::shared_ptr<Cacheable> otherObject = nullptr;
         if (!myPFT->equals(m_DefaultPdxFieldType)) {
@@ -1205,6 +1584,11 @@ bool PdxInstanceImpl::operator==(const CacheableKey& other) const {
         break;
       }
       case PdxFieldTypes::OBJECT_ARRAY: {
+        if (sameType &&
+            compareRawBytes(*otherPdx, myPdxType, myPFT, myDataInput,
+                            otherPdxType, otherPFT, otherDataInput)) {
+          break;
+        }
         auto otherObjectArray = CacheableObjectArray::create();
         auto objectArray = CacheableObjectArray::create();
 
@@ -1246,27 +1630,21 @@ bool PdxInstanceImpl::compareRawBytes(PdxInstanceImpl& other,
     int pos = getOffset(myDataInput, myPT, myF->getSequenceId());
     int nextpos =
         getNextFieldPosition(myDataInput, myF->getSequenceId() + 1, myPT);
-    myDataInput.reset();
-    myDataInput.advanceCursor(pos);
 
     int otherPos =
         other.getOffset(otherDataInput, otherPT, otherF->getSequenceId());
     int otherNextpos = other.getNextFieldPosition(
         otherDataInput, otherF->getSequenceId() + 1, otherPT);
-    otherDataInput.reset();
-    otherDataInput.advanceCursor(otherPos);
 
     if ((nextpos - pos) != (otherNextpos - otherPos)) {
       return false;
     }
 
-    for (int i = pos; i < nextpos; i++) {
-      if (myDataInput.read() != otherDataInput.read()) {
-        return false;
-      }
-    }
-
-    return true;
+    myDataInput.reset();
+    otherDataInput.reset();
+    return std::memcmp(myDataInput.currentBufferPosition() + pos,
+                       otherDataInput.currentBufferPosition() + otherPos,
+                       nextpos - pos) == 0;
   } else {
     if (myF->equals(m_DefaultPdxFieldType)) {
       int otherPos =
@@ -1336,7 +1714,7 @@ void PdxInstanceImpl::toDataMutable(PdxWriter& writer) {
   int nextFieldPosition = 0;
   if (m_buffer != nullptr) {
     uint8_t* copy = apache::geode::client::DataInput::getBufferCopy(
-        m_buffer, m_bufferLength);
+        m_buffer.get(), m_bufferLength);
     auto dataInput = m_cacheImpl.createDataInput(copy, m_bufferLength);
     for (size_t i = 0; i < pdxFieldList->size(); i++) {
       auto currPf = pdxFieldList->at(i);
@@ -1478,13 +1856,11 @@ int PdxInstanceImpl::getRawHashCode(std::shared_ptr<PdxType> pt,
   }
 
   dataInput.reset();
-  dataInput.advanceCursor(nextpos - 1);
+  auto bytes = dataInput.currentBufferPosition();
 
   int h = 1;
   for (int i = nextpos - 1; i >= pos; i--) {
-    h = 31 * h + static_cast<int>(dataInput.read());
-    dataInput.reset();
-    dataInput.advanceCursor(i - 1);
+    h = 31 * h + static_cast<int8_t>(bytes[i]);
   }
   LOGDEBUG("getRawHashCode nbytes = %d, final hashcode = %d ", (nextpos - pos),
            h);
@@ -1535,14 +1911,8 @@ bool PdxInstanceImpl::compareDefaultBytes(DataInput& dataInput, int start,
   if ((end - start) != length) return false;
 
   dataInput.reset();
-  dataInput.advanceCursor(start);
-  int j = 0;
-  for (int i = start; i < end; i++) {
-    if (defaultBytes[j++] != dataInput.read()) {
-      return false;
-    }
-  }
-  return true;
+  return std::memcmp(dataInput.currentBufferPosition() + start, defaultBytes,
+                     length) == 0;
 }
 
 bool PdxInstanceImpl::hasDefaultBytes(std::shared_ptr<PdxFieldType> pField,
@@ -1969,7 +2339,7 @@ DataInput PdxInstanceImpl::getDataInputForField(
     throw IllegalStateException("PdxInstance doesn't have field " + fieldname);
   }
 
-  auto dataInput = m_cacheImpl.createDataInput(m_buffer, m_bufferLength);
+  auto dataInput = m_cacheImpl.createDataInput(m_buffer.get(), m_bufferLength);
   auto pos = getOffset(dataInput, pt, pft->getSequenceId());
 
   dataInput.reset();
@@ -1978,6 +2348,64 @@ DataInput PdxInstanceImpl::getDataInputForField(
   return dataInput;
 }
 
+const uint8_t* PdxInstanceImpl::getFieldPosition(const PdxFieldHandle& field,
+                                                 PdxFieldTypes fieldType,
+                                                 int size) const {
+  if (field.m_fieldType != fieldType) {
+    throw IllegalStateException("PdxInstance field " + field.m_fieldName +
+                                " is not of the requested type");
+  }
+  if (m_typeId == 0 || field.m_pdxTypeId != m_typeId) {
+    return nullptr;
+  }
+
+  return locateField(field, m_buffer.get(), m_bufferLength, size);
+}
+
+const uint8_t* PdxInstanceImpl::locateField(const PdxFieldHandle& field,
+                                            const uint8_t* stream,
+                                            int32_t length, int size) {
+  // Same layout rules as getOffset, with the field's position in the type
+  // taken from the handle instead of the PdxType.
+  int offsetSize = 4;
+  if (length <= 0xff) {
+    offsetSize = 1;
+  } else if (length <= 0xffff) {
+    offsetSize = 2;
+  }
+
+  int serializedLength = length;
+  if (field.m_numberOfVarLenFields > 0) {
+    serializedLength -= (field.m_numberOfVarLenFields - 1) * offsetSize;
+  }
+
+  auto readOffset = [&]() {
+    return PdxHelper::readInt(
+        const_cast<uint8_t*>(stream) + serializedLength +
+            (field.m_numberOfVarLenFields - field.m_varLenOffsetIndex - 1) *
+                offsetSize,
+        offsetSize);
+  };
+
+  int position;
+  if (field.m_isVariableLength) {
+    position = field.m_varLenOffsetIndex == -1 ? field.m_relativeOffset
+                                               : readOffset();
+  } else if (field.m_relativeOffset >= 0) {
+    position = field.m_relativeOffset;
+  } else if (field.m_varLenOffsetIndex == -1) {
+    position = serializedLength + field.m_relativeOffset;
+  } else {
+    position = readOffset() + field.m_relativeOffset;
+  }
+
+  if (position < 0 || position + size > serializedLength) {
+    throw OutOfRangeException("PdxInstance field " + field.m_fieldName +
+                              " lies outside of the serialized stream");
+  }
+  return stream + position;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
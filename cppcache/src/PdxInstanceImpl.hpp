@@ -20,7 +20,9 @@
 #ifndef GEODE_PDXINSTANCEIMPL_H_
 #define GEODE_PDXINSTANCEIMPL_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <geode/PdxFieldTypes.hpp>
@@ -46,6 +48,9 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   virtual bool hasField(const std::string& fieldname) override;
 
+  virtual PdxFieldHandle getFieldHandle(
+      const std::string& fieldname) const override;
+
   virtual bool getBooleanField(const std::string& fieldname) const override;
 
   virtual int8_t getByteField(const std::string& fieldname) const override;
@@ -65,6 +70,46 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   virtual std::string getStringField(
       const std::string& fieldName) const override;
 
+  virtual bool getBooleanField(const PdxFieldHandle& field) const override;
+
+  virtual int8_t getByteField(const PdxFieldHandle& field) const override;
+
+  virtual int16_t getShortField(const PdxFieldHandle& field) const override;
+
+  virtual int32_t getIntField(const PdxFieldHandle& field) const override;
+
+  virtual int64_t getLongField(const PdxFieldHandle& field) const override;
+
+  virtual float getFloatField(const PdxFieldHandle& field) const override;
+
+  virtual double getDoubleField(const PdxFieldHandle& field) const override;
+
+  virtual char16_t getCharField(const PdxFieldHandle& field) const override;
+
+  virtual std::string getStringField(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxStringView getStringView(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxArrayView<int8_t> getByteArrayView(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxArrayView<int16_t> getShortArrayView(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxArrayView<int32_t> getIntArrayView(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxArrayView<int64_t> getLongArrayView(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxArrayView<float> getFloatArrayView(
+      const PdxFieldHandle& field) const override;
+
+  virtual PdxArrayView<double> getDoubleArrayView(
+      const PdxFieldHandle& field) const override;
+
   virtual std::vector<bool> getBooleanArrayField(
       const std::string& fieldname) const override;
 
@@ -194,6 +239,12 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   void setPdxId(int32_t typeId);
 
+  /**
+   * @return the id of the PDX type of this instance, 0 until it is assigned
+   * to an instance created through PdxInstanceFactory.
+   */
+  int32_t getPdxTypeId() const { return m_typeId; }
+
  public:
   /**
    * @brief constructors
@@ -213,10 +264,51 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   std::shared_ptr<PdxType> getPdxType() const;
 
-  void updatePdxStream(uint8_t* newPdxStream, int len);
+  /**
+   * Replaces the serialized stream by a copy of newPdxStream. The replaced
+   * stream is not modified, and lives on for as long as views share it.
+   */
+  void updatePdxStream(const uint8_t* newPdxStream, int len);
+
+  /**
+   * Writes this instance, header included, from its serialized stream with
+   * the updated fields patched into it, rather than field by field through a
+   * PdxWriter.
+   * @return false if the instance has no serialized stream yet and has to be
+   * written through toData.
+   */
+  bool writePatchedPdxStream(DataOutput& output);
+
+  /**
+   * Copies the serialized bytes of each field into fieldBytes, in field
+   * order.
+   * @throws IllegalStateException if the instance has no serialized stream.
+   */
+  void getSerializedFields(
+      std::vector<std::vector<uint8_t>>& fieldBytes) const;
+
+  /**
+   * @return the serialized stream, nullptr until there is one. Sharing it
+   * keeps the bytes valid after the instance is modified.
+   */
+  std::shared_ptr<const uint8_t> getPdxStream() const { return m_buffer; }
+
+  int32_t getPdxStreamLength() const { return m_bufferLength; }
+
+  /**
+   * Locates the field referred to by the handle in a serialized stream of
+   * the handle's PDX type, using only the offsets captured in the handle.
+   * @throws OutOfRangeException if size bytes at the position don't fit in
+   * the stream.
+   */
+  static const uint8_t* locateField(const PdxFieldHandle& field,
+                                    const uint8_t* stream, int32_t length,
+                                    int size);
 
  private:
-  uint8_t* m_buffer;
+  // Shared with the views of its fields. Modifying the instance replaces
+  // it, unless no view shares it.
+  std::shared_ptr<uint8_t> m_buffer;
   int m_bufferLength;
   int m_typeId;
   std::shared_ptr<PdxType> m_pdxType;
@@ -226,6 +318,10 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
   const CacheImpl& m_cacheImpl;
   bool m_enableTimeStatistics;
 
+  // Hash of the identity fields of m_buffer, or a value outside of the int32
+  // range until it is first computed.
+  mutable std::atomic<int64_t> m_hashCode;
+
   std::vector<std::shared_ptr<PdxFieldType>> getIdentityPdxFields(
       std::shared_ptr<PdxType> pt) const;
 
@@ -270,6 +366,8 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   void toDataMutable(PdxWriter& output);
 
+  void applyUpdatedFields(std::shared_ptr<PdxType> pt);
+
   static int deepArrayHashCode(std::shared_ptr<Cacheable> obj);
 
   static int enumerateMapHashCode(std::shared_ptr<CacheableHashMap> map);
@@ -323,6 +421,26 @@ class APACHE_GEODE_EXPORT PdxInstanceImpl : public WritablePdxInstance {
 
   DataInput getDataInputForField(const std::string& fieldname) const;
 
+  /**
+   * Locates the field referred to by the handle in the serialized stream
+   * using only the offsets captured in the handle. Returns nullptr when the
+   * handle was resolved against another PDX type, in which case the caller
+   * has to fall back to the name based lookup.
+   */
+  const uint8_t* getFieldPosition(const PdxFieldHandle& field,
+                                  PdxFieldTypes fieldType, int size) const;
+
+  /**
+   * Locates a variable length field for a view into the serialized stream,
+   * resolving the handle again if it was resolved against another PDX type.
+   */
+  const uint8_t* getViewPosition(const PdxFieldHandle& field,
+                                 PdxFieldTypes fieldType) const;
+
+  template <class T>
+  PdxArrayView<T> getArrayView(const PdxFieldHandle& field,
+                               PdxFieldTypes fieldType) const;
+
   static int8_t m_BooleanDefaultBytes[];
   static int8_t m_ByteDefaultBytes[];
   static int8_t m_CharDefaultBytes[];
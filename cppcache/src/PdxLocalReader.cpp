@@ -22,7 +22,10 @@
 
 #include "PdxLocalReader.hpp"
 
+#include <geode/TypeRegistry.hpp>
+
 #include "PdxTypeRegistry.hpp"
+#include "util/Log.hpp"
 
 namespace apache {
 namespace geode {
@@ -202,8 +205,7 @@ std::shared_ptr<CacheableDate> PdxLocalReader::readDate(const std::string&) {
 }
 
 std::shared_ptr<PdxRemotePreservedData> PdxLocalReader::getPreservedData(
-    std::shared_ptr<PdxType> mergedVersion,
-    std::shared_ptr<PdxSerializable> pdxObject) {
+    std::shared_ptr<PdxType> mergedVersion) {
   int nFieldExtra = m_pdxType->getNumberOfExtraFields();
   LOGDEBUG(
       "PdxLocalReader::getPreservedData::nFieldExtra = %d AND "
@@ -213,7 +215,7 @@ std::shared_ptr<PdxRemotePreservedData> PdxLocalReader::getPreservedData(
       m_pdxTypeRegistry->getPdxIgnoreUnreadFields() == false) {
     m_pdxRemotePreserveData->initialize(
         m_pdxType != nullptr ? m_pdxType->getTypeId() : 0,
-        mergedVersion->getTypeId(), pdxObject);
+        mergedVersion->getTypeId());
     LOGDEBUG("PdxLocalReader::getPreservedData - 1");
 
     m_localToRemoteMap = m_pdxType->getLocalToRemoteMap();
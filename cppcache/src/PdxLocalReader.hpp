@@ -62,8 +62,7 @@ class PdxLocalReader : public PdxReader {
   void moveStream();
 
   virtual std::shared_ptr<PdxRemotePreservedData> getPreservedData(
-      std::shared_ptr<PdxType> mergedVersion,
-      std::shared_ptr<PdxSerializable> pdxObject);
+      std::shared_ptr<PdxType> mergedVersion);
 
   virtual char16_t readChar(const std::string &fieldName) override;
 
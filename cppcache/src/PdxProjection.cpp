@@ -0,0 +1,53 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PdxProjection.hpp>
+
+#include <geode/PdxInstance.hpp>
+
+#include "PdxInstanceImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+PdxProjection::PdxProjection(std::vector<std::string> fieldNames)
+    : m_fieldNames(std::move(fieldNames)), m_pdxTypeId(0) {}
+
+const std::vector<PdxFieldHandle>& PdxProjection::getFieldHandles(
+    const PdxInstance& instance) {
+  // Instances created through PdxInstanceFactory have no type id until they
+  // are serialized, so their handles are never reused.
+  auto instanceImpl = dynamic_cast<const PdxInstanceImpl*>(&instance);
+  auto pdxTypeId = instanceImpl ? instanceImpl->getPdxTypeId() : 0;
+  if (pdxTypeId != 0 && pdxTypeId == m_pdxTypeId) {
+    return m_fieldHandles;
+  }
+
+  std::vector<PdxFieldHandle> fieldHandles;
+  fieldHandles.reserve(m_fieldNames.size());
+  for (const auto& fieldName : m_fieldNames) {
+    fieldHandles.push_back(instance.getFieldHandle(fieldName));
+  }
+  m_fieldHandles = std::move(fieldHandles);
+  m_pdxTypeId = pdxTypeId;
+  return m_fieldHandles;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
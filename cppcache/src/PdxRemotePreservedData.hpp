@@ -23,72 +23,34 @@
 #include <vector>
 
 #include <geode/PdxUnreadFields.hpp>
-#include <geode/Serializable.hpp>
-
-#include "ExpiryTaskManager.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
-class PdxRemotePreservedData;
 
+/**
+ * Fields of a newer remote version of a PDX type that the local class did not
+ * read. Kept with the deserialized object and written back by its next
+ * serialization.
+ */
 class PdxRemotePreservedData : public PdxUnreadFields {
  private:
   std::vector<std::vector<int8_t> > m_preservedData;
   int32_t m_typeId;
   int32_t m_mergedTypeId;
-  int32_t m_currentIndex;
-  std::shared_ptr<Serializable> /*Object^*/ m_owner;
-  ExpiryTaskManager::id_type m_expiryTakId;
 
  public:
-  PdxRemotePreservedData()
-      : /* adongre  - Coverity II
-         * CID 29283: Uninitialized scalar field (UNINIT_CTOR)
-         */
-        m_typeId(0),
-        m_mergedTypeId(0),
-        m_currentIndex(0),
-        m_expiryTakId(0) {}
-
-  virtual ~PdxRemotePreservedData() {
-    /*for(int i=0;i<numberOfFields;i++)
-            delete[] m_preservedData[i];
+  PdxRemotePreservedData() : m_typeId(0), m_mergedTypeId(0) {}
 
-    delete[] m_preservedData;*/
-  }
-  PdxRemotePreservedData(int32_t typeId, int32_t mergedTypeId,
-                         std::shared_ptr<Serializable> owner) {
-    m_typeId = typeId;
-    m_mergedTypeId = mergedTypeId;
-    m_currentIndex = 0;
-    m_owner = owner;
-    m_expiryTakId = 0;
-  }
+  ~PdxRemotePreservedData() override = default;
 
-  void initialize(int32_t typeId, int32_t mergedTypeId,
-                  std::shared_ptr<Serializable> owner) {
+  void initialize(int32_t typeId, int32_t mergedTypeId) {
     m_typeId = typeId;
     m_mergedTypeId = mergedTypeId;
-    m_currentIndex = 0;
-    m_owner = owner;
-    m_expiryTakId = 0;
   }
 
   inline int32_t getMergedTypeId() { return m_mergedTypeId; }
 
-  inline void setPreservedDataExpiryTaskId(ExpiryTaskManager::id_type expId) {
-    m_expiryTakId = expId;
-  }
-
-  inline ExpiryTaskManager::id_type getPreservedDataExpiryTaskId() {
-    return m_expiryTakId;
-  }
-
-  std::shared_ptr<Serializable> getOwner() { return m_owner; }
-
-  void setOwner(std::shared_ptr<Serializable> val) { m_owner = val; }
-
   inline std::vector<int8_t> getPreservedData(int32_t idx) {
     return m_preservedData[idx];
   }
@@ -96,22 +58,6 @@ class PdxRemotePreservedData : public PdxUnreadFields {
   inline void setPreservedData(std::vector<int8_t> inputVector) {
     m_preservedData.push_back(inputVector);
   }
-
-  virtual bool equals(std::shared_ptr<Serializable> otherObject) {
-    if (otherObject == nullptr) return false;
-
-    if (m_owner == nullptr) return false;
-
-    return m_owner == otherObject;
-  }
-
-  virtual int GetHashCode() {
-    if (m_owner != nullptr) {
-      // TODO
-      return 1;  // m_owner->GetHashCode();
-    }
-    return 0;
-  }
 };
 }  // namespace client
 }  // namespace geode
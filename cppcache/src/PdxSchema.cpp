@@ -0,0 +1,178 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/PdxSchema.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "DataOutputInternal.hpp"
+#include "PdxHelper.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxTypes.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace internal {
+
+PdxSchemaSerializableBase::~PdxSchemaSerializableBase() noexcept = default;
+
+}  // namespace internal
+
+constexpr int32_t PdxSchemaLayout::PdxHeaderSize;
+
+PdxSchemaLayout::PdxSchemaLayout(std::string className)
+    : m_className(std::move(className)),
+      m_numberOfVarLenFields(0),
+      m_typeBinding(0) {}
+
+void PdxSchemaLayout::addField(std::string name, PdxFieldTypes type) {
+  for (auto&& field : m_fields) {
+    if (field.name == name) {
+      throw IllegalStateException("Field: " + name +
+                                  " is already added to PdxSchema");
+    }
+  }
+  if (type == PdxFieldTypes::STRING) {
+    m_numberOfVarLenFields++;
+  }
+  m_fields.push_back(FieldLayout{std::move(name), type});
+}
+
+int32_t PdxSchemaLayout::getTypeId(DataOutput& output) const {
+  auto pdxTypeRegistry =
+      CacheRegionHelper::getCacheImpl(output.getCache())->getPdxTypeRegistry();
+
+  // The binding packs the registry generation it was resolved in with the
+  // type id, so a cleared registry or another cache resolves it again.
+  auto generation = pdxTypeRegistry->getGeneration();
+  auto binding = m_typeBinding.load(std::memory_order_acquire);
+  if (static_cast<uint32_t>(binding >> 32) == generation) {
+    return static_cast<int32_t>(binding & 0xffffffff);
+  }
+
+  auto typeId =
+      registerType(*pdxTypeRegistry, DataOutputInternal::getPool(output));
+  m_typeBinding.store((static_cast<uint64_t>(generation) << 32) |
+                          static_cast<uint32_t>(typeId),
+                      std::memory_order_release);
+  return typeId;
+}
+
+int32_t PdxSchemaLayout::registerType(PdxTypeRegistry& pdxTypeRegistry,
+                                      Pool* pool) const {
+  if (auto localType = pdxTypeRegistry.getLocalPdxType(m_className)) {
+    auto localFields = localType->getPdxFieldTypes();
+    if (localFields->size() != m_fields.size()) {
+      return 0;
+    }
+    for (size_t i = 0; i < m_fields.size(); i++) {
+      auto&& localField = localFields->at(i);
+      if (localField->getFieldName() != m_fields[i].name ||
+          localField->getTypeId() != m_fields[i].type) {
+        return 0;
+      }
+    }
+    return localType->getTypeId();
+  }
+
+  // Same type PdxWriterWithTypeCollector would collect from toData.
+  auto pdxType = std::make_shared<PdxType>(pdxTypeRegistry, m_className, true);
+  for (auto&& field : m_fields) {
+    switch (field.type) {
+      case PdxFieldTypes::BOOLEAN:
+        pdxType->addFixedLengthTypeField(field.name, "boolean", field.type,
+                                         PdxTypes::BOOLEAN_SIZE);
+        break;
+      case PdxFieldTypes::BYTE:
+        pdxType->addFixedLengthTypeField(field.name, "byte", field.type,
+                                         PdxTypes::BYTE_SIZE);
+        break;
+      case PdxFieldTypes::SHORT:
+        pdxType->addFixedLengthTypeField(field.name, "short", field.type,
+                                         PdxTypes::SHORT_SIZE);
+        break;
+      case PdxFieldTypes::INT:
+        pdxType->addFixedLengthTypeField(field.name, "int", field.type,
+                                         PdxTypes::INTEGER_SIZE);
+        break;
+      case PdxFieldTypes::LONG:
+        pdxType->addFixedLengthTypeField(field.name, "long", field.type,
+                                         PdxTypes::LONG_SIZE);
+        break;
+      case PdxFieldTypes::FLOAT:
+        pdxType->addFixedLengthTypeField(field.name, "float", field.type,
+                                         PdxTypes::FLOAT_SIZE);
+        break;
+      case PdxFieldTypes::DOUBLE:
+        pdxType->addFixedLengthTypeField(field.name, "double", field.type,
+                                         PdxTypes::DOUBLE_SIZE);
+        break;
+      case PdxFieldTypes::CHAR:
+        pdxType->addFixedLengthTypeField(field.name, "char", field.type,
+                                         PdxTypes::CHAR_SIZE);
+        break;
+      case PdxFieldTypes::STRING:
+        pdxType->addVariableLengthTypeField(field.name, "String", field.type);
+        break;
+      default:
+        return 0;
+    }
+  }
+
+  pdxType->InitializeType();
+  auto typeId =
+      pdxTypeRegistry.getPDXIdForType(m_className, pool, pdxType, true);
+  pdxType->setTypeId(typeId);
+  pdxTypeRegistry.addLocalPdxType(m_className, pdxType);
+  pdxTypeRegistry.addPdxType(typeId, pdxType);
+  return typeId;
+}
+
+void PdxSchemaLayout::writePdxHeader(DataOutput& output, size_t startPosition,
+                                     int32_t typeId,
+                                     const int32_t* offsets) const {
+  // Same length and offset width rules as PdxLocalWriter.
+  auto bufferLen =
+      static_cast<int32_t>(output.getBufferLength() - startPosition);
+  auto totalOffsets =
+      m_numberOfVarLenFields > 0 ? m_numberOfVarLenFields - 1 : 0;
+  auto len = bufferLen - PdxHeaderSize + totalOffsets;
+  if (len > 0xff) {
+    len += len + totalOffsets <= 0xffff ? totalOffsets : totalOffsets * 3;
+  }
+
+  auto header = const_cast<uint8_t*>(output.getBuffer()) + startPosition;
+  PdxHelper::writeInt32(header, len);
+  PdxHelper::writeInt32(header + 4, typeId);
+
+  for (auto i = totalOffsets; i > 0; i--) {
+    if (len <= 0xff) {
+      output.write(static_cast<uint8_t>(offsets[i]));
+    } else if (len <= 0xffff) {
+      output.writeInt(static_cast<uint16_t>(offsets[i]));
+    } else {
+      output.writeInt(static_cast<uint32_t>(offsets[i]));
+    }
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -27,21 +27,25 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+uint32_t nextGeneration() {
+  static std::atomic<uint32_t> generation(0);
+  return ++generation;
+}
+
+}  // namespace
+
 PdxTypeRegistry::PdxTypeRegistry(CacheImpl* cache)
     : cache(cache),
-      typeIdToPdxType(),
-      remoteTypeIdToMergedPdxType(),
-      localTypeToPdxType(),
       pdxTypeToTypeIdMap(),
+      m_prefetched(false),
       enumToInt(CacheableHashMap::create()),
-      intToEnum(CacheableHashMap::create()) {}
+      intToEnum(CacheableHashMap::create()),
+      m_generation(nextGeneration()) {}
 
 PdxTypeRegistry::~PdxTypeRegistry() {}
 
-size_t PdxTypeRegistry::testNumberOfPreservedData() const {
-  return preserveData.size();
-}
-
 int32_t PdxTypeRegistry::getPDXIdForType(const std::string& type, Pool* pool,
                                          std::shared_ptr<PdxType> nType,
                                          bool checkIfThere) {
@@ -56,7 +60,14 @@ int32_t PdxTypeRegistry::getPDXIdForType(const std::string& type, Pool* pool,
     }
   }
 
-  int typeId = cache->getSerializationRegistry()->GetPDXIdForType(pool, nType);
+  int typeId;
+  {
+    ReadGuard read(g_readerWriterLock);
+    typeId = getPrefetchedTypeId(nType);
+  }
+  if (typeId == 0) {
+    typeId = cache->getSerializationRegistry()->GetPDXIdForType(pool, nType);
+  }
   nType->setTypeId(typeId);
 
   addPdxType(typeId, nType);
@@ -88,7 +99,11 @@ int32_t PdxTypeRegistry::getPDXIdForType(std::shared_ptr<PdxType> nType,
       }
     }
 
-    typeId = cache->getSerializationRegistry()->GetPDXIdForType(pool, nType);
+    typeId = getPrefetchedTypeId(nType);
+    if (typeId == 0) {
+      typeId =
+          cache->getSerializationRegistry()->GetPDXIdForType(pool, nType);
+    }
     nType->setTypeId(typeId);
     pdxTypeToTypeIdMap.insert(std::make_pair(nType, typeId));
   }
@@ -98,110 +113,108 @@ int32_t PdxTypeRegistry::getPDXIdForType(std::shared_ptr<PdxType> nType,
 }
 
 void PdxTypeRegistry::clear() {
-  {
-    WriteGuard guard(g_readerWriterLock);
-    typeIdToPdxType.clear();
+  WriteGuard guard(g_readerWriterLock);
+  typeIdToPdxType.clear();
+
+  remoteTypeIdToMergedPdxType.clear();
+
+  localTypeToPdxType.clear();
 
-    remoteTypeIdToMergedPdxType.clear();
+  if (intToEnum) intToEnum->clear();
 
-    localTypeToPdxType.clear();
+  if (enumToInt) enumToInt->clear();
 
-    if (intToEnum) intToEnum->clear();
+  pdxTypeToTypeIdMap.clear();
 
-    if (enumToInt) enumToInt->clear();
+  prefetchedTypes.clear();
+  m_prefetched = false;
 
-    pdxTypeToTypeIdMap.clear();
+  m_generation.store(nextGeneration(), std::memory_order_release);
+}
+
+int32_t PdxTypeRegistry::getPrefetchedTypeId(
+    std::shared_ptr<PdxType> nType) const {
+  // callers hold g_readerWriterLock
+  auto&& range = prefetchedTypes.equal_range(nType->getPdxClassName());
+  for (auto&& iter = range.first; iter != range.second; ++iter) {
+    if (iter->second->Equals(nType)) {
+      return iter->second->getTypeId();
+    }
   }
-  {
-    WriteGuard guard(getPreservedDataLock());
-    preserveData.clear();
+  return 0;
+}
+
+void PdxTypeRegistry::prefetchTypes(ThinClientPoolDM* pool) {
+  if (m_prefetched.exchange(true)) {
+    return;
+  }
+
+  // a failed fetch leaves prefetching to the next pool that starts
+  std::shared_ptr<CacheableHashMap> types;
+  std::shared_ptr<CacheableHashMap> enums;
+  try {
+    types = pool->GetPDXTypes();
+    enums = pool->GetPDXEnums();
+  } catch (...) {
+    m_prefetched = false;
+    throw;
   }
+
+  WriteGuard guard(g_readerWriterLock);
+  if (types) {
+    for (auto&& entry : *types) {
+      auto pdxType = std::dynamic_pointer_cast<PdxType>(entry.second);
+      if (pdxType == nullptr) continue;
+      addPdxType(pdxType->getTypeId(), pdxType);
+      prefetchedTypes.emplace(pdxType->getPdxClassName(), pdxType);
+    }
+  }
+  if (enums) {
+    for (auto&& entry : *enums) {
+      auto enumInfo = std::dynamic_pointer_cast<EnumInfo>(entry.second);
+      auto enumVal = std::dynamic_pointer_cast<CacheableInt32>(entry.first);
+      if (enumInfo == nullptr || enumVal == nullptr) continue;
+      intToEnum->emplace(enumVal, enumInfo);
+      enumToInt->emplace(enumInfo, enumVal);
+    }
+  }
+  LOGDEBUG("PdxTypeRegistry::prefetchTypes: %zu types, %zu enums",
+           prefetchedTypes.size(), enums ? enums->size() : 0);
 }
 
 void PdxTypeRegistry::addPdxType(int32_t typeId,
                                  std::shared_ptr<PdxType> pdxType) {
-  WriteGuard guard(g_readerWriterLock);
-  std::pair<int32_t, std::shared_ptr<PdxType>> pc(typeId, pdxType);
-  typeIdToPdxType.insert(pc);
+  typeIdToPdxType.emplace(typeId, std::move(pdxType));
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getPdxType(int32_t typeId) const {
-  ReadGuard guard(g_readerWriterLock);
-  auto&& iter = typeIdToPdxType.find(typeId);
-  if (iter != typeIdToPdxType.end()) {
-    return iter->second;
-  }
-  return nullptr;
+  std::shared_ptr<PdxType> pdxType;
+  typeIdToPdxType.find(typeId, pdxType);
+  return pdxType;
 }
 
 void PdxTypeRegistry::addLocalPdxType(const std::string& localType,
                                       std::shared_ptr<PdxType> pdxType) {
-  WriteGuard guard(g_readerWriterLock);
-  localTypeToPdxType.emplace(localType, pdxType);
+  localTypeToPdxType.emplace(localType, std::move(pdxType));
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getLocalPdxType(
     const std::string& localType) const {
-  ReadGuard guard(g_readerWriterLock);
-  auto&& it = localTypeToPdxType.find(localType);
-  if (it != localTypeToPdxType.end()) {
-    return it->second;
-  }
-  return nullptr;
+  std::shared_ptr<PdxType> pdxType;
+  localTypeToPdxType.find(localType, pdxType);
+  return pdxType;
 }
 
 void PdxTypeRegistry::setMergedType(int32_t remoteTypeId,
                                     std::shared_ptr<PdxType> mergedType) {
-  WriteGuard guard(g_readerWriterLock);
-  remoteTypeIdToMergedPdxType.emplace(remoteTypeId, mergedType);
+  remoteTypeIdToMergedPdxType.emplace(remoteTypeId, std::move(mergedType));
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getMergedType(
     int32_t remoteTypeId) const {
-  auto&& it = remoteTypeIdToMergedPdxType.find(remoteTypeId);
-  if (it != remoteTypeIdToMergedPdxType.end()) {
-    return it->second;
-  }
-  return nullptr;
-}
-
-void PdxTypeRegistry::setPreserveData(
-    std::shared_ptr<PdxSerializable> obj,
-    std::shared_ptr<PdxRemotePreservedData> pData,
-    ExpiryTaskManager& expiryTaskManager) {
-  WriteGuard guard(getPreservedDataLock());
-  pData->setOwner(obj);
-  if (preserveData.find(obj) != preserveData.end()) {
-    // reset expiry task
-    // TODO: check value for nullptr
-    auto expTaskId = preserveData[obj]->getPreservedDataExpiryTaskId();
-    expiryTaskManager.resetTask(expTaskId, 5);
-    LOGDEBUG("PdxTypeRegistry::setPreserveData Reset expiry task Done");
-    pData->setPreservedDataExpiryTaskId(expTaskId);
-    preserveData[obj] = pData;
-  } else {
-    // schedule new expiry task
-    auto handler = new PreservedDataExpiryHandler(shared_from_this(), obj);
-    auto id = expiryTaskManager.scheduleExpiryTask(handler, 20, 0, false);
-    pData->setPreservedDataExpiryTaskId(id);
-    LOGDEBUG(
-        "PdxTypeRegistry::setPreserveData Schedule new expirt task with id=%ld",
-        id);
-    preserveData.emplace(obj, pData);
-  }
-
-  LOGDEBUG(
-      "PdxTypeRegistry::setPreserveData Successfully inserted new entry in "
-      "preservedData");
-}
-std::shared_ptr<PdxRemotePreservedData> PdxTypeRegistry::getPreserveData(
-    std::shared_ptr<PdxSerializable> pdxobj) const {
-  ReadGuard guard(getPreservedDataLock());
-  const auto& iter = preserveData.find((pdxobj));
-  if (iter != preserveData.end()) {
-    return iter->second;
-  }
-  return nullptr;
+  std::shared_ptr<PdxType> mergedType;
+  remoteTypeIdToMergedPdxType.find(remoteTypeId, mergedType);
+  return mergedType;
 }
 
 int32_t PdxTypeRegistry::getEnumValue(std::shared_ptr<EnumInfo> ei) {
@@ -20,6 +20,7 @@
 #ifndef GEODE_PDXTYPEREGISTRY_H_
 #define GEODE_PDXTYPEREGISTRY_H_
 
+#include <atomic>
 #include <map>
 #include <unordered_map>
 
@@ -30,16 +31,16 @@
 #include <geode/internal/functional.hpp>
 
 #include "EnumInfo.hpp"
-#include "ExpiryTaskManager.hpp"
-#include "PdxRemotePreservedData.hpp"
 #include "PdxType.hpp"
-#include "PreservedDataExpiryHandler.hpp"
 #include "ReadWriteLock.hpp"
+#include "util/concurrent/append_only_map.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+class ThinClientPoolDM;
+
 struct PdxTypeLessThan {
   bool operator()(std::shared_ptr<PdxType> const& n1,
                   std::shared_ptr<PdxType> const& n2) const {
@@ -48,15 +49,17 @@ struct PdxTypeLessThan {
   }
 };
 
-typedef std::map<int32_t, std::shared_ptr<PdxType>> TypeIdVsPdxType;
-typedef std::map<std::string, std::shared_ptr<PdxType>> TypeNameVsPdxType;
-typedef std::unordered_map<std::shared_ptr<PdxSerializable>,
-                           std::shared_ptr<PdxRemotePreservedData>,
-                           dereference_hash<std::shared_ptr<CacheableKey>>,
-                           dereference_equal_to<std::shared_ptr<CacheableKey>>>
-    PreservedHashMap;
+// Type tables are read on every PDX serialization and only grow after
+// warm up, so lookups go through lock free append only maps.
+typedef util::concurrent::append_only_map<int32_t, std::shared_ptr<PdxType>>
+    TypeIdVsPdxType;
+typedef util::concurrent::append_only_map<std::string,
+                                          std::shared_ptr<PdxType>>
+    TypeNameVsPdxType;
 typedef std::map<std::shared_ptr<PdxType>, int32_t, PdxTypeLessThan>
     PdxTypeToTypeIdMap;
+typedef std::multimap<std::string, std::shared_ptr<PdxType>>
+    ClassNameVsPdxTypes;
 
 class APACHE_GEODE_EXPORT PdxTypeRegistry
     : public std::enable_shared_from_this<PdxTypeRegistry> {
@@ -71,12 +74,13 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   PdxTypeToTypeIdMap pdxTypeToTypeIdMap;
 
-  // TODO:: preserveData need to be of type WeakHashMap
-  PreservedHashMap preserveData;
+  // Every version of each class fetched by prefetchTypes, so that a type
+  // written for the first time can reuse the id the cluster already has.
+  ClassNameVsPdxTypes prefetchedTypes;
 
-  mutable ACE_RW_Thread_Mutex g_readerWriterLock;
+  std::atomic<bool> m_prefetched;
 
-  mutable ACE_RW_Thread_Mutex g_preservedDataLock;
+  mutable ACE_RW_Thread_Mutex g_readerWriterLock;
 
   bool pdxIgnoreUnreadFields;
 
@@ -86,15 +90,16 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   std::shared_ptr<CacheableHashMap> intToEnum;
 
+  std::atomic<uint32_t> m_generation;
+
+  int32_t getPrefetchedTypeId(std::shared_ptr<PdxType> nType) const;
+
  public:
   explicit PdxTypeRegistry(CacheImpl* cache);
   PdxTypeRegistry(const PdxTypeRegistry& other) = delete;
 
   virtual ~PdxTypeRegistry();
 
-  // test hook
-  size_t testNumberOfPreservedData() const;
-
   void addPdxType(int32_t typeId, std::shared_ptr<PdxType> pdxType);
 
   std::shared_ptr<PdxType> getPdxType(int32_t typeId) const;
@@ -109,15 +114,17 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   std::shared_ptr<PdxType> getMergedType(int32_t remoteTypeId) const;
 
-  void setPreserveData(std::shared_ptr<PdxSerializable> obj,
-                       std::shared_ptr<PdxRemotePreservedData> preserveDataPtr,
-                       ExpiryTaskManager& expiryTaskManager);
-
-  std::shared_ptr<PdxRemotePreservedData> getPreserveData(
-      std::shared_ptr<PdxSerializable> obj) const;
-
   void clear();
 
+  /**
+   * Identifies the contents of this registry: unique across registries and
+   * changed by every clear, so that type ids cached outside of the registry
+   * can tell when they have to be resolved again.
+   */
+  uint32_t getGeneration() const {
+    return m_generation.load(std::memory_order_acquire);
+  }
+
   int32_t getPDXIdForType(const std::string& type, Pool* pool,
                           std::shared_ptr<PdxType> nType, bool checkIfThere);
 
@@ -129,19 +136,19 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   bool getPdxReadSerialized() const { return pdxReadSerialized; }
 
-  inline const PreservedHashMap& getPreserveDataMap() const {
-    return preserveData;
-  };
-
   int32_t getEnumValue(std::shared_ptr<EnumInfo> ei);
 
   std::shared_ptr<EnumInfo> getEnum(int32_t enumVal);
 
   int32_t getPDXIdForType(std::shared_ptr<PdxType> nType, Pool* pool);
 
-  ACE_RW_Thread_Mutex& getPreservedDataLock() const {
-    return g_preservedDataLock;
-  }
+  /**
+   * Fetches all types and enums registered with the cluster in two requests,
+   * so that they are not looked up one round trip at a time as they are
+   * first read or written. Only the first successful call after a clear
+   * does anything.
+   */
+  void prefetchTypes(ThinClientPoolDM* pool);
 };
 
 }  // namespace client
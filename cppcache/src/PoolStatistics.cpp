@@ -24,6 +24,8 @@
 
 #include <ace/Singleton.h>
 
+#include "statistics/StatisticHistogram.hpp"
+#include "statistics/StatsDef.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +34,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+using statistics::StatisticHistogram;
 using statistics::StatisticsFactory;
 using statistics::StatisticsManager;
 using util::concurrent::spinlock_mutex;
@@ -43,7 +46,10 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (statsType == nullptr) {
-    auto stats = new StatisticDescriptor*[27];
+    constexpr auto statCount = 27 + 3 * StatisticHistogram::BucketCount;
+    static_assert(statCount <= MAX_DESCRIPTORS_PER_TYPE,
+                  "pool histograms exceed the descriptors of a type");
+    auto stats = new StatisticDescriptor*[statCount];
 
     stats[0] = factory->createIntGauge(
         "locators", "Current number of locators discovered", "locators");
@@ -133,7 +139,17 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
         "queryExecutionTime",
         "Total time spent while processing queryExecution", "nanoseconds");
 
-    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 27);
+    StatisticHistogram::createDescriptors(
+        factory, "connectionWaitLatency",
+        "Number of times a connection was waited for", stats + 27);
+    StatisticHistogram::createDescriptors(
+        factory, "clientOpLatency", "Number of successful client operations",
+        stats + 27 + StatisticHistogram::BucketCount);
+    StatisticHistogram::createDescriptors(
+        factory, "functionExecutionLatency",
+        "Number of successful function executions",
+        stats + 27 + 2 * StatisticHistogram::BucketCount);
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, statCount);
   }
   m_locatorsId = statsType->nameToId("locators");
   m_serversId = statsType->nameToId("servers");
@@ -163,6 +179,12 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
       statsType->nameToId("processedDeltaMessagesTime");
   m_queryExecutionsId = statsType->nameToId("queryExecutions");
   m_queryExecutionTimeId = statsType->nameToId("queryExecutionTime");
+  m_connectionWaitLatencyId =
+      StatisticHistogram::nameToId(statsType, "connectionWaitLatency");
+  m_clientOpLatencyId =
+      StatisticHistogram::nameToId(statsType, "clientOpLatency");
+  m_functionExecutionLatencyId =
+      StatisticHistogram::nameToId(statsType, "functionExecutionLatency");
 
   m_poolStats = factory->createAtomicStatistics(statsType, poolName.c_str());
 
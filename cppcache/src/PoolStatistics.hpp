@@ -23,6 +23,7 @@
 
 #include <geode/internal/geode_globals.hpp>
 
+#include "statistics/StatisticHistogram.hpp"
 #include "statistics/Statistics.hpp"
 #include "statistics/StatisticsFactory.hpp"
 #include "statistics/StatisticsManager.hpp"
@@ -127,6 +128,14 @@ class PoolStats {
   void incQueryExecutionTimeId(int64_t value) {  // counter
     getStats()->incLong(m_queryExecutionTimeId, value);
   }
+  void recordClientOpLatency(int64_t value) {  // histogram
+    statistics::StatisticHistogram::record(getStats(), m_clientOpLatencyId,
+                                           value);
+  }
+  void recordFunctionExecutionLatency(int64_t value) {  // histogram
+    statistics::StatisticHistogram::record(
+        getStats(), m_functionExecutionLatencyId, value);
+  }
   inline apache::geode::statistics::Statistics* getStats() {
     return m_poolStats;
   }
@@ -136,6 +145,10 @@ class PoolStats {
 
   inline int32_t getQueryExecutionTimeId() { return m_queryExecutionTimeId; }
 
+  inline int32_t getConnectionWaitLatencyId() {
+    return m_connectionWaitLatencyId;
+  }
+
  private:
   // volatile apache::geode::statistics::Statistics* m_poolStats;
   apache::geode::statistics::Statistics* m_poolStats;
@@ -167,6 +180,9 @@ class PoolStats {
   int32_t m_processedDeltaMessagesTimeId;
   int32_t m_queryExecutionsId;
   int32_t m_queryExecutionTimeId;
+  int32_t m_connectionWaitLatencyId;
+  int32_t m_clientOpLatencyId;
+  int32_t m_functionExecutionLatencyId;
 
   static constexpr const char* STATS_NAME = "PoolStatistics";
   static constexpr const char* STATS_DESC = "Statistics for this pool";
@@ -0,0 +1,64 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PreparedFunction.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+constexpr uint8_t PreparedFunction::IS_HA;
+constexpr uint8_t PreparedFunction::HAS_RESULT;
+constexpr uint8_t PreparedFunction::OPTIMIZE_FOR_WRITE;
+
+PreparedFunction::PreparedFunction(std::string name, uint8_t flags)
+    : m_name(std::move(name)), m_flags(flags) {
+  // same layout as TcrMessage::writeRegionPart
+  const auto len = static_cast<uint32_t>(m_name.length());
+  m_functionPart.reserve(len + 5);
+  m_functionPart.push_back(static_cast<uint8_t>(len >> 24));
+  m_functionPart.push_back(static_cast<uint8_t>(len >> 16));
+  m_functionPart.push_back(static_cast<uint8_t>(len >> 8));
+  m_functionPart.push_back(static_cast<uint8_t>(len));
+  m_functionPart.push_back(0);  // isObject = 0
+  m_functionPart.insert(m_functionPart.end(), m_name.begin(), m_name.end());
+}
+
+uint8_t PreparedFunction::toFlags(const std::vector<int8_t>& attributes) {
+  if (attributes.size() < 3) {
+    throw MessageException(
+        "PreparedFunction::toFlags: expected 3 function attributes but got " +
+        std::to_string(attributes.size()));
+  }
+  uint8_t flags = 0;
+  if (attributes[0] == 1) {
+    flags |= HAS_RESULT;
+  }
+  if (attributes[1] == 1) {
+    flags |= IS_HA;
+  }
+  if (attributes[2] == 1) {
+    flags |= OPTIMIZE_FOR_WRITE;
+  }
+  return flags;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
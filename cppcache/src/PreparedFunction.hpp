@@ -0,0 +1,92 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PREPAREDFUNCTION_H_
+#define GEODE_PREPAREDFUNCTION_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Immutable client side state of a server function, shared by all
+ * executions of the function through a pool. It holds the function
+ * attributes fetched once from the server and the function name part of
+ * the EXECUTE_FUNCTION and EXECUTE_REGION_FUNCTION messages already
+ * encoded.
+ */
+class APACHE_GEODE_EXPORT PreparedFunction {
+ public:
+  static constexpr uint8_t IS_HA = 1;
+  static constexpr uint8_t HAS_RESULT = 2;
+  static constexpr uint8_t OPTIMIZE_FOR_WRITE = 4;
+
+  /**
+   * @param name the id of the function on the server
+   * @param flags the function attributes as a combination of IS_HA,
+   * HAS_RESULT and OPTIMIZE_FOR_WRITE
+   */
+  explicit PreparedFunction(std::string name, uint8_t flags = 0);
+
+  ~PreparedFunction() = default;
+
+  PreparedFunction(const PreparedFunction&) = delete;
+  PreparedFunction& operator=(const PreparedFunction&) = delete;
+
+  inline const std::string& getName() const { return m_name; }
+
+  /** the encoded message part holding the function name */
+  inline const std::vector<uint8_t>& getFunctionPart() const {
+    return m_functionPart;
+  }
+
+  /** the function attributes, sent as the getResult byte of the request */
+  inline uint8_t getFlags() const { return m_flags; }
+
+  inline bool isHA() const { return (m_flags & IS_HA) != 0; }
+
+  inline bool hasResult() const { return (m_flags & HAS_RESULT) != 0; }
+
+  inline bool isOptimizeForWrite() const {
+    return (m_flags & OPTIMIZE_FOR_WRITE) != 0;
+  }
+
+  /**
+   * Converts the hasResult, isHA and optimizeForWrite attributes sent by the
+   * server in reply to GET_FUNCTION_ATTRIBUTES to flags.
+   */
+  static uint8_t toFlags(const std::vector<int8_t>& attributes);
+
+ private:
+  const std::string m_name;
+  const uint8_t m_flags;
+  std::vector<uint8_t> m_functionPart;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PREPAREDFUNCTION_H_
@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PreparedQuery.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "QueryScanner.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+PreparedQuery::PreparedQuery(std::string queryString)
+    : m_queryString(std::move(queryString)),
+      m_parameterCount(countParameters(m_queryString)) {
+  // same layout as TcrMessage::writeRegionPart
+  const auto len = static_cast<uint32_t>(m_queryString.length());
+  m_queryPart.reserve(len + 5);
+  m_queryPart.push_back(static_cast<uint8_t>(len >> 24));
+  m_queryPart.push_back(static_cast<uint8_t>(len >> 16));
+  m_queryPart.push_back(static_cast<uint8_t>(len >> 8));
+  m_queryPart.push_back(static_cast<uint8_t>(len));
+  m_queryPart.push_back(0);  // isObject = 0
+  m_queryPart.insert(m_queryPart.end(), m_queryString.begin(),
+                     m_queryString.end());
+}
+
+size_t PreparedQuery::countParameters(const std::string& queryString) {
+  size_t count = 0;
+  for (auto&& token : QueryScanner::scan(queryString)) {
+    if (token.type == QueryScanner::TokenType::PARAMETER) {
+      count = (std::max)(
+          count, static_cast<size_t>(std::strtoull(token.text.c_str(),
+                                                   nullptr, 10)));
+    }
+  }
+  return count;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,73 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_PREPAREDQUERY_H_
+#define GEODE_PREPAREDQUERY_H_
+
+#include <string>
+#include <vector>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Immutable client side state of a compiled query, shared by all Query
+ * objects for the same query string of a query service. It holds the query
+ * string part of the QUERY and QUERY_WITH_PARAMETERS messages already
+ * encoded and the number of bind parameters the query expects.
+ */
+class APACHE_GEODE_EXPORT PreparedQuery {
+ public:
+  explicit PreparedQuery(std::string queryString);
+
+  ~PreparedQuery() = default;
+
+  PreparedQuery(const PreparedQuery&) = delete;
+  PreparedQuery& operator=(const PreparedQuery&) = delete;
+
+  inline const std::string& getQueryString() const { return m_queryString; }
+
+  /** the encoded message part holding the query string */
+  inline const std::vector<uint8_t>& getQueryPart() const {
+    return m_queryPart;
+  }
+
+  /** the number of bind parameters ($1 .. $n) referenced by the query */
+  inline size_t getParameterCount() const { return m_parameterCount; }
+
+  /**
+   * Returns the highest bind parameter index referenced by the given OQL
+   * query string, ignoring string literals and comments.
+   */
+  static size_t countParameters(const std::string& queryString);
+
+ private:
+  const std::string m_queryString;
+  std::vector<uint8_t> m_queryPart;
+  const size_t m_parameterCount;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_PREPAREDQUERY_H_
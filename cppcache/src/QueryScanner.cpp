@@ -0,0 +1,116 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryScanner.hpp"
+
+#include <cctype>
+#include <cstring>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+bool isWordChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool isDigit(char c) { return std::isdigit(static_cast<unsigned char>(c)); }
+
+/** @return the offset just past the literal or identifier quoted at start */
+size_t skipQuoted(const std::string& queryString, size_t start) {
+  const auto quote = queryString[start];
+  auto i = start + 1;
+  while (i < queryString.length()) {
+    if (queryString[i++] == quote) {
+      // a doubled quote is an escaped quote
+      if (i < queryString.length() && queryString[i] == quote) {
+        ++i;
+      } else {
+        break;
+      }
+    }
+  }
+  return i;
+}
+
+}  // namespace
+
+std::vector<QueryScanner::Token> QueryScanner::scan(
+    const std::string& queryString) {
+  std::vector<Token> tokens;
+  const auto length = queryString.length();
+  size_t i = 0;
+  while (i < length) {
+    const auto c = queryString[i];
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      ++i;
+    } else if (c == '\'' || c == '"') {
+      i = skipQuoted(queryString, i);
+    } else if (c == '-' && i + 1 < length && queryString[i + 1] == '-') {
+      i = queryString.find('\n', i);
+      if (i == std::string::npos) {
+        i = length;
+      }
+    } else if (c == '/' && i + 1 < length && queryString[i + 1] == '*') {
+      i = queryString.find("*/", i + 2);
+      i = i == std::string::npos ? length : i + 2;
+    } else if (c == '$' && i + 1 < length && isDigit(queryString[i + 1])) {
+      auto end = i + 1;
+      while (end < length && isDigit(queryString[end])) {
+        ++end;
+      }
+      tokens.push_back({TokenType::PARAMETER,
+                        queryString.substr(i + 1, end - i - 1), i});
+      i = end;
+    } else if (isWordChar(c)) {
+      auto end = i + 1;
+      while (end < length && isWordChar(queryString[end])) {
+        ++end;
+      }
+      tokens.push_back({TokenType::WORD, queryString.substr(i, end - i), i});
+      i = end;
+    } else {
+      tokens.push_back({TokenType::SYMBOL, std::string(1, c), i});
+      ++i;
+    }
+  }
+  return tokens;
+}
+
+bool QueryScanner::isKeyword(const Token& token, const char* keyword) {
+  if (token.type != TokenType::WORD ||
+      token.text.length() != std::strlen(keyword)) {
+    return false;
+  }
+  for (size_t i = 0; i < token.text.length(); ++i) {
+    if (std::toupper(static_cast<unsigned char>(token.text[i])) !=
+        std::toupper(static_cast<unsigned char>(keyword[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool QueryScanner::isSymbol(const Token& token, char c) {
+  return token.type == TokenType::SYMBOL && token.text[0] == c;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
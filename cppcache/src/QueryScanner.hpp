@@ -17,48 +17,47 @@
 
 #pragma once
 
-#ifndef GEODE_PRESERVEDDATAEXPIRYHANDLER_H_
-#define GEODE_PRESERVEDDATAEXPIRYHANDLER_H_
+#ifndef GEODE_QUERYSCANNER_H_
+#define GEODE_QUERYSCANNER_H_
 
-#include <geode/Cache.hpp>
-#include <geode/PdxSerializable.hpp>
-#include <geode/internal/geode_globals.hpp>
+#include <string>
+#include <vector>
 
-#include "CacheImpl.hpp"
-#include "ExpiryTaskManager.hpp"
+#include <geode/internal/geode_globals.hpp>
 
 namespace apache {
 namespace geode {
 namespace client {
 
 /**
- * @class PreservedDataExpiryHandler
- *
- * The task object which contains the handler which gets triggered
- * when a preserved data expires.
- *
+ * Splits an OQL query string into the tokens the client looks at: words,
+ * bind parameters and single character symbols. String literals, quoted
+ * identifiers and comments are skipped, so nothing inside them is mistaken
+ * for a keyword or a parameter.
  */
-class APACHE_GEODE_EXPORT PreservedDataExpiryHandler
-    : public ACE_Event_Handler {
+class APACHE_GEODE_EXPORT QueryScanner {
  public:
-  /**
-   * Constructor
-   */
-  PreservedDataExpiryHandler(
-      const std::shared_ptr<PdxTypeRegistry>& pdxTypeRegistry,
-      const std::shared_ptr<PdxSerializable>& pdxObjectPtr);
+  enum class TokenType { WORD, PARAMETER, SYMBOL };
+
+  struct Token {
+    TokenType type;
+    /** the word, the parameter without its '$', or the symbol */
+    std::string text;
+    /** offset of the token in the query string */
+    size_t position;
+  };
 
-  int handle_timeout(const ACE_Time_Value& current_time,
-                     const void* arg) override;
+  static std::vector<Token> scan(const std::string& queryString);
 
-  int handle_close(ACE_HANDLE handle, ACE_Reactor_Mask close_mask) override;
+  /** @return true if token is the word keyword, ignoring case */
+  static bool isKeyword(const Token& token, const char* keyword);
 
- private:
-  std::shared_ptr<PdxTypeRegistry> m_pdxTypeRegistry;
-  std::shared_ptr<PdxSerializable> m_pdxObjectPtr;
+  /** @return true if token is the symbol c */
+  static bool isSymbol(const Token& token, char c);
 };
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
 
-#endif  // GEODE_PRESERVEDDATAEXPIRYHANDLER_H_
+#endif  // GEODE_QUERYSCANNER_H_
@@ -0,0 +1,77 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryVsdStats.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using statistics::StatisticsFactory;
+
+constexpr const char* QueryVsdStats::STATS_NAME;
+constexpr const char* QueryVsdStats::STATS_DESC;
+
+QueryVsdStats::QueryVsdStats(StatisticsFactory* factory,
+                             const std::string& queryName) {
+  auto statsType = factory->findType(STATS_NAME);
+  if (!statsType) {
+    const bool largerIsBetter = true;
+    auto stats = new StatisticDescriptor*[4];
+    stats[0] = factory->createIntCounter(
+        "executions", "The total number of executions for this query",
+        "operations", largerIsBetter);
+    stats[1] = factory->createLongCounter(
+        "executionTime",
+        "Total time spent executing this query until the last row was read",
+        "nanoseconds", !largerIsBetter);
+    stats[2] = factory->createLongCounter(
+        "firstRowTime",
+        "Total time spent executing this query until the first row was "
+        "available",
+        "nanoseconds", !largerIsBetter);
+    stats[3] = factory->createLongCounter(
+        "rows", "The total number of rows returned by this query", "entries",
+        largerIsBetter);
+
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 4);
+  }
+
+  m_queryVsdStats =
+      factory->createAtomicStatistics(statsType, queryName.c_str());
+
+  m_executionsId = statsType->nameToId("executions");
+  m_executionTimeId = statsType->nameToId("executionTime");
+  m_firstRowTimeId = statsType->nameToId("firstRowTime");
+  m_rowsId = statsType->nameToId("rows");
+
+  m_queryVsdStats->setInt(m_executionsId, 0);
+  m_queryVsdStats->setLong(m_executionTimeId, 0);
+  m_queryVsdStats->setLong(m_firstRowTimeId, 0);
+  m_queryVsdStats->setLong(m_rowsId, 0);
+}
+
+QueryVsdStats::~QueryVsdStats() {
+  if (m_queryVsdStats != nullptr) {
+    // Don't Delete, Already closed, Just set nullptr
+    m_queryVsdStats = nullptr;
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,95 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_QUERYVSDSTATS_H_
+#define GEODE_QUERYVSDSTATS_H_
+
+#include <string>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "statistics/Statistics.hpp"
+#include "statistics/StatisticsFactory.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+using statistics::StatisticDescriptor;
+using statistics::Statistics;
+using statistics::StatisticsType;
+
+/**
+ * Client side statistics for queries executed through a query service, such
+ * as the number of cursor executions, the time taken until the first row
+ * became available and the number of rows handed out.
+ */
+class APACHE_GEODE_EXPORT QueryVsdStats {
+ public:
+  /** hold statistics for queries. */
+  QueryVsdStats(statistics::StatisticsFactory* factory,
+                const std::string& queryName);
+
+  /** disable stat collection for this item. */
+  virtual ~QueryVsdStats();
+
+  void close() { m_queryVsdStats->close(); }
+
+  inline void incExecutions() { m_queryVsdStats->incInt(m_executionsId, 1); }
+
+  inline void incExecutionTime(int64_t nanos) {
+    m_queryVsdStats->incLong(m_executionTimeId, nanos);
+  }
+
+  inline void incFirstRowTime(int64_t nanos) {
+    m_queryVsdStats->incLong(m_firstRowTimeId, nanos);
+  }
+
+  inline void incRows(int64_t rows) {
+    m_queryVsdStats->incLong(m_rowsId, rows);
+  }
+
+  inline uint32_t numExecutions() const {
+    return m_queryVsdStats->getInt(m_executionsId);
+  }
+  inline int64_t executionTime() const {
+    return m_queryVsdStats->getLong(m_executionTimeId);
+  }
+  inline int64_t firstRowTime() const {
+    return m_queryVsdStats->getLong(m_firstRowTimeId);
+  }
+  inline int64_t numRows() const { return m_queryVsdStats->getLong(m_rowsId); }
+
+ private:
+  Statistics* m_queryVsdStats;
+
+  int32_t m_executionsId;
+  int32_t m_executionTimeId;
+  int32_t m_firstRowTimeId;
+  int32_t m_rowsId;
+
+  static constexpr const char* STATS_NAME = "QueryStatistics";
+  static constexpr const char* STATS_DESC = "Statistics for queries";
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_QUERYVSDSTATS_H_
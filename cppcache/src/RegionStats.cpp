@@ -22,12 +22,14 @@
 
 #include <geode/internal/geode_globals.hpp>
 
+#include "statistics/StatisticHistogram.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+using statistics::StatisticHistogram;
 using statistics::StatisticsFactory;
 using util::concurrent::spinlock_mutex;
 
@@ -40,7 +42,8 @@ RegionStats::RegionStats(StatisticsFactory* factory,
 
   if (!statsType) {
     const bool largerIsBetter = true;
-    auto stats = new StatisticDescriptor*[25];
+    const auto statCount = 25 + 2 * StatisticHistogram::BucketCount;
+    auto stats = new StatisticDescriptor*[statCount];
     stats[0] = factory->createIntCounter(
         "creates", "The total number of cache creates for this region",
         "entries", largerIsBetter);
@@ -135,7 +138,13 @@ RegionStats::RegionStats(StatisticsFactory* factory,
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
-    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, 25);
+    StatisticHistogram::createDescriptors(
+        factory, "getLatency", "Number of get operations for this region",
+        stats + 25);
+    StatisticHistogram::createDescriptors(
+        factory, "putLatency", "Number of put operations for this region",
+        stats + 25 + StatisticHistogram::BucketCount);
+    statsType = factory->createType(STATS_NAME, STATS_DESC, stats, statCount);
   }
 
   m_destroysId = statsType->nameToId("destroys");
@@ -148,6 +157,8 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_removeAllTimeId = statsType->nameToId("removeAllTime");
   m_getsId = statsType->nameToId("gets");
   m_getTimeId = statsType->nameToId("getTime");
+  m_getLatencyId = StatisticHistogram::nameToId(statsType, "getLatency");
+  m_putLatencyId = StatisticHistogram::nameToId(statsType, "putLatency");
   m_getAllId = statsType->nameToId("getAll");
   m_getAllTimeId = statsType->nameToId("getAllTime");
   m_hitsId = statsType->nameToId("hits");
@@ -100,6 +100,12 @@ class APACHE_GEODE_EXPORT RegionStats {
 
   inline int32_t getPutTimeId() { return m_putTimeId; }
 
+  /** @return the id of the first bucket of the get latency histogram. */
+  inline int32_t getGetLatencyId() { return m_getLatencyId; }
+
+  /** @return the id of the first bucket of the put latency histogram. */
+  inline int32_t getPutLatencyId() { return m_putLatencyId; }
+
   inline int32_t getGetAllTimeId() { return m_getAllTimeId; }
 
   inline int32_t getPutAllTimeId() { return m_putAllTimeId; }
@@ -129,6 +135,8 @@ class APACHE_GEODE_EXPORT RegionStats {
   int32_t m_getTimeId;
   int32_t m_getAllId;
   int32_t m_getAllTimeId;
+  int32_t m_getLatencyId;
+  int32_t m_putLatencyId;
   int32_t m_hitsId;
   int32_t m_missesId;
   int32_t m_entriesId;
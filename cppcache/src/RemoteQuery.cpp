@@ -17,6 +17,15 @@
 
 #include "RemoteQuery.hpp"
 
+#include <algorithm>
+#include <chrono>
+
+#include <geode/FunctionService.hpp>
+
+#include "ParallelQueryResultCollector.hpp"
+#include "PreparedQuery.hpp"
+#include "QueryVsdStats.hpp"
+#include "RemoteQueryCursor.hpp"
 #include "ResultSetImpl.hpp"
 #include "StructSetImpl.hpp"
 #include "ThinClientPoolDM.hpp"
@@ -76,6 +85,7 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
                                   .getEnableTimeStatistics();
   int64_t sampleStartNanos =
       enableTimeStatistics ? Utils::startStatOpTime() : 0;
+  checkParameters(func, paramList);
   TcrMessageReply reply(true, tcdm);
   auto* resultCollector = (new ChunkedQueryResponse(reply));
   reply.setChunkedResultHandler(
@@ -114,10 +124,150 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
                             pool->getStats().getQueryExecutionTimeId(),
                             sampleStartNanos);
   }
+  if (m_prepared) {
+    auto stats = m_queryService->getQueryStats();
+    stats->incExecutions();
+    stats->incRows(static_cast<int64_t>(sr->size()));
+    if (enableTimeStatistics) {
+      stats->incExecutionTime(Utils::startStatOpTime() - sampleStartNanos);
+    }
+  }
   delete resultCollector;
   return sr;
 }
 
+std::shared_ptr<SelectResults> RemoteQuery::executeParallel(
+    const std::shared_ptr<Region>& region, const std::string& queryFunctionId,
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  if (region == nullptr) {
+    throw IllegalArgumentException(
+        "Query::executeParallel: region must not be null");
+  }
+  checkParameters("Query::executeParallel", paramList);
+  ParallelQueryResultCollector::checkQuery(m_queryString,
+                                           region->getFullPath());
+
+  LOGFINEST("Query::executeParallel: executing query: %s on region %s",
+            m_queryString.c_str(), region->getFullPath().c_str());
+  bool enableTimeStatistics = m_tccdm->getConnectionManager()
+                                  .getCacheImpl()
+                                  ->getDistributedSystem()
+                                  .getSystemProperties()
+                                  .getEnableTimeStatistics();
+  int64_t sampleStartNanos =
+      enableTimeStatistics ? Utils::startStatOpTime() : 0;
+  // the timeout bounds the whole call, not each wait
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  auto args = CacheableVector::create();
+  args->push_back(CacheableString::create(m_queryString));
+  if (paramList != nullptr) {
+    args->insert(args->end(), paramList->begin(), paramList->end());
+  }
+  // without a filter the execution is split by the primary buckets of each
+  // server when single hop is enabled
+  auto collector = std::make_shared<ParallelQueryResultCollector>();
+  FunctionService::onRegion(region)
+      .withArgs(args)
+      .withCollector(collector)
+      .execute(queryFunctionId, timeout);
+  auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+  auto sr = std::make_shared<ResultSetImpl>(collector->getResult(
+      (std::max)(remaining, std::chrono::milliseconds::zero())));
+
+  auto stats = m_queryService->getQueryStats();
+  stats->incExecutions();
+  stats->incRows(static_cast<int64_t>(sr->size()));
+  if (enableTimeStatistics) {
+    stats->incExecutionTime(Utils::startStatOpTime() - sampleStartNanos);
+  }
+  return sr;
+}
+
+std::shared_ptr<QueryCursor> RemoteQuery::executeCursor(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout, size_t readAhead) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  if (readAhead == 0) {
+    throw IllegalArgumentException(
+        "Query::executeCursor: readAhead must be greater than zero");
+  }
+  {
+    TryReadGuard guard(m_queryService->getLock(), m_queryService->invalid());
+    if (m_queryService->invalid()) {
+      throw CacheClosedException(
+          "Query::executeCursor: Cache has been closed.");
+    }
+  }
+
+  checkParameters("Query::executeCursor", paramList);
+
+  LOGFINEST("Query::executeCursor: executing query: %s",
+            m_queryString.c_str());
+  auto query = std::unique_ptr<RemoteQuery>(new RemoteQuery(
+      m_queryString, m_queryService, m_tccdm, m_authenticatedView));
+  query->m_prepared = m_prepared;
+  auto stats = m_queryService->getQueryStats();
+  auto cursor = std::make_shared<RemoteQueryCursor>(
+      std::move(query), paramList, timeout, readAhead, stats);
+  cursor->start();
+  return cursor;
+}
+
+std::shared_ptr<ColumnarResults> RemoteQuery::executeColumnar(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  GuardUserAttributes gua;
+  if (m_authenticatedView) {
+    gua.setAuthenticatedView(m_authenticatedView);
+  }
+  const char* func = "Query::executeColumnar";
+  auto pool = dynamic_cast<ThinClientPoolDM*>(m_tccdm);
+  if (pool) {
+    pool->getStats().incQueryExecutionId();
+  }
+  bool enableTimeStatistics = m_tccdm->getConnectionManager()
+                                  .getCacheImpl()
+                                  ->getDistributedSystem()
+                                  .getSystemProperties()
+                                  .getEnableTimeStatistics();
+  int64_t sampleStartNanos =
+      enableTimeStatistics ? Utils::startStatOpTime() : 0;
+  checkParameters(func, paramList);
+  TcrMessageReply reply(true, m_tccdm);
+  ColumnarQueryResponse resultCollector(reply);
+  reply.setChunkedResultHandler(&resultCollector);
+  GfErrType err = executeNoThrow(timeout, reply, func, m_tccdm, paramList);
+  GfErrTypeToException(func, err);
+
+  LOGFINEST("%s: reading reply for query: %s", func, m_queryString.c_str());
+  auto results = resultCollector.getColumnarResults();
+  if (!results->isComplete()) {
+    throw MessageException(std::string(func) +
+                           ": Number of values coming from server has to be "
+                           "exactly divisible by field count");
+  }
+
+  if (pool && enableTimeStatistics) {
+    Utils::updateStatOpTime(pool->getStats().getStats(),
+                            pool->getStats().getQueryExecutionTimeId(),
+                            sampleStartNanos);
+  }
+  if (m_prepared) {
+    auto stats = m_queryService->getQueryStats();
+    stats->incExecutions();
+    stats->incRows(static_cast<int64_t>(results->size()));
+    if (enableTimeStatistics) {
+      stats->incExecutionTime(Utils::startStatOpTime() - sampleStartNanos);
+    }
+  }
+  return results;
+}
+
 GfErrType RemoteQuery::executeNoThrow(
     std::chrono::milliseconds timeout, TcrMessageReply& reply, const char* func,
     ThinClientBaseDM* tcdm, std::shared_ptr<CacheableVector> paramList) {
@@ -130,66 +280,68 @@ GfErrType RemoteQuery::executeNoThrow(
   }
   LOGDEBUG("%s: creating QUERY TcrMessage for query: %s", func,
            m_queryString.c_str());
+  auto dataOutput = new DataOutput(
+      m_tccdm->getConnectionManager().getCacheImpl()->createDataOutput());
+  std::unique_ptr<TcrMessage> msg;
   if (paramList != nullptr) {
     // QUERY_WITH_PARAMETERS
-    TcrMessageQueryWithParameters msg(
-        new DataOutput(
-            m_tccdm->getConnectionManager().getCacheImpl()->createDataOutput()),
-        m_queryString, nullptr, paramList, timeout, tcdm);
-    msg.setTimeout(timeout);
-    reply.setTimeout(timeout);
-
-    GfErrType err = GF_NOERR;
-    LOGFINEST("%s: sending request for query: %s", func, m_queryString.c_str());
-    if (tcdm == nullptr) {
-      tcdm = m_tccdm;
-    }
-    err = tcdm->sendSyncRequest(msg, reply);
-    if (err != GF_NOERR) {
-      return err;
-    }
-    if (reply.getMessageType() == TcrMessage::EXCEPTION) {
-      err = ThinClientRegion::handleServerException(func, reply.getException());
-      if (err == GF_CACHESERVER_EXCEPTION) {
-        err = GF_REMOTE_QUERY_EXCEPTION;
-      }
+    if (m_prepared) {
+      msg = std::unique_ptr<TcrMessage>(new TcrMessageQueryWithParameters(
+          dataOutput, *m_prepared, paramList, timeout, tcdm));
+    } else {
+      msg = std::unique_ptr<TcrMessage>(new TcrMessageQueryWithParameters(
+          dataOutput, m_queryString, nullptr, paramList, timeout, tcdm));
     }
-    return err;
+  } else if (m_prepared) {
+    msg = std::unique_ptr<TcrMessage>(
+        new TcrMessageQuery(dataOutput, *m_prepared, timeout, tcdm));
   } else {
-    TcrMessageQuery msg(
-        new DataOutput(
-            m_tccdm->getConnectionManager().getCacheImpl()->createDataOutput()),
-        m_queryString, timeout, tcdm);
-    msg.setTimeout(timeout);
-    reply.setTimeout(timeout);
-
-    GfErrType err = GF_NOERR;
-    LOGFINEST("%s: sending request for query: %s", func, m_queryString.c_str());
-    if (tcdm == nullptr) {
-      tcdm = m_tccdm;
-    }
-    err = tcdm->sendSyncRequest(msg, reply);
-    if (err != GF_NOERR) {
-      return err;
-    }
-    if (reply.getMessageType() == TcrMessage::EXCEPTION) {
-      err = ThinClientRegion::handleServerException(func, reply.getException());
-      if (err == GF_CACHESERVER_EXCEPTION) {
-        err = GF_REMOTE_QUERY_EXCEPTION;
-      }
-    }
+    msg = std::unique_ptr<TcrMessage>(
+        new TcrMessageQuery(dataOutput, m_queryString, timeout, tcdm));
+  }
+  msg->setTimeout(timeout);
+  reply.setTimeout(timeout);
+
+  GfErrType err = GF_NOERR;
+  LOGFINEST("%s: sending request for query: %s", func, m_queryString.c_str());
+  if (tcdm == nullptr) {
+    tcdm = m_tccdm;
+  }
+  err = tcdm->sendSyncRequest(*msg, reply);
+  if (err != GF_NOERR) {
     return err;
   }
+  if (reply.getMessageType() == TcrMessage::EXCEPTION) {
+    err = ThinClientRegion::handleServerException(func, reply.getException());
+    if (err == GF_CACHESERVER_EXCEPTION) {
+      err = GF_REMOTE_QUERY_EXCEPTION;
+    }
+  }
+  return err;
 }
 
 const std::string& RemoteQuery::getQueryString() const { return m_queryString; }
 
 void RemoteQuery::compile() {
-  throw UnsupportedOperationException("Not supported in native clients");
+  if (m_prepared == nullptr) {
+    m_prepared = m_queryService->getPreparedQuery(m_queryString);
+  }
 }
 
-bool RemoteQuery::isCompiled() {
-  throw UnsupportedOperationException("Not supported in native clients");
+bool RemoteQuery::isCompiled() { return m_prepared != nullptr; }
+
+void RemoteQuery::checkParameters(
+    const char* func, const std::shared_ptr<CacheableVector>& paramList) const {
+  if (m_prepared == nullptr) {
+    return;
+  }
+  auto expected = m_prepared->getParameterCount();
+  auto actual = paramList == nullptr ? 0 : paramList->size();
+  if (actual != expected) {
+    throw IllegalArgumentException(
+        std::string(func) + ": query expects " + std::to_string(expected) +
+        " parameters but " + std::to_string(actual) + " were given");
+  }
 }
 
 }  // namespace client
@@ -24,8 +24,10 @@
 #include <string>
 
 #include <geode/AuthenticatedView.hpp>
+#include <geode/ColumnarResults.hpp>
 #include <geode/ExceptionTypes.hpp>
 #include <geode/Query.hpp>
+#include <geode/QueryCursor.hpp>
 #include <geode/ResultSet.hpp>
 #include <geode/SelectResults.hpp>
 #include <geode/StructSet.hpp>
@@ -42,11 +44,19 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class PreparedQuery;
+
 class APACHE_GEODE_EXPORT RemoteQuery : public Query {
   std::string m_queryString;
   std::shared_ptr<RemoteQueryService> m_queryService;
   ThinClientBaseDM* m_tccdm;
   AuthenticatedView* m_authenticatedView;
+  std::shared_ptr<PreparedQuery> m_prepared;
+
+  void checkParameters(const char* func,
+                       const std::shared_ptr<CacheableVector>& paramList) const;
+
+  friend class RemoteQueryCursor;
 
  public:
   RemoteQuery(std::string querystr,
@@ -65,6 +75,22 @@ class APACHE_GEODE_EXPORT RemoteQuery : public Query {
       std::chrono::milliseconds timeout =
           DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
 
+  std::shared_ptr<SelectResults> executeParallel(
+      const std::shared_ptr<Region>& region, const std::string& queryFunctionId,
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  std::shared_ptr<QueryCursor> executeCursor(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t readAhead = DEFAULT_QUERY_CURSOR_READ_AHEAD) override;
+
+  std::shared_ptr<ColumnarResults> executeColumnar(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
   /**
    * executes a query using a given distribution manager
    * used by Region.query() and Region.getAll()
@@ -0,0 +1,245 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RemoteQueryCursor.hpp"
+
+#include <geode/Struct.hpp>
+
+#include "QueryVsdStats.hpp"
+#include "RemoteQuery.hpp"
+#include "StructSetImpl.hpp"
+#include "ThinClientRegion.hpp"
+#include "UserAttributes.hpp"
+#include "util/exception.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+const char* RemoteQueryCursor::NC_QueryCursor = "NC QueryCursor";
+
+/**
+ * Query response handler that forwards the decoded values to a cursor instead
+ * of collecting them.
+ */
+class StreamingQueryResponse : public ChunkedQueryResponse {
+ public:
+  StreamingQueryResponse(TcrMessage& msg, RemoteQueryCursor& cursor)
+      : ChunkedQueryResponse(msg), m_cursor(cursor) {}
+
+  ~StreamingQueryResponse() override = default;
+
+  void reset() override {
+    ChunkedQueryResponse::reset();
+    m_cursor.reset();
+  }
+
+ protected:
+  void addQueryResult(std::shared_ptr<Serializable> value) override {
+    m_cursor.addValue(std::move(value), getStructFieldNames());
+  }
+
+ private:
+  RemoteQueryCursor& m_cursor;
+};
+
+RemoteQueryCursor::RemoteQueryCursor(std::unique_ptr<RemoteQuery> query,
+                                     std::shared_ptr<CacheableVector> paramList,
+                                     std::chrono::milliseconds timeout,
+                                     size_t readAhead,
+                                     std::shared_ptr<QueryVsdStats> stats)
+    : m_query(std::move(query)),
+      m_paramList(std::move(paramList)),
+      m_timeout(timeout),
+      m_readAhead(readAhead),
+      m_stats(std::move(stats)),
+      m_startNanos(0),
+      m_rowsAdded(0),
+      m_rowsDelivered(0),
+      m_done(false),
+      m_closed(false) {
+  const auto& systemProperties = m_query->m_tccdm->getConnectionManager()
+                                     .getCacheImpl()
+                                     ->getDistributedSystem()
+                                     .getSystemProperties();
+  m_enableTimeStatistics = systemProperties.getEnableTimeStatistics();
+  // With a chunk handler thread the chunks of all requests are decoded on a
+  // single shared thread, so blocking it for a slow consumer could stall (or
+  // deadlock) unrelated requests; buffer without bound in that case.
+  m_boundedReadAhead = !systemProperties.enableChunkHandlerThread();
+}
+
+RemoteQueryCursor::~RemoteQueryCursor() noexcept { close(); }
+
+void RemoteQueryCursor::start() {
+  if (m_stats) {
+    m_stats->incExecutions();
+  }
+  m_startNanos = m_enableTimeStatistics ? Utils::startStatOpTime() : 0;
+  m_fetcher = std::unique_ptr<Task<RemoteQueryCursor>>(
+      new Task<RemoteQueryCursor>(this, &RemoteQueryCursor::fetch,
+                                  NC_QueryCursor));
+  m_fetcher->start();
+}
+
+int RemoteQueryCursor::fetch(volatile bool&) {
+  std::exception_ptr error;
+  try {
+    GuardUserAttributes gua;
+    if (m_query->m_authenticatedView != nullptr) {
+      gua.setAuthenticatedView(m_query->m_authenticatedView);
+    }
+    auto tcdm = m_query->m_tccdm;
+    TcrMessageReply reply(true, tcdm);
+    StreamingQueryResponse response(reply, *this);
+    reply.setChunkedResultHandler(static_cast<TcrChunkedResult*>(&response));
+    auto err = m_query->executeNoThrow(m_timeout, reply, "Query::executeCursor",
+                                       tcdm, m_paramList);
+    GfErrTypeToException("Query::executeCursor", err);
+
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    if (!m_structFields.empty()) {
+      throw MessageException(
+          "Query::executeCursor: Number of values coming from server has to "
+          "be exactly divisible by field count");
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  finish(error);
+  return 0;
+}
+
+void RemoteQueryCursor::addValue(std::shared_ptr<Serializable> value,
+                                 const std::vector<std::string>& fieldNames) {
+  std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+  if (m_closed) {
+    // keep draining the response, dropping the values
+    return;
+  }
+
+  std::shared_ptr<Serializable> row;
+  if (fieldNames.empty()) {
+    row = std::move(value);
+  } else {
+    if (m_structSet == nullptr) {
+      m_fieldNames = fieldNames;
+      m_structSet = std::make_shared<StructSetImpl>(CacheableVector::create(),
+                                                    m_fieldNames);
+    }
+    m_structFields.push_back(std::move(value));
+    if (m_structFields.size() < m_fieldNames.size()) {
+      return;
+    }
+    // rows keep the struct set holding their field names alive
+    row = std::make_shared<Struct>(m_structSet, m_structFields);
+    m_structFields.clear();
+  }
+
+  if (m_boundedReadAhead) {
+    // blocks the reading of the response until the consumer catches up
+    m_spaceAvailable.wait(
+        lock, [this] { return m_closed || m_rows.size() < m_readAhead; });
+    if (m_closed) {
+      return;
+    }
+  }
+
+  if (m_rowsAdded++ == 0 && m_stats && m_enableTimeStatistics) {
+    m_stats->incFirstRowTime(Utils::startStatOpTime() - m_startNanos);
+  }
+  m_rows.push_back(std::move(row));
+  m_rowAvailable.notify_one();
+}
+
+void RemoteQueryCursor::reset() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_rowsDelivered > 0) {
+    throw IllegalStateException(
+        "Query::executeCursor: query cannot be retried on another server "
+        "after rows have been consumed");
+  }
+  m_rows.clear();
+  m_structFields.clear();
+  m_rowsAdded = 0;
+  m_spaceAvailable.notify_all();
+}
+
+void RemoteQueryCursor::finish(std::exception_ptr error) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  m_done = true;
+  m_error = error;
+  if (m_stats) {
+    m_stats->incRows(m_rowsAdded);
+    if (m_enableTimeStatistics) {
+      m_stats->incExecutionTime(Utils::startStatOpTime() - m_startNanos);
+    }
+  }
+  m_rowAvailable.notify_all();
+}
+
+bool RemoteQueryCursor::hasNext() {
+  std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+  if (m_closed) {
+    throw IllegalStateException("QueryCursor::hasNext: cursor is closed");
+  }
+  m_rowAvailable.wait(lock, [this] { return m_done || !m_rows.empty(); });
+  if (!m_rows.empty()) {
+    return true;
+  }
+  if (m_error) {
+    std::rethrow_exception(m_error);
+  }
+  return false;
+}
+
+std::shared_ptr<Serializable> RemoteQueryCursor::next() {
+  if (!hasNext()) {
+    throw IllegalStateException("QueryCursor::next: no more rows");
+  }
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto row = std::move(m_rows.front());
+  m_rows.pop_front();
+  ++m_rowsDelivered;
+  m_spaceAvailable.notify_one();
+  return row;
+}
+
+std::vector<std::string> RemoteQueryCursor::getFieldNames() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  return m_fieldNames;
+}
+
+void RemoteQueryCursor::close() {
+  {
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    if (m_closed) {
+      return;
+    }
+    m_closed = true;
+    m_rows.clear();
+    m_spaceAvailable.notify_all();
+    m_rowAvailable.notify_all();
+  }
+  if (m_fetcher) {
+    m_fetcher->stop();
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,118 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_REMOTEQUERYCURSOR_H_
+#define GEODE_REMOTEQUERYCURSOR_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/QueryCursor.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+#include "Task.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class QueryVsdStats;
+class RemoteQuery;
+class StreamingQueryResponse;
+class StructSetImpl;
+
+/**
+ * QueryCursor implementation that executes the query on a separate thread
+ * and hands out rows as the response chunks are decoded. The decoding thread
+ * blocks once readAhead rows are buffered, which stops it from reading more
+ * of the response from the connection.
+ */
+class APACHE_GEODE_EXPORT RemoteQueryCursor : public QueryCursor {
+ public:
+  RemoteQueryCursor(std::unique_ptr<RemoteQuery> query,
+                    std::shared_ptr<CacheableVector> paramList,
+                    std::chrono::milliseconds timeout, size_t readAhead,
+                    std::shared_ptr<QueryVsdStats> stats);
+
+  ~RemoteQueryCursor() noexcept override;
+
+  /** start executing the query on the fetch thread */
+  void start();
+
+  bool hasNext() override;
+
+  std::shared_ptr<Serializable> next() override;
+
+  std::vector<std::string> getFieldNames() override;
+
+  void close() override;
+
+ private:
+  friend class StreamingQueryResponse;
+
+  int fetch(volatile bool& isRunning);
+
+  /** add a decoded value; called on the thread decoding the chunks */
+  void addValue(std::shared_ptr<Serializable> value,
+                const std::vector<std::string>& fieldNames);
+
+  /** discard buffered rows before the query is retried on another server */
+  void reset();
+
+  void finish(std::exception_ptr error);
+
+  std::unique_ptr<RemoteQuery> m_query;
+  std::shared_ptr<CacheableVector> m_paramList;
+  std::chrono::milliseconds m_timeout;
+  size_t m_readAhead;
+  bool m_boundedReadAhead;
+  std::shared_ptr<QueryVsdStats> m_stats;
+  bool m_enableTimeStatistics;
+  int64_t m_startNanos;
+
+  std::mutex m_mutex;
+  std::condition_variable m_rowAvailable;
+  std::condition_variable m_spaceAvailable;
+  std::deque<std::shared_ptr<Serializable>> m_rows;
+  std::vector<std::shared_ptr<Serializable>> m_structFields;
+  std::vector<std::string> m_fieldNames;
+  std::shared_ptr<StructSetImpl> m_structSet;
+  size_t m_rowsAdded;
+  size_t m_rowsDelivered;
+  bool m_done;
+  bool m_closed;
+  std::exception_ptr m_error;
+
+  std::unique_ptr<Task<RemoteQueryCursor>> m_fetcher;
+
+  static const char* NC_QueryCursor;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_REMOTEQUERYCURSOR_H_
@@ -86,10 +86,44 @@ std::shared_ptr<Query> RemoteQueryService::newQuery(std::string querystring) {
   }
 }
 
+std::shared_ptr<QueryVsdStats> RemoteQueryService::getQueryStats() {
+  std::lock_guard<decltype(m_queryStatsMutex)> guard(m_queryStatsMutex);
+  if (m_queryStats == nullptr) {
+    auto pool = dynamic_cast<ThinClientPoolDM*>(m_tccdm);
+    m_queryStats = std::make_shared<QueryVsdStats>(
+        m_statisticsFactory, pool ? pool->getName() : "QueryService");
+  }
+  return m_queryStats;
+}
+
+std::shared_ptr<PreparedQuery> RemoteQueryService::getPreparedQuery(
+    const std::string& querystring) {
+  std::lock_guard<decltype(m_preparedQueriesMutex)> guard(
+      m_preparedQueriesMutex);
+  auto& prepared = m_preparedQueries[querystring];
+  if (prepared == nullptr) {
+    LOGFINE("RemoteQueryService: compiling query: " + querystring);
+    prepared = std::make_shared<PreparedQuery>(querystring);
+  }
+  return prepared;
+}
+
 void RemoteQueryService::close() {
   LOGFINEST("RemoteQueryService::close: starting close");
   TryWriteGuard guard(m_rwLock, m_invalid);
 
+  {
+    std::lock_guard<decltype(m_queryStatsMutex)> statsGuard(m_queryStatsMutex);
+    if (m_queryStats != nullptr) {
+      m_queryStats->close();
+    }
+  }
+  {
+    std::lock_guard<decltype(m_preparedQueriesMutex)> preparedGuard(
+        m_preparedQueriesMutex);
+    m_preparedQueries.clear();
+  }
+
   if (m_cqService != nullptr) {
     LOGFINEST("RemoteQueryService::close: starting CQ service close");
     m_cqService->closeCqService();
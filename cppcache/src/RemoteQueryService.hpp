@@ -21,7 +21,9 @@
 #define GEODE_REMOTEQUERYSERVICE_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <ace/RW_Thread_Mutex.h>
 
@@ -29,6 +31,8 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "CqService.hpp"
+#include "PreparedQuery.hpp"
+#include "QueryVsdStats.hpp"
 #include "ThinClientCacheDistributionManager.hpp"
 #include "statistics/StatisticsManager.hpp"
 
@@ -82,6 +86,16 @@ class APACHE_GEODE_EXPORT RemoteQueryService
 
   void executeAllCqs(bool failover);
 
+  /** statistics for the queries executed through this service */
+  std::shared_ptr<QueryVsdStats> getQueryStats();
+
+  /**
+   * the compiled state for a query string, shared by all queries of this
+   * service compiled with Query::compile
+   */
+  std::shared_ptr<PreparedQuery> getPreparedQuery(
+      const std::string& querystring);
+
   virtual std::shared_ptr<CacheableArrayList> getAllDurableCqsFromServer()
       const override;
 
@@ -108,6 +122,11 @@ class APACHE_GEODE_EXPORT RemoteQueryService
   std::shared_ptr<CqService> m_cqService;
   CqPoolsConnected m_CqPoolsConnected;
   statistics::StatisticsFactory* m_statisticsFactory;
+  std::mutex m_queryStatsMutex;
+  std::shared_ptr<QueryVsdStats> m_queryStats;
+  std::mutex m_preparedQueriesMutex;
+  std::unordered_map<std::string, std::shared_ptr<PreparedQuery>>
+      m_preparedQueries;
 };
 
 }  // namespace client
@@ -0,0 +1,109 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SerializedResultImpl.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "CacheImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+SerializedResultImpl::SerializedResultImpl(
+    std::shared_ptr<const uint8_t> buffer, const uint8_t* bytes, size_t length,
+    const CacheImpl* cacheImpl, Pool* pool)
+    : m_buffer(std::move(buffer)),
+      m_bytes(bytes),
+      m_length(length),
+      m_cacheImpl(cacheImpl),
+      m_pool(pool) {}
+
+const uint8_t* SerializedResultImpl::getBytes() const { return m_bytes; }
+
+size_t SerializedResultImpl::getLength() const { return m_length; }
+
+std::shared_ptr<Serializable> SerializedResultImpl::deserialize() const {
+  auto input = m_cacheImpl->createDataInput(m_bytes, m_length, m_pool);
+  std::shared_ptr<Serializable> value;
+  input.readObject(value);
+  return value;
+}
+
+size_t SerializedResultImpl::objectSize() const {
+  return sizeof(SerializedResultImpl) + m_length;
+}
+
+bool SerializedResultImpl::skipValue(DataInput& input) {
+  size_t length;
+  auto code = static_cast<DSCode>(input.read());
+  switch (code) {
+    case DSCode::NullObj:
+      return true;
+    case DSCode::CacheableBoolean:
+    case DSCode::CacheableByte:
+      length = 1;
+      break;
+    case DSCode::CacheableCharacter:
+    case DSCode::CacheableInt16:
+      length = 2;
+      break;
+    case DSCode::CacheableInt32:
+    case DSCode::CacheableFloat:
+      length = 4;
+      break;
+    case DSCode::CacheableInt64:
+    case DSCode::CacheableDouble:
+    case DSCode::CacheableDate:
+      length = 8;
+      break;
+    case DSCode::CacheableString:
+    case DSCode::CacheableASCIIString:
+      length = static_cast<uint16_t>(input.readInt16());
+      break;
+    case DSCode::CacheableASCIIStringHuge:
+      length = static_cast<uint32_t>(input.readInt32());
+      break;
+    case DSCode::CacheableStringHuge:
+      length = static_cast<uint32_t>(input.readInt32());
+      length *= 2;
+      break;
+    case DSCode::CacheableBytes: {
+      auto arrayLength = input.readArrayLength();
+      length = arrayLength > 0 ? static_cast<size_t>(arrayLength) : 0;
+      break;
+    }
+    case DSCode::PDX:
+      // length of the fields, followed by the type id
+      length = static_cast<uint32_t>(input.readInt32()) + 4;
+      break;
+    default:
+      input.rewindCursor(1);
+      return false;
+  }
+  if (length > input.getBytesRemaining()) {
+    throw OutOfRangeException(
+        "SerializedResult: serialized value exceeds the buffer");
+  }
+  input.advanceCursor(length);
+  return true;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
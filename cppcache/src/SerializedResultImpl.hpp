@@ -0,0 +1,77 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SERIALIZEDRESULTIMPL_H_
+#define GEODE_SERIALIZEDRESULTIMPL_H_
+
+#include <memory>
+
+#include <geode/DataInput.hpp>
+#include <geode/SerializedResult.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class CacheImpl;
+class Pool;
+
+class APACHE_GEODE_EXPORT SerializedResultImpl : public SerializedResult {
+ public:
+  /**
+   * @param buffer the buffer holding the bytes, kept alive by this result
+   * @param bytes the serialized bytes of the result within the buffer
+   * @param length the number of serialized bytes
+   */
+  SerializedResultImpl(std::shared_ptr<const uint8_t> buffer,
+                       const uint8_t* bytes, size_t length,
+                       const CacheImpl* cacheImpl, Pool* pool);
+
+  ~SerializedResultImpl() noexcept override = default;
+
+  const uint8_t* getBytes() const override;
+
+  size_t getLength() const override;
+
+  std::shared_ptr<Serializable> deserialize() const override;
+
+  size_t objectSize() const override;
+
+  /**
+   * Advance the input past the serialized value at its cursor without
+   * deserializing it. This is only possible for values whose length is
+   * encoded in, or implied by, their type header; for any other value false
+   * is returned and the cursor is left unchanged.
+   */
+  static bool skipValue(DataInput& input);
+
+ private:
+  std::shared_ptr<const uint8_t> m_buffer;
+  const uint8_t* m_bytes;
+  size_t m_length;
+  const CacheImpl* m_cacheImpl;
+  Pool* m_pool;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SERIALIZEDRESULTIMPL_H_
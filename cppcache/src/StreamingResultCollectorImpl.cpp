@@ -0,0 +1,209 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingResultCollectorImpl.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+const char* StreamingResultCollectorImpl::NC_StreamingResults =
+    "NC StreamingResults";
+
+class StreamingResultCollectorImpl::Forwarder : public ResultCollector {
+ public:
+  explicit Forwarder(StreamingResultCollectorImpl& collector)
+      : m_collector(collector) {}
+
+  ~Forwarder() noexcept override = default;
+
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout) override {
+    return m_collector.getResult(timeout);
+  }
+
+  void addResult(const std::shared_ptr<Cacheable>& result) override {
+    m_collector.addResult(result);
+  }
+
+  void endResults() override { m_collector.endResults(); }
+
+  void clearResults() override { m_collector.clearResults(); }
+
+ private:
+  StreamingResultCollectorImpl& m_collector;
+};
+
+StreamingResultCollectorImpl::StreamingResultCollectorImpl(size_t capacity,
+                                                           bool bounded)
+    : m_capacity(capacity),
+      m_bounded(bounded),
+      m_forwarder(std::make_shared<Forwarder>(*this)),
+      m_resultsDelivered(0),
+      m_done(false),
+      m_closed(false) {}
+
+StreamingResultCollectorImpl::~StreamingResultCollectorImpl() noexcept {
+  close();
+}
+
+void StreamingResultCollectorImpl::start(Execute execute) {
+  m_execute = std::move(execute);
+  m_executor = std::unique_ptr<Task<StreamingResultCollectorImpl>>(
+      new Task<StreamingResultCollectorImpl>(
+          this, &StreamingResultCollectorImpl::run, NC_StreamingResults));
+  m_executor->start();
+}
+
+int StreamingResultCollectorImpl::run(volatile bool&) {
+  std::exception_ptr error;
+  try {
+    m_execute(m_forwarder);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  finish(error);
+  return 0;
+}
+
+void StreamingResultCollectorImpl::finish(std::exception_ptr error) {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  // also completes executions of functions without results, for which the
+  // collector is replaced and endResults is never called
+  m_done = true;
+  m_error = error;
+  m_resultAvailable.notify_all();
+}
+
+bool StreamingResultCollectorImpl::hasNext() {
+  std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+  if (m_closed) {
+    throw IllegalStateException(
+        "StreamingResultCollector::hasNext: collector is closed");
+  }
+  m_resultAvailable.wait(lock,
+                         [this] { return m_done || !m_results.empty(); });
+  if (!m_results.empty()) {
+    return true;
+  }
+  if (m_error) {
+    std::rethrow_exception(m_error);
+  }
+  return false;
+}
+
+std::shared_ptr<Cacheable> StreamingResultCollectorImpl::next() {
+  if (!hasNext()) {
+    throw IllegalStateException(
+        "StreamingResultCollector::next: no more results");
+  }
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  auto result = std::move(m_results.front());
+  m_results.pop_front();
+  ++m_resultsDelivered;
+  m_spaceAvailable.notify_one();
+  return result;
+}
+
+void StreamingResultCollectorImpl::close() {
+  {
+    std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+    if (m_closed) {
+      return;
+    }
+    m_closed = true;
+    m_results.clear();
+    m_spaceAvailable.notify_all();
+    m_resultAvailable.notify_all();
+  }
+  if (m_executor) {
+    m_executor->stop();
+  }
+}
+
+std::shared_ptr<CacheableVector> StreamingResultCollectorImpl::getResult(
+    std::chrono::milliseconds timeout) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  auto results = CacheableVector::create();
+  std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+  while (true) {
+    if (!m_resultAvailable.wait_until(lock, deadline, [this] {
+          return m_closed || m_done || !m_results.empty();
+        })) {
+      throw FunctionExecutionException(
+          "Result is not ready, endResults callback is called before "
+          "invoking getResult() method");
+    }
+    if (m_closed) {
+      throw IllegalStateException(
+          "StreamingResultCollector::getResult: collector is closed");
+    }
+    if (m_results.empty()) {
+      break;
+    }
+    m_resultsDelivered += m_results.size();
+    results->insert(results->end(), m_results.begin(), m_results.end());
+    m_results.clear();
+    m_spaceAvailable.notify_all();
+  }
+  if (m_error) {
+    std::rethrow_exception(m_error);
+  }
+  return results;
+}
+
+void StreamingResultCollectorImpl::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+  if (m_closed) {
+    // keep draining the response, dropping the results
+    return;
+  }
+  if (m_bounded) {
+    // blocks the reading of the response until the consumer catches up
+    m_spaceAvailable.wait(
+        lock, [this] { return m_closed || m_results.size() < m_capacity; });
+    if (m_closed) {
+      return;
+    }
+  }
+  m_results.push_back(result);
+  m_resultAvailable.notify_one();
+}
+
+void StreamingResultCollectorImpl::endResults() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  m_done = true;
+  m_resultAvailable.notify_all();
+}
+
+void StreamingResultCollectorImpl::clearResults() {
+  std::lock_guard<decltype(m_mutex)> guard(m_mutex);
+  if (m_resultsDelivered > 0) {
+    throw FunctionExecutionException(
+        "StreamingResultCollector: function cannot be re-executed after "
+        "results have been consumed");
+  }
+  m_results.clear();
+  m_spaceAvailable.notify_all();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,114 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTORIMPL_H_
+#define GEODE_STREAMINGRESULTCOLLECTORIMPL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/StreamingResultCollector.hpp>
+#include <geode/internal/geode_globals.hpp>
+
+#include "Task.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * StreamingResultCollector that runs the function execution on a separate
+ * thread. The thread adding the results, which is the one reading the
+ * response from the connection, blocks once capacity results are buffered.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollectorImpl
+    : public StreamingResultCollector {
+ public:
+  typedef std::function<void(const std::shared_ptr<ResultCollector>&)>
+      Execute;
+
+  /**
+   * @param capacity the maximum number of buffered results
+   * @param bounded whether adding a result blocks once capacity is reached
+   */
+  StreamingResultCollectorImpl(size_t capacity, bool bounded);
+
+  ~StreamingResultCollectorImpl() noexcept override;
+
+  /**
+   * Start the function execution on the execution thread. The execution is
+   * passed the collector for its results.
+   */
+  void start(Execute execute);
+
+  bool hasNext() override;
+
+  std::shared_ptr<Cacheable> next() override;
+
+  void close() override;
+
+  /** wait for and return all the results that have not been consumed */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  void clearResults() override;
+
+ private:
+  class Forwarder;
+
+  int run(volatile bool& isRunning);
+
+  void finish(std::exception_ptr error);
+
+  size_t m_capacity;
+  bool m_bounded;
+  Execute m_execute;
+  // the collector handed to the execution, which refers back to this one
+  // without owning it
+  std::shared_ptr<ResultCollector> m_forwarder;
+  std::mutex m_mutex;
+  std::condition_variable m_resultAvailable;
+  std::condition_variable m_spaceAvailable;
+  std::deque<std::shared_ptr<Cacheable>> m_results;
+  size_t m_resultsDelivered;
+  bool m_done;
+  bool m_closed;
+  std::exception_ptr m_error;
+  std::unique_ptr<Task<StreamingResultCollectorImpl>> m_executor;
+
+  static const char* NC_StreamingResults;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTORIMPL_H_
@@ -28,6 +28,12 @@ Struct::Struct(StructSet* ssPtr,
                std::vector<std::shared_ptr<Serializable>>& fieldValues)
     : m_parent(ssPtr), m_fieldValues(fieldValues) {}
 
+Struct::Struct(std::shared_ptr<StructSet> ssPtr,
+               std::vector<std::shared_ptr<Serializable>>& fieldValues)
+    : m_parent(ssPtr.get()),
+      m_sharedParent(std::move(ssPtr)),
+      m_fieldValues(fieldValues) {}
+
 void Struct::skipClassName(DataInput& input) {
   if (input.read() == static_cast<int8_t>(DSCode::Class)) {
     input.read();  // ignore string type id - assuming its a normal
@@ -55,6 +61,7 @@ void Struct::fromData(DataInput& input) {
   int32_t numOfFields = input.readArrayLength();
 
   m_parent = nullptr;
+  m_sharedParent = nullptr;
   for (int32_t i = 0; i < numOfFields; i++) {
     m_fieldNameToIndex.emplace(input.readString(), i);
   }
@@ -109,6 +116,9 @@ const std::shared_ptr<Serializable> Struct::operator[](
 }
 
 const std::shared_ptr<StructSet> Struct::getStructSet() const {
+  if (m_sharedParent) {
+    return m_sharedParent;
+  }
   return std::shared_ptr<StructSet>(m_parent);
 }
 
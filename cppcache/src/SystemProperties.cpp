@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <cstdint>
 #include <cstdlib>
 #include <string>
 #include <thread>
@@ -48,8 +49,12 @@ const char ConnectionPoolSize[] = "connection-pool-size";
 const char CacheXMLFile[] = "cache-xml-file";
 const char LogFileSizeLimit[] = "log-file-size-limit";
 const char LogDiskSpaceLimit[] = "log-disk-space-limit";
+const char LogQueueSize[] = "log-queue-size";
+const char LogQueueDropWhenFull[] = "log-queue-drop-when-full";
 const char StatsFileSizeLimit[] = "archive-file-size-limit";
 const char StatsDiskSpaceLimit[] = "archive-disk-space-limit";
+const char StatisticExporterPort[] = "statistic-exporter-port";
+const char StatisticExporterBindAddress[] = "statistic-exporter-bind-address";
 const char HeapLRULimit[] = "heap-lru-limit";
 const char HeapLRUDelta[] = "heap-lru-delta";
 const char MaxSocketBufferSize[] = "max-socket-buffer-size";
@@ -76,8 +81,10 @@ const char SslKeystorePassword[] = "ssl-keystore-password";
 const char ThreadPoolSize[] = "max-fe-threads";
 const char SuspendedTxTimeout[] = "suspended-tx-timeout";
 const char EnableChunkHandlerThread[] = "enable-chunk-handler-thread";
+const char ChunkDecodeThreads[] = "chunk-decode-threads";
 const char OnClientDisconnectClearPdxTypeIds[] =
     "on-client-disconnect-clear-pdxType-Ids";
+const char PdxPrefetchTypes[] = "pdx-prefetch-types";
 const char TombstoneTimeoutInMSec[] = "tombstone-timeout";
 const char DefaultConflateEvents[] = "server";
 
@@ -111,9 +118,15 @@ const char DefaultName[] = "";
 const char DefaultCacheXMLFile[] = "";
 const uint32_t DefaultLogFileSizeLimit = 0;     // = unlimited
 const uint32_t DefaultLogDiskSpaceLimit = 0;    // = unlimited
+const uint32_t DefaultLogQueueSize = 0;         // = log synchronously
+const bool DefaultLogQueueDropWhenFull = false;
 const uint32_t DefaultStatsFileSizeLimit = 0;   // = unlimited
 const uint32_t DefaultStatsDiskSpaceLimit = 0;  // = unlimited
 
+// statistics are not served unless a port is configured
+const uint16_t DefaultStatisticExporterPort = 0;
+const char DefaultStatisticExporterBindAddress[] = "127.0.0.1";
+
 const size_t DefaultHeapLRULimit = 0;    // = unlimited, disabled when it is 0
 const int32_t DefaultHeapLRUDelta = 10;  // = unlimited, disabled when it is 0
 
@@ -128,7 +141,11 @@ constexpr auto DefaultSuspendedTxTimeout = std::chrono::seconds(30);
 constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
 const bool DefaultEnableChunkHandlerThread = false;
+// chunks are decoded by the thread handling them
+const uint32_t DefaultChunkDecodeThreads = 0;
 const bool DefaultOnClientDisconnectClearPdxTypeIds = false;
+// pdx types are fetched from the server as they are first used
+const bool DefaultPdxPrefetchTypes = false;
 
 }  // namespace
 
@@ -156,8 +173,12 @@ SystemProperties::SystemProperties(
       m_cacheXMLFile(DefaultCacheXMLFile),
       m_logFileSizeLimit(DefaultLogFileSizeLimit),
       m_logDiskSpaceLimit(DefaultLogDiskSpaceLimit),
+      m_logQueueSize(DefaultLogQueueSize),
+      m_logQueueDropWhenFull(DefaultLogQueueDropWhenFull),
       m_statsFileSizeLimit(DefaultStatsFileSizeLimit),
       m_statsDiskSpaceLimit(DefaultStatsDiskSpaceLimit),
+      m_statisticExporterPort(DefaultStatisticExporterPort),
+      m_statisticExporterBindAddress(DefaultStatisticExporterBindAddress),
       m_connectionPoolSize(DefaultConnectionPoolSize),
       m_heapLRULimit(DefaultHeapLRULimit),
       m_heapLRUDelta(DefaultHeapLRUDelta),
@@ -185,8 +206,10 @@ SystemProperties::SystemProperties(
       m_suspendedTxTimeout(DefaultSuspendedTxTimeout),
       m_tombstoneTimeout(DefaultTombstoneTimeout),
       m_enableChunkHandlerThread(DefaultEnableChunkHandlerThread),
+      m_chunkDecodeThreads(DefaultChunkDecodeThreads),
       m_onClientDisconnectClearPdxTypeIds(
-          DefaultOnClientDisconnectClearPdxTypeIds) {
+          DefaultOnClientDisconnectClearPdxTypeIds),
+      m_pdxPrefetchTypes(DefaultPdxPrefetchTypes) {
   // now that defaults are set, consume files and override the defaults.
   class ProcessPropsVisitor : public Properties::Visitor {
     SystemProperties* m_sysProps;
@@ -346,10 +369,22 @@ void SystemProperties::processProperty(const std::string& property,
     m_logFileSizeLimit = std::stol(value);
   } else if (property == LogDiskSpaceLimit) {
     m_logDiskSpaceLimit = std::stol(value);
+  } else if (property == LogQueueSize) {
+    m_logQueueSize = std::stoul(value);
+  } else if (property == LogQueueDropWhenFull) {
+    m_logQueueDropWhenFull = parseBooleanProperty(property, value);
   } else if (property == StatsFileSizeLimit) {
     m_statsFileSizeLimit = std::stol(value);
   } else if (property == StatsDiskSpaceLimit) {
     m_statsDiskSpaceLimit = std::stol(value);
+  } else if (property == StatisticExporterPort) {
+    auto port = std::stoul(value);
+    if (port > UINT16_MAX) {
+      throwError(("SystemProperties: invalid port " + property + "=" + value));
+    }
+    m_statisticExporterPort = static_cast<uint16_t>(port);
+  } else if (property == StatisticExporterBindAddress) {
+    m_statisticExporterBindAddress = value;
   } else if (property == HeapLRULimit) {
     m_heapLRULimit = std::stol(value);
   } else if (property == HeapLRUDelta) {
@@ -360,8 +395,12 @@ void SystemProperties::processProperty(const std::string& property,
     parseDurationProperty(property, std::string(value), m_tombstoneTimeout);
   } else if (property == EnableChunkHandlerThread) {
     m_enableChunkHandlerThread = parseBooleanProperty(property, value);
+  } else if (property == ChunkDecodeThreads) {
+    m_chunkDecodeThreads = std::stoul(value);
   } else if (property == OnClientDisconnectClearPdxTypeIds) {
     m_onClientDisconnectClearPdxTypeIds = parseBooleanProperty(property, value);
+  } else if (property == PdxPrefetchTypes) {
+    m_pdxPrefetchTypes = parseBooleanProperty(property, value);
   } else {
     throwError("SystemProperties: unknown property: " + property + "=" + value);
   }
@@ -389,6 +428,9 @@ void SystemProperties::logSettings() {
   settings += "\n  cache-xml-file = ";
   settings += cacheXMLFile();
 
+  settings += "\n  chunk-decode-threads = ";
+  settings += std::to_string(chunkDecodeThreads());
+
   settings += "\n  conflate-events = ";
   settings += conflateEvents();
 
@@ -439,6 +481,12 @@ void SystemProperties::logSettings() {
   settings += "\n  log-level = ";
   settings += Log::levelToChars(logLevel());
 
+  settings += "\n  log-queue-drop-when-full = ";
+  settings += logQueueDropWhenFull() ? "true" : "false";
+
+  settings += "\n  log-queue-size = ";
+  settings += std::to_string(logQueueSize());
+
   settings += "\n  max-fe-threads = ";
   settings += std::to_string(threadPoolSize());
 
@@ -454,6 +502,9 @@ void SystemProperties::logSettings() {
   settings += "\n  on-client-disconnect-clear-pdxType-Ids = ";
   settings += onClientDisconnectClearPdxTypeIds() ? "true" : "false";
 
+  settings += "\n  pdx-prefetch-types = ";
+  settings += pdxPrefetchTypes() ? "true" : "false";
+
   // *** PLEASE ADD IN ALPHABETICAL ORDER - USER VISIBLE ***
 
   settings += "\n  ping-interval = ";
@@ -480,6 +531,12 @@ void SystemProperties::logSettings() {
   settings += "\n  statistic-archive-file = ";
   settings += statisticsArchiveFile();
 
+  settings += "\n  statistic-exporter-bind-address = ";
+  settings += statisticExporterBindAddress();
+
+  settings += "\n  statistic-exporter-port = ";
+  settings += std::to_string(statisticExporterPort());
+
   settings += "\n  statistic-sampling-enabled = ";
   settings += statisticsEnabled() ? "true" : "false";
 
@@ -0,0 +1,79 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TcrChunkedContext.hpp"
+
+#include "CacheImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+TcrChunkedResult::~TcrChunkedResult() noexcept = default;
+
+bool TcrChunkedResult::canDecodeInParallel(
+    const CacheImpl* cacheImpl, uint8_t isLastChunkWithSecurity) const {
+  return cacheImpl->getChunkDecodePool() != nullptr &&
+         (isLastChunkWithSecurity & 0x02) == 0;
+}
+
+void TcrChunkedResult::decodeInOrder(const CacheImpl* cacheImpl,
+                                     OrderedChunkDecoder::Decode decode) {
+  if (m_decoder == nullptr) {
+    m_decoder = std::unique_ptr<OrderedChunkDecoder>(
+        new OrderedChunkDecoder(*cacheImpl->getChunkDecodePool()));
+  }
+  if (appDomainContext) {
+    auto context = appDomainContext.get();
+    auto decodeInContext = std::move(decode);
+    decode = [context, decodeInContext]() {
+      OrderedChunkDecoder::Apply apply;
+      context->run([&apply, &decodeInContext]() { apply = decodeInContext(); });
+      return apply;
+    };
+  }
+  m_decoder->submit(std::move(decode));
+}
+
+void TcrChunkedResult::applyDecodedChunks() {
+  if (m_decoder != nullptr) {
+    m_decoder->drain();
+  }
+}
+
+void TcrChunkedResult::discardDecodedChunks() {
+  if (m_decoder != nullptr) {
+    m_decoder->discard();
+  }
+}
+
+void TcrChunkedResult::fireDrainChunks() {
+  if (m_decoder == nullptr) {
+    return;
+  }
+  if (exceptionOccurred()) {
+    m_decoder->discard();
+  } else if (appDomainContext) {
+    appDomainContext->run([this]() { m_decoder->drain(); });
+  } else {
+    m_decoder->drain();
+  }
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -26,6 +26,7 @@
 #include <ace/Semaphore.h>
 
 #include "AppDomainContext.hpp"
+#include "OrderedChunkDecoder.hpp"
 #include "Utils.hpp"
 
 namespace apache {
@@ -42,15 +43,51 @@ class TcrChunkedResult {
   std::shared_ptr<Exception> m_ex;
   bool m_inSameThread;
   std::unique_ptr<AppDomainContext> appDomainContext;
+  std::shared_ptr<const uint8_t> m_chunk;
+  std::unique_ptr<OrderedChunkDecoder> m_decoder;
 
  protected:
   uint16_t m_dsmemId;
 
+  /**
+   * The buffer of the chunk being handled; holding a reference keeps the
+   * chunk bytes valid after handleChunk returns.
+   */
+  inline const std::shared_ptr<const uint8_t>& getChunk() const {
+    return m_chunk;
+  }
+
   /** handle a chunk of response message from server */
   virtual void handleChunk(const uint8_t* bytes, int32_t len,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl) = 0;
 
+  /**
+   * Whether the rest of the chunk being handled can be decoded by
+   * decodeInOrder: the cache has a chunk decode pool, and the chunk does not
+   * end with the secure part, which has to be read into the message.
+   */
+  bool canDecodeInParallel(const CacheImpl* cacheImpl,
+                           uint8_t isLastChunkWithSecurity) const;
+
+  /**
+   * Runs decode on the chunk decode pool of the cache; the function it
+   * returns is called with the decoded chunk in the order of the chunks,
+   * from handleChunk or after the last chunk. Decode may not change this
+   * object and must hold a reference to the bytes of the chunk, see getChunk.
+   */
+  void decodeInOrder(const CacheImpl* cacheImpl,
+                     OrderedChunkDecoder::Decode decode);
+
+  /**
+   * Wait for the chunks being decoded and apply them, before a chunk is
+   * handled without decodeInOrder.
+   */
+  void applyDecodedChunks();
+
+  /** drop the chunks still being decoded, for reset */
+  void discardDecodedChunks();
+
  public:
   inline TcrChunkedResult()
       : m_finalizeSema(nullptr),
@@ -58,7 +95,7 @@ class TcrChunkedResult {
         m_inSameThread(false),
         appDomainContext(createAppDomainContext()),
         m_dsmemId(0) {}
-  virtual ~TcrChunkedResult() {}
+  virtual ~TcrChunkedResult() noexcept;
   void setFinalizeSemaphore(ACE_Semaphore* finalizeSema) {
     m_finalizeSema = finalizeSema;
   }
@@ -70,9 +107,11 @@ class TcrChunkedResult {
    */
   virtual void reset() = 0;
 
-  void fireHandleChunk(const uint8_t* bytes, int32_t len,
-                       uint8_t isLastChunkWithSecurity,
+  void fireHandleChunk(const std::shared_ptr<const uint8_t>& chunk,
+                       int32_t len, uint8_t isLastChunkWithSecurity,
                        const CacheImpl* cacheImpl) {
+    m_chunk = chunk;
+    const uint8_t* bytes = chunk.get();
     if (appDomainContext) {
       appDomainContext->run(
           [this, bytes, len, isLastChunkWithSecurity, cacheImpl]() {
@@ -81,8 +120,12 @@ class TcrChunkedResult {
     } else {
       handleChunk(bytes, len, isLastChunkWithSecurity, cacheImpl);
     }
+    m_chunk = nullptr;
   }
 
+  /** apply the chunks still being decoded, after the last chunk */
+  void fireDrainChunks();
+
   /**
    * Send signal from chunk processor thread that processing of chunks
    * is complete
@@ -128,7 +171,7 @@ class TcrChunkedResult {
  */
 class TcrChunkedContext {
  private:
-  const uint8_t* m_bytes;
+  const std::shared_ptr<const uint8_t> m_bytes;
   const int32_t m_len;
   const uint8_t m_isLastChunkWithSecurity;
   const CacheImpl* m_cache;
@@ -139,46 +182,55 @@ class TcrChunkedContext {
                            TcrChunkedResult* result,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl)
-      : m_bytes(bytes),
+      : m_bytes(bytes, std::default_delete<const uint8_t[]>()),
         m_len(len),
         m_isLastChunkWithSecurity(isLastChunkWithSecurity),
         m_cache(cacheImpl),
         m_result(result) {}
 
-  inline ~TcrChunkedContext() { _GEODE_SAFE_DELETE_ARRAY(m_bytes); }
+  inline ~TcrChunkedContext() = default;
 
-  inline const uint8_t* getBytes() const { return m_bytes; }
+  inline const uint8_t* getBytes() const { return m_bytes.get(); }
 
   inline int32_t getLen() const { return m_len; }
 
   void handleChunk(bool inSameThread) {
     if (m_bytes == nullptr) {
       // this is the last chunk for some set of chunks
+      handle([this]() { m_result->fireDrainChunks(); });
       m_result->finalize(inSameThread);
     } else if (!m_result->exceptionOccurred()) {
-      try {
+      handle([this]() {
         m_result->fireHandleChunk(m_bytes, m_len, m_isLastChunkWithSecurity,
                                   m_cache);
-      } catch (Exception& ex) {
-        LOGERROR("HandleChunk error message %s, name = %s", ex.what(),
-                 ex.getName().c_str());
-        m_result->setException(std::make_shared<Exception>(ex));
-      } catch (std::exception& stdEx) {
-        std::string exMsg("HandleChunk exception:: ");
-        exMsg += stdEx.what();
-        LOGERROR("HandleChunk exception: %s", stdEx.what());
-        auto ex = std::make_shared<UnknownException>(exMsg.c_str());
-        m_result->setException(ex);
-      } catch (...) {
-        std::string exMsg("Unknown exception in ");
-        exMsg += Utils::demangleTypeName(typeid(*m_result).name());
-        exMsg +=
-            "::handleChunk while processing response, possible serialization "
-            "mismatch";
-        LOGERROR(exMsg.c_str());
-        auto ex = std::make_shared<UnknownException>(exMsg.c_str());
-        m_result->setException(ex);
-      }
+      });
+    }
+  }
+
+ private:
+  template <class Handler>
+  void handle(Handler handler) {
+    try {
+      handler();
+    } catch (Exception& ex) {
+      LOGERROR("HandleChunk error message %s, name = %s", ex.what(),
+               ex.getName().c_str());
+      m_result->setException(std::make_shared<Exception>(ex));
+    } catch (std::exception& stdEx) {
+      std::string exMsg("HandleChunk exception:: ");
+      exMsg += stdEx.what();
+      LOGERROR("HandleChunk exception: %s", stdEx.what());
+      auto ex = std::make_shared<UnknownException>(exMsg.c_str());
+      m_result->setException(ex);
+    } catch (...) {
+      std::string exMsg("Unknown exception in ");
+      exMsg += Utils::demangleTypeName(typeid(*m_result).name());
+      exMsg +=
+          "::handleChunk while processing response, possible serialization "
+          "mismatch";
+      LOGERROR(exMsg.c_str());
+      auto ex = std::make_shared<UnknownException>(exMsg.c_str());
+      m_result->setException(ex);
     }
   }
 };
@@ -31,6 +31,8 @@
 #include "DiskStoreId.hpp"
 #include "DiskVersionTag.hpp"
 #include "DistributedSystem.hpp"
+#include "PreparedFunction.hpp"
+#include "PreparedQuery.hpp"
 #include "StackTrace.hpp"
 #include "TSSTXStateWrapper.hpp"
 #include "TXState.hpp"
@@ -946,6 +948,25 @@ void TcrMessage::handleByteArrayResponse(
         // PdxType will come in response
         input.advanceCursor(5);  // part header
         m_value = serializationRegistry.deserialize(input);
+      } else if (m_msgTypeRequest == TcrMessage::GET_PDX_TYPES) {
+        // Map of type id to PdxType will come in response. The types are
+        // read the way GET_PDX_TYPE_BY_ID reads a single one.
+        input.advanceCursor(5);  // part header
+        auto types = CacheableHashMap::create();
+        if (static_cast<DSCode>(input.read()) == DSCode::CacheableHashMap) {
+          auto size = input.readArrayLength();
+          for (int32_t i = 0; i < size; i++) {
+            auto typeId = std::dynamic_pointer_cast<CacheableKey>(
+                serializationRegistry.deserialize(input));
+            (*types)[typeId] = serializationRegistry.deserialize(
+                input, static_cast<int8_t>(DSCode::PdxType));
+          }
+        }
+        m_value = types;
+      } else if (m_msgTypeRequest == TcrMessage::GET_PDX_ENUMS) {
+        // Map of enum id to EnumInfo will come in response
+        input.advanceCursor(5);  // part header
+        m_value = serializationRegistry.deserialize(input);
       } else if (m_msgTypeRequest == TcrMessage::GET_FUNCTION_ATTRIBUTES) {
         // read and ignore length
         input.readInt32();
@@ -1471,6 +1492,31 @@ TcrMessageQuery::TcrMessageQuery(
   writeMessageLength();
 }
 
+TcrMessageQuery::TcrMessageQuery(
+    DataOutput* dataOutput, const PreparedQuery& query,
+    std::chrono::milliseconds messageResponsetimeout,
+    ThinClientBaseDM* connectionDM) {
+  m_request.reset(dataOutput);
+  m_msgType = TcrMessage::QUERY;
+  m_tcdm = connectionDM;
+  m_timeout = DEFAULT_TIMEOUT_SECONDS;
+  m_messageResponseTimeout = messageResponsetimeout;
+  m_region = nullptr;
+  uint32_t numOfParts = 2;
+
+  if (m_messageResponseTimeout >= std::chrono::milliseconds::zero()) {
+    numOfParts++;
+  }
+  writeHeader(m_msgType, numOfParts);
+  const auto& queryPart = query.getQueryPart();
+  m_request->writeBytesOnly(queryPart.data(), queryPart.size());
+  writeEventIdPart();
+  if (m_messageResponseTimeout >= std::chrono::milliseconds::zero()) {
+    writeMillisecondsPart(m_messageResponseTimeout);
+  }
+  writeMessageLength();
+}
+
 TcrMessageStopCQ::TcrMessageStopCQ(
     DataOutput* dataOutput, const std::string& regionName,
     std::chrono::milliseconds messageResponsetimeout,
@@ -1555,6 +1601,40 @@ TcrMessageQueryWithParameters::TcrMessageQueryWithParameters(
   // Part-3: X (COMPILE_QUERY_CLEAR_TIMEOUT) parameter
   writeIntPart(15);
 
+  writeParameterParts(paramList);
+}
+
+TcrMessageQueryWithParameters::TcrMessageQueryWithParameters(
+    DataOutput* dataOutput, const PreparedQuery& query,
+    const std::shared_ptr<CacheableVector>& paramList,
+    std::chrono::milliseconds messageResponsetimeout,
+    ThinClientBaseDM* connectionDM) {
+  m_request.reset(dataOutput);
+  m_msgType = TcrMessage::QUERY_WITH_PARAMETERS;
+  m_tcdm = connectionDM;
+  m_timeout = DEFAULT_TIMEOUT_SECONDS;
+  m_messageResponseTimeout = messageResponsetimeout;
+  m_region = nullptr;
+
+  const auto& queryPart = query.getQueryPart();
+  m_request->ensureCapacity(queryPart.size() + 64);
+
+  uint32_t numOfParts = 4 + static_cast<uint32_t>(paramList->size());
+  writeHeader(m_msgType, numOfParts);
+  // Part-1: Query String
+  m_request->writeBytesOnly(queryPart.data(), queryPart.size());
+
+  // Part-2: Number or length of the parameters
+  writeIntPart(static_cast<uint32_t>(paramList->size()));
+
+  // Part-3: X (COMPILE_QUERY_CLEAR_TIMEOUT) parameter
+  writeIntPart(15);
+
+  writeParameterParts(paramList);
+}
+
+void TcrMessageQueryWithParameters::writeParameterParts(
+    const std::shared_ptr<CacheableVector>& paramList) {
   // Part-4: Request specific timeout
   if (m_messageResponseTimeout >= std::chrono::milliseconds::zero()) {
     writeMillisecondsPart(m_messageResponseTimeout);
@@ -2345,6 +2425,13 @@ TcrMessageExecuteCqWithIr::TcrMessageExecuteCqWithIr(
 TcrMessageExecuteFunction::TcrMessageExecuteFunction(
     DataOutput* dataOutput, const std::string& funcName,
     const std::shared_ptr<Cacheable>& args, uint8_t getResult,
+    ThinClientBaseDM* connectionDM, std::chrono::milliseconds timeout)
+    : TcrMessageExecuteFunction(dataOutput, PreparedFunction(funcName), args,
+                                getResult, connectionDM, timeout) {}
+
+TcrMessageExecuteFunction::TcrMessageExecuteFunction(
+    DataOutput* dataOutput, const PreparedFunction& function,
+    const std::shared_ptr<Cacheable>& args, uint8_t getResult,
     ThinClientBaseDM* connectionDM, std::chrono::milliseconds timeout) {
   m_request.reset(dataOutput);
 
@@ -2355,7 +2442,8 @@ TcrMessageExecuteFunction::TcrMessageExecuteFunction(
   uint32_t numOfParts = 3;
   writeHeader(m_msgType, numOfParts);
   writeByteAndTimeOutPart(getResult, timeout);
-  writeRegionPart(funcName);  // function name string
+  const auto& functionPart = function.getFunctionPart();
+  m_request->writeBytesOnly(functionPart.data(), functionPart.size());
   writeObjectPart(args);
   writeMessageLength();
 }
@@ -2366,6 +2454,17 @@ TcrMessageExecuteRegionFunction::TcrMessageExecuteRegionFunction(
     std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
     std::shared_ptr<CacheableHashSet> failedNodes,
     std::chrono::milliseconds timeout, ThinClientBaseDM* connectionDM,
+    int8_t reExecute)
+    : TcrMessageExecuteRegionFunction(
+          dataOutput, PreparedFunction(funcName), region, args, routingObj,
+          getResult, failedNodes, timeout, connectionDM, reExecute) {}
+
+TcrMessageExecuteRegionFunction::TcrMessageExecuteRegionFunction(
+    DataOutput* dataOutput, const PreparedFunction& function,
+    const Region* region, const std::shared_ptr<Cacheable>& args,
+    std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
+    std::shared_ptr<CacheableHashSet> failedNodes,
+    std::chrono::milliseconds timeout, ThinClientBaseDM* connectionDM,
     int8_t reExecute) {
   m_request.reset(dataOutput);
 
@@ -2391,7 +2490,8 @@ TcrMessageExecuteRegionFunction::TcrMessageExecuteRegionFunction(
   writeHeader(m_msgType, numOfParts);
   writeByteAndTimeOutPart(getResult, timeout);
   writeRegionPart(m_regionName);
-  writeRegionPart(funcName);  // function name string
+  const auto& functionPart = function.getFunctionPart();
+  m_request->writeBytesOnly(functionPart.data(), functionPart.size());
   writeObjectPart(args);
   // klug for MemberMappedArgs
   writeObjectPart(nullptr);
@@ -2419,6 +2519,17 @@ TcrMessageExecuteRegionFunctionSingleHop::
         const Region* region, const std::shared_ptr<Cacheable>& args,
         std::shared_ptr<CacheableHashSet> routingObj, uint8_t getResult,
         std::shared_ptr<CacheableHashSet> failedNodes, bool allBuckets,
+        std::chrono::milliseconds timeout, ThinClientBaseDM* connectionDM)
+    : TcrMessageExecuteRegionFunctionSingleHop(
+          dataOutput, PreparedFunction(funcName), region, args, routingObj,
+          getResult, failedNodes, allBuckets, timeout, connectionDM) {}
+
+TcrMessageExecuteRegionFunctionSingleHop::
+    TcrMessageExecuteRegionFunctionSingleHop(
+        DataOutput* dataOutput, const PreparedFunction& function,
+        const Region* region, const std::shared_ptr<Cacheable>& args,
+        std::shared_ptr<CacheableHashSet> routingObj, uint8_t getResult,
+        std::shared_ptr<CacheableHashSet> failedNodes, bool allBuckets,
         std::chrono::milliseconds timeout, ThinClientBaseDM* connectionDM) {
   m_request.reset(dataOutput);
 
@@ -2439,7 +2550,8 @@ TcrMessageExecuteRegionFunctionSingleHop::
   writeHeader(m_msgType, numOfParts);
   writeByteAndTimeOutPart(getResult, timeout);
   writeRegionPart(m_regionName);
-  writeRegionPart(funcName);  // function name string
+  const auto& functionPart = function.getFunctionPart();
+  m_request->writeBytesOnly(functionPart.data(), functionPart.size());
   writeObjectPart(args);
   // klug for MemberMappedArgs
   writeObjectPart(nullptr);
@@ -2746,6 +2858,36 @@ TcrMessageGetPdxEnumById::TcrMessageGetPdxEnumById(
                .c_str());
 }
 
+TcrMessageGetPdxTypes::TcrMessageGetPdxTypes(DataOutput* dataOutput,
+                                             ThinClientBaseDM* connectionDM) {
+  m_request.reset(dataOutput);
+  m_msgType = TcrMessage::GET_PDX_TYPES;
+  m_tcdm = connectionDM;
+
+  LOGDEBUG("Tcrmessage sending GET_PDX_TYPES message to server");
+  // the server ignores the part, but a message must have at least one
+  writeHeader(m_msgType, 1);
+  m_request->writeInt(4);
+  m_request->writeBoolean(false);
+  m_request->writeInt(0);
+  writeMessageLength();
+}
+
+TcrMessageGetPdxEnums::TcrMessageGetPdxEnums(DataOutput* dataOutput,
+                                             ThinClientBaseDM* connectionDM) {
+  m_request.reset(dataOutput);
+  m_msgType = TcrMessage::GET_PDX_ENUMS;
+  m_tcdm = connectionDM;
+
+  LOGDEBUG("Tcrmessage sending GET_PDX_ENUMS message to server");
+  // the server ignores the part, but a message must have at least one
+  writeHeader(m_msgType, 1);
+  m_request->writeInt(4);
+  m_request->writeBoolean(false);
+  m_request->writeInt(0);
+  writeMessageLength();
+}
+
 TcrMessageGetFunctionAttributes::TcrMessageGetFunctionAttributes(
     DataOutput* dataOutput, const std::string& funcName,
     ThinClientBaseDM* connectionDM) {
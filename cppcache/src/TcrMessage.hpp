@@ -51,6 +51,8 @@ namespace geode {
 namespace client {
 
 class TcrMessage;
+class PreparedFunction;
+class PreparedQuery;
 class ThinClientRegion;
 class ThinClientBaseDM;
 class TcrMessageHelper;
@@ -170,6 +172,8 @@ class APACHE_GEODE_EXPORT TcrMessage {
     SERVER_TO_CLIENT_PING = 99,
     // GATEWAY_RECEIVER_COMMAND = 99,
     GET_ALL_70 = 100,
+    GET_PDX_TYPES = 101,
+    GET_PDX_ENUMS = 102,
     TOMBSTONE_OPERATION = 103,
     GETDURABLECQS_MSG_TYPE = 105,
     GET_DURABLE_CQS_DATA_ERROR = 106,
@@ -204,6 +208,8 @@ class APACHE_GEODE_EXPORT TcrMessage {
           msgType == TcrMessage::ADD_PDX_ENUM ||
           msgType == TcrMessage::GET_PDX_ENUM_BY_ID ||
           msgType == TcrMessage::GET_PDX_ID_FOR_ENUM ||
+          msgType == TcrMessage::GET_PDX_TYPES ||
+          msgType == TcrMessage::GET_PDX_ENUMS ||
           msgType == TcrMessage::COMMIT || msgType == TcrMessage::ROLLBACK)) {
       return true;
     }
@@ -686,6 +692,11 @@ class TcrMessageQuery : public TcrMessage {
                   std::chrono::milliseconds messageResponsetimeout,
                   ThinClientBaseDM* connectionDM);
 
+  /** uses the pre-encoded query string part of a compiled query */
+  TcrMessageQuery(DataOutput* dataOutput, const PreparedQuery& query,
+                  std::chrono::milliseconds messageResponsetimeout,
+                  ThinClientBaseDM* connectionDM);
+
   virtual ~TcrMessageQuery() {}
 
  private:
@@ -722,8 +733,18 @@ class TcrMessageQueryWithParameters : public TcrMessage {
       std::chrono::milliseconds messageResponsetimeout,
       ThinClientBaseDM* connectionDM);
 
+  /** uses the pre-encoded query string part of a compiled query */
+  TcrMessageQueryWithParameters(
+      DataOutput* dataOutput, const PreparedQuery& query,
+      const std::shared_ptr<CacheableVector>& paramList,
+      std::chrono::milliseconds messageResponsetimeout,
+      ThinClientBaseDM* connectionDM);
+
   virtual ~TcrMessageQueryWithParameters() {}
 
+ private:
+  void writeParameterParts(const std::shared_ptr<CacheableVector>& paramList);
+
  private:
 };
 
@@ -976,6 +997,14 @@ class TcrMessageExecuteRegionFunction : public TcrMessage {
       std::chrono::milliseconds timeout,
       ThinClientBaseDM* connectionDM = nullptr, int8_t reExecute = 0);
 
+  TcrMessageExecuteRegionFunction(
+      DataOutput* dataOutput, const PreparedFunction& function,
+      const Region* region, const std::shared_ptr<Cacheable>& args,
+      std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
+      std::shared_ptr<CacheableHashSet> failedNodes,
+      std::chrono::milliseconds timeout,
+      ThinClientBaseDM* connectionDM = nullptr, int8_t reExecute = 0);
+
   virtual ~TcrMessageExecuteRegionFunction() {}
 
  private:
@@ -990,6 +1019,13 @@ class TcrMessageExecuteRegionFunctionSingleHop : public TcrMessage {
       std::shared_ptr<CacheableHashSet> failedNodes, bool allBuckets,
       std::chrono::milliseconds timeout, ThinClientBaseDM* connectionDM);
 
+  TcrMessageExecuteRegionFunctionSingleHop(
+      DataOutput* dataOutput, const PreparedFunction& function,
+      const Region* region, const std::shared_ptr<Cacheable>& args,
+      std::shared_ptr<CacheableHashSet> routingObj, uint8_t getResult,
+      std::shared_ptr<CacheableHashSet> failedNodes, bool allBuckets,
+      std::chrono::milliseconds timeout, ThinClientBaseDM* connectionDM);
+
   virtual ~TcrMessageExecuteRegionFunctionSingleHop() {}
 
  private:
@@ -1108,6 +1144,26 @@ class TcrMessageGetPdxEnumById : public TcrMessage {
  private:
 };
 
+class TcrMessageGetPdxTypes : public TcrMessage {
+ public:
+  TcrMessageGetPdxTypes(DataOutput* dataOutput,
+                        ThinClientBaseDM* connectionDM);
+
+  virtual ~TcrMessageGetPdxTypes() {}
+
+ private:
+};
+
+class TcrMessageGetPdxEnums : public TcrMessage {
+ public:
+  TcrMessageGetPdxEnums(DataOutput* dataOutput,
+                        ThinClientBaseDM* connectionDM);
+
+  virtual ~TcrMessageGetPdxEnums() {}
+
+ private:
+};
+
 class TcrMessageGetFunctionAttributes : public TcrMessage {
  public:
   TcrMessageGetFunctionAttributes(DataOutput* dataOutput,
@@ -1178,6 +1234,12 @@ class TcrMessageExecuteFunction : public TcrMessage {
                             uint8_t getResult, ThinClientBaseDM* connectionDM,
                             std::chrono::milliseconds timeout);
 
+  TcrMessageExecuteFunction(DataOutput* dataOutput,
+                            const PreparedFunction& function,
+                            const std::shared_ptr<Cacheable>& args,
+                            uint8_t getResult, ThinClientBaseDM* connectionDM,
+                            std::chrono::milliseconds timeout);
+
   virtual ~TcrMessageExecuteFunction() {}
 
  private:
@@ -31,6 +31,7 @@
 #include "ExpiryHandler_T.hpp"
 #include "ExpiryTaskManager.hpp"
 #include "NonCopyable.hpp"
+#include "PdxTypeRegistry.hpp"
 #include "TcrEndpoint.hpp"
 #include "ThinClientRegion.hpp"
 #include "ThinClientStickyManager.hpp"
@@ -237,6 +238,18 @@ void ThinClientPoolDM::init() {
     ThinClientPoolDM::startBackgroundThreads();
   }
 
+  // multiuser pools can only send requests on behalf of a user
+  if (sysProp.pdxPrefetchTypes() && !m_isMultiUserMode) {
+    try {
+      cacheImpl->getPdxTypeRegistry()->prefetchTypes(this);
+    } catch (const Exception& ex) {
+      LOGWARN(
+          "ThinClientPoolDM::init: failed to prefetch pdx types for pool %s, "
+          "they will be fetched as they are used: %s",
+          m_poolName.c_str(), ex.what());
+    }
+  }
+
   LOGDEBUG("ThinClientPoolDM::init: Completed initialization");
 }
 std::shared_ptr<Properties> ThinClientPoolDM::getCredentials(TcrEndpoint* ep) {
@@ -613,14 +626,37 @@ void ThinClientPoolDM::addConnection(TcrConnection* conn) {
   put(conn, false);
   ++m_poolSize;
 }
+std::shared_ptr<PreparedFunction> ThinClientPoolDM::getPreparedFunction(
+    const std::string& func) {
+  std::lock_guard<decltype(m_preparedFunctionsMutex)> guard(
+      m_preparedFunctionsMutex);
+  const auto& found = m_preparedFunctions.find(func);
+  if (found == m_preparedFunctions.end()) {
+    return nullptr;
+  }
+  return found->second;
+}
+
+std::shared_ptr<PreparedFunction> ThinClientPoolDM::addPreparedFunction(
+    std::shared_ptr<PreparedFunction> function) {
+  std::lock_guard<decltype(m_preparedFunctionsMutex)> guard(
+      m_preparedFunctionsMutex);
+  const auto& name = function->getName();
+  return m_preparedFunctions.emplace(name, std::move(function)).first->second;
+}
+
 GfErrType ThinClientPoolDM::sendRequestToAllServers(
-    const char* func, uint8_t getResult, std::chrono::milliseconds timeout,
-    std::shared_ptr<Cacheable> args, std::shared_ptr<ResultCollector>& rs,
+    const PreparedFunction& func, uint8_t getResult,
+    std::chrono::milliseconds timeout, std::shared_ptr<Cacheable> args,
+    std::shared_ptr<ResultCollector>& rs,
     std::shared_ptr<CacheableString>& exceptionPtr) {
   GfErrType err = GF_NOERR;
 
   getStats().setCurClientOps(++m_clientOps);
 
+  auto enableTimeStatistics = isTimeStatisticsEnabled();
+  auto sampleStartNanos = enableTimeStatistics ? Utils::startStatOpTime() : 0;
+
   auto resultCollectorLock = std::make_shared<std::recursive_mutex>();
 
   auto csArray = getServers();
@@ -646,8 +682,8 @@ GfErrType ThinClientPoolDM::sendRequestToAllServers(
           cs->value().c_str());
     }
     FunctionExecution* funcExe = &fePtrList[feIndex++];
-    funcExe->setParameters(func, getResult, timeout, args, ep, this,
-                           resultCollectorLock, &rs, userAttr);
+    funcExe->setParameters(&func, getResult, timeout, args, ep, this,
+                           resultCollectorLock, rs, userAttr);
     threadPool->perform(funcExe);
   }
   GfErrType finalErrorReturn = GF_NOERR;
@@ -692,11 +728,46 @@ GfErrType ThinClientPoolDM::sendRequestToAllServers(
 
   getStats().setCurClientOps(--m_clientOps);
   getStats().incSucceedClientOps();
+  if (enableTimeStatistics) {
+    auto elapsed = Utils::startStatOpTime() - sampleStartNanos;
+    getStats().incClientOpsSuccessTime(elapsed);
+    getStats().recordFunctionExecutionLatency(elapsed);
+  }
 
   delete[] fePtrList;
   return finalErrorReturn;
 }
 
+GfErrType ThinClientPoolDM::sendRequestToAllServers(
+    const PreparedFunction& func, uint8_t getResult,
+    std::shared_ptr<Cacheable> args, DeadlineExecution& execution) {
+  auto csArray = getServers();
+
+  if (csArray != nullptr && csArray->length() == 0) {
+    LOGWARN("No server found to execute the function");
+    return GF_NOSERVER_FOUND;
+  }
+
+  auto threadPool = m_connManager.getCacheImpl()->getThreadPool();
+  auto userAttr = UserAttributes::threadLocalUserAttributes;
+  for (int i = 0; i < csArray->length(); i++) {
+    auto cs = (*csArray)[i];
+    std::string endpointStr(cs->value().c_str());
+    TcrEndpoint* ep = nullptr;
+    if (m_endpoints.find(endpointStr, ep)) {
+      ep = addEP(cs->value().c_str());
+    }
+    auto funcExe = std::make_shared<FunctionExecution>();
+    auto buffer = execution.createBuffer();
+    // results are buffered per server, so no result collector lock
+    funcExe->setParameters(&func, getResult, execution.getRemaining(), args,
+                           ep, this, nullptr, buffer, userAttr);
+    threadPool->perform(funcExe.get());
+    execution.add(funcExe, buffer);
+  }
+  return GF_NOERR;
+}
+
 const std::shared_ptr<CacheableStringArray> ThinClientPoolDM::getLocators()
     const {
   auto ptrArr =
@@ -1070,6 +1141,52 @@ std::shared_ptr<Serializable> ThinClientPoolDM::GetEnum(int32_t val) {
   return reply.getValue();
 }
 
+std::shared_ptr<CacheableHashMap> ThinClientPoolDM::GetPDXTypes() {
+  LOGDEBUG("ThinClientPoolDM::GetPDXTypes:");
+
+  GfErrType err = GF_NOERR;
+
+  TcrMessageGetPdxTypes request(
+      new DataOutput(m_connManager.getCacheImpl()->createDataOutput()), this);
+
+  TcrMessageReply reply(true, this);
+
+  err = sendSyncRequest(request, reply);
+
+  if (err != GF_NOERR) {
+    GfErrTypeToException("Operation Failed", err);
+  } else if (reply.getMessageType() == TcrMessage::EXCEPTION) {
+    LOGDEBUG("ThinClientPoolDM::GetPDXTypes: Exception = %s ",
+             reply.getException());
+    throw IllegalStateException("Failed to get PdxSerializable Types");
+  }
+
+  return std::dynamic_pointer_cast<CacheableHashMap>(reply.getValue());
+}
+
+std::shared_ptr<CacheableHashMap> ThinClientPoolDM::GetPDXEnums() {
+  LOGDEBUG("ThinClientPoolDM::GetPDXEnums:");
+
+  GfErrType err = GF_NOERR;
+
+  TcrMessageGetPdxEnums request(
+      new DataOutput(m_connManager.getCacheImpl()->createDataOutput()), this);
+
+  TcrMessageReply reply(true, this);
+
+  err = sendSyncRequest(request, reply);
+
+  if (err != GF_NOERR) {
+    GfErrTypeToException("Operation Failed", err);
+  } else if (reply.getMessageType() == TcrMessage::EXCEPTION) {
+    LOGDEBUG("ThinClientPoolDM::GetPDXEnums: Exception = %s ",
+             reply.getException());
+    throw IllegalStateException("Failed to get enum Types");
+  }
+
+  return std::dynamic_pointer_cast<CacheableHashMap>(reply.getValue());
+}
+
 void ThinClientPoolDM::AddEnum(std::shared_ptr<Serializable> enumInfo,
                                int enumVal) {
   LOGDEBUG("ThinClientPoolDM::AddEnum:");
@@ -1325,6 +1442,9 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
   // Increment clientOps
   getStats().setCurClientOps(++m_clientOps);
 
+  auto enableTimeStatistics = isTimeStatisticsEnabled();
+  auto sampleStartNanos = enableTimeStatistics ? Utils::startStatOpTime() : 0;
+
   GfErrType error = GF_NOTCON;
 
   std::shared_ptr<UserAttributes> userAttr = nullptr;
@@ -1573,6 +1693,9 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
       getStats().setCurClientOps(--m_clientOps);
       if (error == GF_NOERR) {
         getStats().incSucceedClientOps(); /*inc Id for clientOs stat*/
+        if (enableTimeStatistics) {
+          updateClientOpTime(request, sampleStartNanos);
+        }
       } else if (error == GF_TIMOUT) {
         getStats().incTimeoutClientOps();
       } else {
@@ -1593,6 +1716,9 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
 
   if (error == GF_NOERR) {
     getStats().incSucceedClientOps();
+    if (enableTimeStatistics) {
+      updateClientOpTime(request, sampleStartNanos);
+    }
   } else if (error == GF_TIMOUT) {
     getStats().incTimeoutClientOps();
   } else {
@@ -1871,21 +1997,42 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueue(
   getStats().incWaitingConnections();
 
   /*get the start time for connectionWaitTime stat*/
-  bool enableTimeStatistics = m_connManager.getCacheImpl()
-                                  ->getDistributedSystem()
-                                  .getSystemProperties()
-                                  .getEnableTimeStatistics();
+  bool enableTimeStatistics = isTimeStatisticsEnabled();
   auto sampleStartNanos = enableTimeStatistics ? Utils::startStatOpTime() : 0;
   auto mp = getUntil(timeoutTime, error, excludeServers, maxConnLimit);
   /*Update the time stat for clientOpsTime */
   if (enableTimeStatistics) {
     Utils::updateStatOpTime(getStats().getStats(),
                             getStats().getTotalWaitingConnTimeId(),
+                            getStats().getConnectionWaitLatencyId(),
                             sampleStartNanos);
   }
   return mp;
 }
 
+bool ThinClientPoolDM::isTimeStatisticsEnabled() const {
+  return m_connManager.getCacheImpl()
+      ->getDistributedSystem()
+      .getSystemProperties()
+      .getEnableTimeStatistics();
+}
+
+void ThinClientPoolDM::updateClientOpTime(const TcrMessage& request,
+                                          int64_t start) {
+  auto elapsed = Utils::startStatOpTime() - start;
+  getStats().incClientOpsSuccessTime(elapsed);
+  getStats().recordClientOpLatency(elapsed);
+  switch (request.getMessageType()) {
+    case TcrMessage::EXECUTE_FUNCTION:
+    case TcrMessage::EXECUTE_REGION_FUNCTION:
+    case TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP:
+      getStats().recordFunctionExecutionLatency(elapsed);
+      break;
+    default:
+      break;
+  }
+}
+
 bool ThinClientPoolDM::isEndpointAttached(TcrEndpoint*) { return true; }
 
 GfErrType ThinClientPoolDM::sendRequestToEP(const TcrMessage& request,
@@ -25,6 +25,7 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ace/Map_Manager.h>
@@ -35,11 +36,13 @@
 #include <geode/ResultCollector.hpp>
 
 #include "ClientMetadataService.hpp"
+#include "DeadlineExecution.hpp"
 #include "ExecutionImpl.hpp"
 #include "FairQueue.hpp"
 #include "NonCopyable.hpp"
 #include "PoolAttributes.hpp"
 #include "PoolStatistics.hpp"
+#include "PreparedFunction.hpp"
 #include "RemoteQueryService.hpp"
 #include "TXState.hpp"
 #include "Task.hpp"
@@ -109,10 +112,20 @@ class ThinClientPoolDM
   virtual std::shared_ptr<QueryService> getQueryServiceWithoutCheck();
   virtual bool isEndpointAttached(TcrEndpoint* ep);
   GfErrType sendRequestToAllServers(
-      const char* func, uint8_t getResult, std::chrono::milliseconds timeout,
-      std::shared_ptr<Cacheable> args, std::shared_ptr<ResultCollector>& rs,
+      const PreparedFunction& func, uint8_t getResult,
+      std::chrono::milliseconds timeout, std::shared_ptr<Cacheable> args,
+      std::shared_ptr<ResultCollector>& rs,
       std::shared_ptr<CacheableString>& exceptionPtr);
 
+  /**
+   * Sends the function to all servers of the pool without waiting for the
+   * replies, which are collected by the given execution.
+   */
+  GfErrType sendRequestToAllServers(const PreparedFunction& func,
+                                    uint8_t getResult,
+                                    std::shared_ptr<Cacheable> args,
+                                    DeadlineExecution& execution);
+
   GfErrType sendRequestToEP(const TcrMessage& request, TcrMessageReply& reply,
                             TcrEndpoint* currentEndpoint);
   void addConnection(TcrConnection* conn);
@@ -182,6 +195,10 @@ class ThinClientPoolDM
   std::shared_ptr<Serializable> GetEnum(int32_t val);
   void AddEnum(std::shared_ptr<Serializable> enumInfo, int enumVal);
 
+  // All PDX types and enums known to the cluster, keyed by their ids.
+  std::shared_ptr<CacheableHashMap> GetPDXTypes();
+  std::shared_ptr<CacheableHashMap> GetPDXEnums();
+
   // Tries to get connection to a endpoint. If no connection is available, it
   // tries
   // to create one. If it fails to create one,  it returns a connection to any
@@ -198,6 +215,21 @@ class ThinClientPoolDM
   ClientMetadataService* getClientMetaDataService() {
     return m_clientMetadataService;
   }
+
+  /**
+   * the attributes and encoded name of a function executed through this pool,
+   * nullptr until they have been added with addPreparedFunction
+   */
+  std::shared_ptr<PreparedFunction> getPreparedFunction(
+      const std::string& func);
+
+  /**
+   * Caches the given function unless another thread added one for the same
+   * function first, returns the cached function.
+   */
+  std::shared_ptr<PreparedFunction> addPreparedFunction(
+      std::shared_ptr<PreparedFunction> function);
+
   void setPrimaryServerQueueSize(int queueSize) {
     m_primaryServerQueueSize = queueSize;
   }
@@ -260,6 +292,9 @@ class ThinClientPoolDM
  private:
   bool hasExpired(TcrConnection* conn);
 
+  bool isTimeStatisticsEnabled() const;
+  void updateClientOpTime(const TcrMessage& request, int64_t start);
+
   std::shared_ptr<Properties> getCredentials(TcrEndpoint* ep);
   GfErrType sendUserCredentials(std::shared_ptr<Properties> credentials,
                                 TcrConnection*& conn, bool isBGThread,
@@ -334,6 +369,9 @@ class ThinClientPoolDM
   std::atomic<int32_t> m_clientOps;  // Actual Size of Pool
   statistics::PoolStatsSampler* m_PoolStatsSampler;
   ClientMetadataService* m_clientMetadataService;
+  std::mutex m_preparedFunctionsMutex;
+  std::unordered_map<std::string, std::shared_ptr<PreparedFunction>>
+      m_preparedFunctions;
   friend class CacheImpl;
   friend class ThinClientStickyManager;
   friend class FunctionExecution;
@@ -342,15 +380,15 @@ class ThinClientPoolDM
   int m_primaryServerQueueSize;
 };
 
-class FunctionExecution : public PooledWork<GfErrType> {
+class FunctionExecution : public ServerFunctionExecution {
   ThinClientPoolDM* m_poolDM;
   TcrEndpoint* m_ep;
-  const char* m_func;
+  const PreparedFunction* m_func;
   uint8_t m_getResult;
   std::chrono::milliseconds m_timeout;
   std::shared_ptr<Cacheable> m_args;
   GfErrType m_error;
-  std::shared_ptr<ResultCollector>* m_rc;
+  std::shared_ptr<ResultCollector> m_rc;
   std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
   std::shared_ptr<CacheableString> exceptionPtr;
   std::shared_ptr<UserAttributes> m_userAttr;
@@ -371,12 +409,21 @@ class FunctionExecution : public PooledWork<GfErrType> {
 
   std::shared_ptr<CacheableString> getException() { return exceptionPtr; }
 
-  void setParameters(const char* func, uint8_t getResult,
+  std::string getServer() override { return m_ep->name(); }
+
+  std::string getFailure(GfErrType) override {
+    if (exceptionPtr != nullptr) {
+      return exceptionPtr->value();
+    }
+    return DeadlineExecution::describe(m_error);
+  }
+
+  void setParameters(const PreparedFunction* func, uint8_t getResult,
                      std::chrono::milliseconds timeout,
                      std::shared_ptr<Cacheable> args, TcrEndpoint* ep,
                      ThinClientPoolDM* poolDM,
                      const std::shared_ptr<std::recursive_mutex>& rCL,
-                     std::shared_ptr<ResultCollector>* rs,
+                     std::shared_ptr<ResultCollector> rs,
                      std::shared_ptr<UserAttributes> userAttr) {
     exceptionPtr = nullptr;
     m_resultCollectorLock = rCL;
@@ -401,16 +448,15 @@ class FunctionExecution : public PooledWork<GfErrType> {
       gua.setAuthenticatedView(m_userAttr->getAuthenticatedView());
     }
 
-    std::string funcName(m_func);
     TcrMessageExecuteFunction request(
         new DataOutput(m_poolDM->getConnectionManager()
                            .getCacheImpl()
                            ->createDataOutput()),
-        funcName, m_args, m_getResult, m_poolDM, m_timeout);
+        *m_func, m_args, m_getResult, m_poolDM, m_timeout);
     TcrMessageReply reply(true, m_poolDM);
     ChunkedFunctionExecutionResponse* resultProcessor(
         new ChunkedFunctionExecutionResponse(reply, (m_getResult & 2) == 2,
-                                             *m_rc, m_resultCollectorLock));
+                                             m_rc, m_resultCollectorLock));
     reply.setChunkedResultHandler(resultProcessor);
     reply.setTimeout(m_timeout);
     reply.setDM(m_poolDM);
@@ -452,13 +498,13 @@ class FunctionExecution : public PooledWork<GfErrType> {
   }
 };
 
-class OnRegionFunctionExecution : public PooledWork<GfErrType> {
+class OnRegionFunctionExecution : public ServerFunctionExecution {
   std::shared_ptr<BucketServerLocation> m_serverLocation;
   TcrMessage* m_request;
   TcrMessageReply* m_reply;
   bool m_isBGThread;
   ThinClientPoolDM* m_poolDM;
-  std::string m_func;
+  const PreparedFunction* m_func;
   uint8_t m_getResult;
   std::chrono::milliseconds m_timeout;
   std::shared_ptr<Cacheable> m_args;
@@ -472,14 +518,16 @@ class OnRegionFunctionExecution : public PooledWork<GfErrType> {
 
  public:
   OnRegionFunctionExecution(
-      std::string func, const Region* region, std::shared_ptr<Cacheable> args,
+      const PreparedFunction* func, const Region* region,
+      std::shared_ptr<Cacheable> args,
       std::shared_ptr<CacheableHashSet> routingObj, uint8_t getResult,
       std::chrono::milliseconds timeout, ThinClientPoolDM* poolDM,
       const std::shared_ptr<std::recursive_mutex>& rCL,
       std::shared_ptr<ResultCollector> rs,
       std::shared_ptr<UserAttributes> userAttr, bool isBGThread,
       const std::shared_ptr<BucketServerLocation>& serverLocation,
-      bool allBuckets)
+      bool allBuckets,
+      const std::shared_ptr<CacheableHashSet>& failedNodes = nullptr)
       : m_serverLocation(serverLocation),
         m_isBGThread(isBGThread),
         m_poolDM(poolDM),
@@ -497,7 +545,7 @@ class OnRegionFunctionExecution : public PooledWork<GfErrType> {
         new DataOutput(m_poolDM->getConnectionManager()
                            .getCacheImpl()
                            ->createDataOutput()),
-        m_func, m_region, m_args, m_routingObj, m_getResult, nullptr,
+        *m_func, m_region, m_args, m_routingObj, m_getResult, failedNodes,
         m_allBuckets, timeout, m_poolDM);
     m_reply = new TcrMessageReply(true, m_poolDM);
     m_resultCollector = new ChunkedFunctionExecutionResponse(
@@ -523,6 +571,22 @@ class OnRegionFunctionExecution : public PooledWork<GfErrType> {
     return static_cast<ChunkedFunctionExecutionResponse*>(m_resultCollector);
   }
 
+  /** the keys, or bucket ids for all buckets, executed on this server */
+  const std::shared_ptr<CacheableHashSet>& getRoutingObject() const {
+    return m_routingObj;
+  }
+
+  std::string getServer() override { return m_serverLocation->getEpString(); }
+
+  std::string getFailure(GfErrType err) override {
+    if (m_reply->getMessageType() == TcrMessage::EXCEPTION ||
+        m_reply->getMessageType() ==
+            TcrMessage::EXECUTE_REGION_FUNCTION_ERROR) {
+      return m_reply->getException();
+    }
+    return DeadlineExecution::describe(err);
+  }
+
   GfErrType execute(void) {
     GuardUserAttributes gua;
 
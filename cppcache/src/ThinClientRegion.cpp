@@ -34,6 +34,7 @@
 #include "ReadWriteLock.hpp"
 #include "RegionGlobalLocks.hpp"
 #include "RemoteQuery.hpp"
+#include "SerializedResultImpl.hpp"
 #include "TcrDistributionManager.hpp"
 #include "TcrEndpoint.hpp"
 #include "ThinClientBaseDM.hpp"
@@ -2976,7 +2977,7 @@ void ThinClientRegion::releaseGlobals(bool isFailover) {
 }
 
 void ThinClientRegion::executeFunction(
-    const std::string& func, const std::shared_ptr<Cacheable>& args,
+    const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
     std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
     std::shared_ptr<ResultCollector> rc, int32_t retryAttempts,
     std::chrono::milliseconds timeout) {
@@ -3053,7 +3054,8 @@ void ThinClientRegion::executeFunction(
         LOGINFO(
             "function timeout. Name: %s, timeout: %d, params: %d, "
             "retryAttempts: %d ",
-            func.c_str(), timeout.count(), getResult, retryAttempts);
+            func.getName().c_str(), timeout.count(), getResult,
+            retryAttempts);
         GfErrTypeToException("ExecuteOnRegion", GF_TIMOUT);
       } else if (err == GF_CLIENT_WAIT_TIMEOUT ||
                  err == GF_CLIENT_WAIT_TIMEOUT_REFRESH_PRMETADATA) {
@@ -3061,7 +3063,8 @@ void ThinClientRegion::executeFunction(
             "function timeout, possibly bucket is not available or bucket "
             "blacklisted. Name: %s, timeout: %d, params: %d, retryAttempts: "
             "%d ",
-            func.c_str(), timeout.count(), getResult, retryAttempts);
+            func.getName().c_str(), timeout.count(), getResult,
+            retryAttempts);
         GfErrTypeToException("ExecuteOnRegion", GF_CLIENT_WAIT_TIMEOUT);
       } else {
         LOGDEBUG("executeFunction err = %d ", err);
@@ -3079,7 +3082,7 @@ void ThinClientRegion::executeFunction(
   }
 }
 std::shared_ptr<CacheableVector> ThinClientRegion::reExecuteFunction(
-    const std::string& func, const std::shared_ptr<Cacheable>& args,
+    const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
     std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
     std::shared_ptr<ResultCollector> rc, int32_t retryAttempts,
     std::shared_ptr<CacheableHashSet>& failedNodes,
@@ -3157,59 +3160,89 @@ std::shared_ptr<CacheableVector> ThinClientRegion::reExecuteFunction(
 }
 
 bool ThinClientRegion::executeFunctionSH(
-    const std::string& func, const std::shared_ptr<Cacheable>& args,
+    const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
     uint8_t getResult, std::shared_ptr<ResultCollector> rc,
     const std::shared_ptr<ClientMetadataService::ServerToKeysMap>& locationMap,
-    std::shared_ptr<CacheableHashSet>& failedNodes,
+    std::shared_ptr<CacheableHashSet>& failedNodes, int32_t retryAttempts,
     std::chrono::milliseconds timeout, bool allBuckets) {
-  bool reExecute = false;
-  auto resultCollectorLock = std::make_shared<std::recursive_mutex>();
+  auto poolDM = dynamic_cast<ThinClientPoolDM*>(m_tcrdm);
+  if (retryAttempts == -1) {
+    retryAttempts = static_cast<int32_t>(m_tcrdm->getNumberOfEndPoints());
+  }
   const auto& userAttr = UserAttributes::threadLocalUserAttributes;
-  std::vector<std::shared_ptr<OnRegionFunctionExecution>> feWorkers;
   auto* threadPool =
       CacheRegionHelper::getCacheImpl(&getCache())->getThreadPool();
 
-  for (const auto& locationIter : *locationMap) {
-    const auto& serverLocation = locationIter.first;
-    const auto& routingObj = locationIter.second;
-    auto worker = std::make_shared<OnRegionFunctionExecution>(
-        func, this, args, routingObj, getResult, timeout,
-        dynamic_cast<ThinClientPoolDM*>(m_tcrdm), resultCollectorLock, rc,
-        userAttr, false, serverLocation, allBuckets);
-    threadPool->perform(worker.get());
-    feWorkers.push_back(worker);
-  }
-
-  GfErrType abortError = GF_NOERR;
-
-  for (auto iter = std::begin(feWorkers); iter != std::end(feWorkers);) {
-    auto worker = *iter;
-    auto err = worker->getResult();
-    auto currentReply = worker->getReply();
-
-    if (err == GF_NOERR &&
-        (currentReply->getMessageType() == TcrMessage::EXCEPTION ||
-         currentReply->getMessageType() ==
-             TcrMessage::EXECUTE_REGION_FUNCTION_ERROR)) {
-      err = ThinClientRegion::handleServerException(
-          "Execute", currentReply->getException());
+  // The results of the servers are added to the result collector as they
+  // arrive. When a server fails before adding any, its routing keys (or
+  // bucket ids) are regrouped by their current servers and only those are
+  // sent again. The results of these retries are buffered per server, and
+  // added only if the server succeeded, so a retry failing midway can be
+  // sent again too. Results already added for a failed server cannot be told
+  // apart from the others, so then the whole function is executed again.
+  auto resultCollectorLock = std::make_shared<std::recursive_mutex>();
+  auto serverToKeysMap = locationMap;
+  int32_t attempt = 0;
+  while (true) {
+    const bool bufferPerServer = attempt > 0;
+    const auto removedNodes = failedNodes->empty() ? nullptr : failedNodes;
+    std::vector<std::pair<std::shared_ptr<OnRegionFunctionExecution>,
+                          std::shared_ptr<ServerResultBuffer>>>
+        feWorkers;
+    for (const auto& locationIter : *serverToKeysMap) {
+      const auto& serverLocation = locationIter.first;
+      const auto& routingObj = locationIter.second;
+      std::shared_ptr<ServerResultBuffer> buffer;
+      std::shared_ptr<OnRegionFunctionExecution> worker;
+      if (bufferPerServer) {
+        buffer =
+            std::make_shared<ServerResultBuffer>(rc->isSerializedResults());
+        worker = std::make_shared<OnRegionFunctionExecution>(
+            &func, this, args, routingObj, getResult, timeout, poolDM, nullptr,
+            buffer, userAttr, false, serverLocation, allBuckets, removedNodes);
+      } else {
+        worker = std::make_shared<OnRegionFunctionExecution>(
+            &func, this, args, routingObj, getResult, timeout, poolDM,
+            resultCollectorLock, rc, userAttr, false, serverLocation,
+            allBuckets, removedNodes);
+      }
+      threadPool->perform(worker.get());
+      feWorkers.emplace_back(worker, buffer);
     }
 
-    if (err != GF_NOERR) {
-      if (err == GF_FUNCTION_EXCEPTION) {
-        reExecute = true;
-        if (auto poolDM = dynamic_cast<ThinClientPoolDM*>(m_tcrdm)) {
-          if (poolDM->getClientMetaDataService()) {
-            poolDM->getClientMetaDataService()->enqueueForMetadataRefresh(
-                this->getFullPath(), 0);
+    GfErrType abortError = GF_NOERR;
+    bool executeAll = false;
+    auto failedKeys = CacheableHashSet::create();
+    const auto retry = [&](OnRegionFunctionExecution& worker) {
+      if (!bufferPerServer) {
+        worker.getResultCollector()->reset();
+        executeAll |= worker.getResultCollector()->hasAddedResults();
+      }
+      failedKeys->insert(worker.getRoutingObject()->begin(),
+                         worker.getRoutingObject()->end());
+    };
+
+    for (const auto& feWorker : feWorkers) {
+      const auto& worker = feWorker.first;
+      auto err = worker->getResult();
+      auto currentReply = worker->getReply();
+
+      if (err == GF_NOERR &&
+          (currentReply->getMessageType() == TcrMessage::EXCEPTION ||
+           currentReply->getMessageType() ==
+               TcrMessage::EXECUTE_REGION_FUNCTION_ERROR)) {
+        err = ThinClientRegion::handleServerException(
+            "Execute", currentReply->getException());
+      }
+
+      if (err == GF_NOERR) {
+        if (bufferPerServer) {
+          for (const auto& result : *feWorker.second->getResult()) {
+            rc->addResult(result);
           }
         }
-        worker->getResultCollector()->reset();
-        {
-          std::lock_guard<decltype(*resultCollectorLock)> guard(
-              *resultCollectorLock);
-          rc->clearResults();
-        }
+      } else if (err == GF_FUNCTION_EXCEPTION) {
+        retry(*worker);
         std::shared_ptr<CacheableHashSet> failedNodeIds(
             currentReply->getFailedNode());
         if (failedNodeIds) {
@@ -3221,22 +3254,10 @@ bool ThinClientRegion::executeFunctionSH(
         }
       } else if ((err == GF_NOTCON) || (err == GF_CLIENT_WAIT_TIMEOUT) ||
                  (err == GF_CLIENT_WAIT_TIMEOUT_REFRESH_PRMETADATA)) {
-        reExecute = true;
         LOGINFO(
             "ThinClientRegion::executeFunctionSH with GF_NOTCON or "
             "GF_CLIENT_WAIT_TIMEOUT ");
-        if (auto poolDM = dynamic_cast<ThinClientPoolDM*>(m_tcrdm)) {
-          if (poolDM->getClientMetaDataService()) {
-            poolDM->getClientMetaDataService()->enqueueForMetadataRefresh(
-                this->getFullPath(), 0);
-          }
-        }
-        worker->getResultCollector()->reset();
-        {
-          std::lock_guard<decltype(*resultCollectorLock)> guard(
-              *resultCollectorLock);
-          rc->clearResults();
-        }
+        retry(*worker);
       } else {
         if (ThinClientBaseDM::isFatalClientError(err)) {
           LOGERROR("ThinClientRegion::executeFunctionSH: Fatal Exception");
@@ -3250,13 +3271,71 @@ bool ThinClientRegion::executeFunctionSH(
       }
     }
 
-    iter = feWorkers.erase(iter);
+    if (abortError != GF_NOERR) {
+      GfErrTypeToException("ExecuteOnRegion:", abortError);
+    }
+    if (failedKeys->empty()) {
+      return false;
+    }
+
+    auto cms = poolDM ? poolDM->getClientMetaDataService() : nullptr;
+    if (!cms || executeAll || attempt++ >= retryAttempts) {
+      if (cms) {
+        cms->enqueueForMetadataRefresh(this->getFullPath(), 0);
+      }
+      return true;
+    }
+
+    // fetch the metadata now, so that the keys are not routed to the failed
+    // servers again
+    cms->getClientPRMetadata(this->getFullPath().c_str());
+    const bool optimizeForWrite = (getResult & 4) == 4;
+    if (allBuckets) {
+      ClientMetadataService::BucketSet buckets(failedKeys->size());
+      for (const auto& bucket : *failedKeys) {
+        buckets.insert(
+            std::dynamic_pointer_cast<CacheableInt32>(bucket)->value());
+      }
+      serverToKeysMap = cms->getServerToBucketsMapFESHOP(
+          buckets, shared_from_this(), optimizeForWrite);
+    } else {
+      auto keys = CacheableVector::create();
+      keys->insert(keys->end(), failedKeys->begin(), failedKeys->end());
+      serverToKeysMap = cms->getServerToFilterMapFESHOP(
+          keys, shared_from_this(), optimizeForWrite);
+    }
+    if (!serverToKeysMap || serverToKeysMap->empty()) {
+      return true;
+    }
+    LOGDEBUG(
+        "ThinClientRegion::executeFunctionSH re-executing for %d %s of the "
+        "failed servers on %d servers",
+        failedKeys->size(), allBuckets ? "buckets" : "keys",
+        serverToKeysMap->size());
   }
+}
+
+void ThinClientRegion::executeFunctionSH(
+    const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
+    uint8_t getResult,
+    const std::shared_ptr<ClientMetadataService::ServerToKeysMap>& locationMap,
+    DeadlineExecution& execution, bool allBuckets) {
+  const auto& userAttr = UserAttributes::threadLocalUserAttributes;
+  auto* threadPool =
+      CacheRegionHelper::getCacheImpl(&getCache())->getThreadPool();
 
-  if (abortError != GF_NOERR) {
-    GfErrTypeToException("ExecuteOnRegion:", abortError);
+  for (const auto& locationIter : *locationMap) {
+    const auto& serverLocation = locationIter.first;
+    const auto& routingObj = locationIter.second;
+    auto buffer = execution.createBuffer();
+    // results are buffered per server, so no result collector lock
+    auto worker = std::make_shared<OnRegionFunctionExecution>(
+        &func, this, args, routingObj, getResult, execution.getRemaining(),
+        dynamic_cast<ThinClientPoolDM*>(m_tcrdm), nullptr, buffer, userAttr,
+        false, serverLocation, allBuckets);
+    threadPool->perform(worker.get());
+    execution.add(worker, buffer);
   }
-  return reExecute;
 }
 
 GfErrType ThinClientRegion::getFuncAttributes(const std::string& func,
@@ -3336,7 +3415,7 @@ void ThinClientRegion::txPut(
                                CacheEventFlags::NORMAL, versionTag);
 
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
-                   sampleStartNanos);
+                   m_regionStats->getPutLatencyId(), sampleStartNanos);
   GfErrTypeToException("Region::putTX", err);
 }
 
@@ -3404,6 +3483,7 @@ void ChunkedKeySetResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
 }
 
 void ChunkedQueryResponse::reset() {
+  discardDecodedChunks();
   m_queryResults->clear();
   m_structFieldNames.clear();
 }
@@ -3424,9 +3504,7 @@ void ChunkedQueryResponse::readObjectPartList(DataInput& input,
       throw IllegalStateException(exMsgPtr);
     } else {
       if (isResultSet) {
-        std::shared_ptr<Cacheable> value;
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readQueryResult(input);
       } else {
         auto code = static_cast<DSCode>(input.read());
         if (code == DSCode::FixedIDByte) {
@@ -3477,7 +3555,8 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     input.readInt32();  // ignored part length
     input.read();       // ignored is object
     auto intVal = std::dynamic_pointer_cast<CacheableInt32>(input.readObject());
-    m_queryResults->push_back(intVal);
+    applyDecodedChunks();
+    addQueryResult(intVal);
     m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
     return;
   }
@@ -3531,23 +3610,51 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
 
   bool isResultSet = (m_structFieldNames.size() == 0);
 
+  if (canDecodeResultsSeparately() &&
+      canDecodeInParallel(cacheImpl, isLastChunkWithSecurity)) {
+    const auto chunkBytes = getChunk();
+    const auto offset = input.getBytesRead();
+    const auto pool = m_msg.getPool();
+    auto& msg = m_msg;
+    decodeInOrder(cacheImpl, [this, &msg, chunkBytes, chunkLen, offset,
+                              isResultSet, cacheImpl, pool]() {
+      auto resultsInput =
+          cacheImpl->createDataInput(chunkBytes.get(), chunkLen, pool);
+      resultsInput.advanceCursor(offset);
+      ChunkedQueryResponse decoded(msg);
+      decoded.readChunkResults(resultsInput, isResultSet);
+      auto results = decoded.m_queryResults;
+      return [this, results]() {
+        for (const auto& value : *results) {
+          addQueryResult(value);
+        }
+      };
+    });
+    return;
+  }
+
+  applyDecodedChunks();
+  readChunkResults(input, isResultSet);
+
+  m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
+}
+
+void ChunkedQueryResponse::readChunkResults(DataInput& input,
+                                            bool isResultSet) {
   auto arrayType = static_cast<DSCode>(input.read());
 
   if (arrayType == DSCode::CacheableObjectArray) {
     int32_t arraySize = input.readArrayLength();
     skipClass(input);
     for (int32_t arrayItem = 0; arrayItem < arraySize; ++arrayItem) {
-      std::shared_ptr<Serializable> value;
       if (isResultSet) {
-        input.readObject(value);
-        m_queryResults->push_back(value);
+        readQueryResult(input);
       } else {
         input.read();
         int32_t arraySize2 = input.readArrayLength();
         skipClass(input);
         for (int32_t index = 0; index < arraySize2; ++index) {
-          input.readObject(value);
-          m_queryResults->push_back(value);
+          readQueryResult(input);
         }
       }
     }
@@ -3573,8 +3680,6 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
         "Query response got unhandled message format; possible serialization "
         "mismatch");
   }
-
-  m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
 }
 
 void ChunkedQueryResponse::skipClass(DataInput& input) {
@@ -3591,8 +3696,109 @@ void ChunkedQueryResponse::skipClass(DataInput& input) {
   }
 }
 
+ColumnarResultsImpl& ColumnarQueryResponse::getResults() {
+  // the field names precede the values in the first chunk
+  if (m_columnarResults == nullptr) {
+    m_columnarResults =
+        std::make_shared<ColumnarResultsImpl>(getStructFieldNames());
+  }
+  return *m_columnarResults;
+}
+
+std::shared_ptr<ColumnarResultsImpl>
+ColumnarQueryResponse::getColumnarResults() {
+  getResults();
+  return m_columnarResults;
+}
+
+void ColumnarQueryResponse::reset() {
+  ChunkedQueryResponse::reset();
+  m_columnarResults = nullptr;
+}
+
+void ColumnarQueryResponse::addQueryResult(
+    std::shared_ptr<Serializable> value) {
+  getResults().appendObject(std::move(value));
+}
+
+void ColumnarQueryResponse::readQueryResult(DataInput& input) {
+  auto& results = getResults();
+  auto code = static_cast<DSCode>(input.read());
+  switch (code) {
+    case DSCode::NullObj:
+      results.appendNull();
+      break;
+    case DSCode::CacheableByte:
+      results.appendInt64(input.read());
+      break;
+    case DSCode::CacheableInt16:
+      results.appendInt64(input.readInt16());
+      break;
+    case DSCode::CacheableInt32:
+      results.appendInt64(input.readInt32());
+      break;
+    case DSCode::CacheableInt64:
+      results.appendInt64(input.readInt64());
+      break;
+    case DSCode::CacheableFloat:
+      results.appendDouble(input.readFloat());
+      break;
+    case DSCode::CacheableDouble:
+      results.appendDouble(input.readDouble());
+      break;
+    case DSCode::CacheableString:
+    case DSCode::CacheableASCIIString:
+    case DSCode::CacheableStringHuge:
+    case DSCode::CacheableASCIIStringHuge:
+      input.rewindCursor(1);
+      results.appendString(input.readString());
+      break;
+    default: {
+      input.rewindCursor(1);
+      std::shared_ptr<Serializable> value;
+      input.readObject(value);
+      results.appendObject(std::move(value));
+    }
+  }
+}
+
 void ChunkedFunctionExecutionResponse::reset() {
   // m_functionExecutionResults->clear();
+  discardDecodedChunks();
+}
+
+std::shared_ptr<Serializable> ChunkedFunctionExecutionResponse::readValue(
+    DataInput& input, bool serializedResults,
+    const std::shared_ptr<const uint8_t>& chunk, const CacheImpl* cacheImpl,
+    Pool* pool) {
+  std::shared_ptr<Serializable> value;
+  if (serializedResults) {
+    // hand out the bytes of the value within the chunk, only decoding it
+    // if that is needed to find where it ends
+    auto valueStart = input.currentBufferPosition();
+    if (!SerializedResultImpl::skipValue(input)) {
+      input.readObject(value);
+    }
+    value = std::make_shared<SerializedResultImpl>(
+        chunk, valueStart,
+        static_cast<size_t>(input.currentBufferPosition() - valueStart),
+        cacheImpl, pool);
+  } else {
+    input.readObject(value);
+  }
+  return value;
+}
+
+void ChunkedFunctionExecutionResponse::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  m_addedResults = true;
+  if (m_resultCollectorLock) {
+    std::lock_guard<decltype(*m_resultCollectorLock)> guard(
+        *m_resultCollectorLock);
+    m_rc->addResult(result);
+  } else {
+    m_rc->addResult(result);
+  }
 }
 
 void ChunkedFunctionExecutionResponse::handleChunk(
@@ -3681,13 +3887,35 @@ void ChunkedFunctionExecutionResponse::handleChunk(
     // rewind cursor by 1 to what we had read a byte to determine whether to
     // read exception part or read objects.
     input.rewindCursor(1);
+
+    if (m_rc != nullptr &&
+        canDecodeInParallel(cacheImpl, isLastChunkWithSecurity)) {
+      // nothing after the value and the member id is read from the chunk
+      const auto chunkBytes = getChunk();
+      const auto offset = input.getBytesRead();
+      const auto serializedResults = m_rc->isSerializedResults();
+      const auto pool = m_msg.getPool();
+      decodeInOrder(cacheImpl, [this, chunkBytes, chunkLen, offset,
+                                serializedResults, cacheImpl, pool]() {
+        auto valueInput =
+            cacheImpl->createDataInput(chunkBytes.get(), chunkLen, pool);
+        valueInput.advanceCursor(offset);
+        std::shared_ptr<Cacheable> result = readValue(
+            valueInput, serializedResults, chunkBytes, cacheImpl, pool);
+        return [this, result]() { addResult(result); };
+      });
+      return;
+    }
   }
 
   // Read either object or exception string from sendException.
   std::shared_ptr<Serializable> value;
   // std::shared_ptr<Cacheable> memberId;
   if (readPart) {
-    input.readObject(value);
+    value = readValue(input,
+                      !isExceptionPart && m_rc != nullptr &&
+                          m_rc->isSerializedResults(),
+                      getChunk(), cacheImpl, m_msg.getPool());
     // TODO: track this memberId for PrFxHa
     // input.readObject(memberId);
     auto objectlen = input.getBytesRead() - startLen;
@@ -3710,20 +3938,29 @@ void ChunkedFunctionExecutionResponse::handleChunk(
     } else {
       result = value;
     }
-    if (m_resultCollectorLock) {
-      std::lock_guard<decltype(*m_resultCollectorLock)> guard(
-          *m_resultCollectorLock);
-      m_rc->addResult(result);
-    } else {
-      m_rc->addResult(result);
-    }
+    // after the results of the chunks still being decoded
+    applyDecodedChunks();
+    addResult(result);
   }
 
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
   //  m_functionExecutionResults->push_back(value);
 }
 
+/**
+ * The parts of a getAll chunk decoded apart from the response, with the
+ * maps they were read into.
+ */
+struct ChunkedGetAllResponse::DecodedParts {
+  uint32_t keysOffset;
+  std::shared_ptr<HashMapOfCacheable> values;
+  std::shared_ptr<HashMapOfException> exceptions;
+  std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> resultKeys;
+  std::unique_ptr<VersionedCacheableObjectPartList> objectList;
+};
+
 void ChunkedGetAllResponse::reset() {
+  discardDecodedChunks();
   m_keysOffset = 0;
   if (m_resultKeys != nullptr && m_resultKeys->size() > 0) {
     m_resultKeys->clear();
@@ -3747,6 +3984,13 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     return;
   }
 
+  if (canDecodeInParallel(cacheImpl, isLastChunkWithSecurity) &&
+      decodeInParallel(input, chunkLen, cacheImpl)) {
+    return;
+  }
+
+  applyDecodedChunks();
+
   VersionedCacheableObjectPartList objectList(
       m_keys, &m_keysOffset, m_values, m_exceptions, m_resultKeys, m_region,
       &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
@@ -3757,6 +4001,89 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
 }
 
+bool ChunkedGetAllResponse::decodeInParallel(DataInput& input,
+                                             int32_t chunkLen,
+                                             const CacheImpl* cacheImpl) {
+  const auto offset = input.getBytesRead();
+
+  // The keys of a chunk without keys are those following the keys of the
+  // previous chunks, so the number of entries has to be known up front.
+  const auto flags = input.read();
+  const bool hasKeys = (flags & 0x01) == 0x01;
+  const bool hasObjects = (flags & 0x02) == 0x02;
+  const bool hasTags = (flags & 0x04) == 0x04;
+  if (hasKeys) {
+    input.rewindCursor(1);
+    return false;
+  }
+  const auto entries =
+      (hasObjects || hasTags) ? static_cast<uint32_t>(input.readUnsignedVL())
+                              : 0;
+  const auto keysOffset = m_keysOffset;
+  m_keysOffset += entries;
+
+  const auto chunkBytes = getChunk();
+  const auto pool = m_msg.getPool();
+  const auto keys = m_keys;
+  const auto region = m_region;
+  const auto trackerMap = &m_trackerMap;
+  const auto destroyTracker = m_destroyTracker;
+  const auto addToLocalCache = m_addToLocalCache;
+  const auto dsmemId = m_dsmemId;
+  const bool hasValues = m_values != nullptr;
+  const bool hasExceptions = m_exceptions != nullptr;
+  const bool hasResultKeys = m_resultKeys != nullptr;
+  auto& responseLock = m_responseLock;
+  decodeInOrder(cacheImpl, [this, chunkBytes, chunkLen, offset, cacheImpl,
+                            pool, keysOffset, keys, region, trackerMap,
+                            destroyTracker, addToLocalCache, dsmemId,
+                            hasValues, hasExceptions, hasResultKeys,
+                            &responseLock]() {
+    auto partsInput =
+        cacheImpl->createDataInput(chunkBytes.get(), chunkLen, pool);
+    partsInput.advanceCursor(offset);
+
+    auto parts = std::make_shared<DecodedParts>();
+    parts->keysOffset = keysOffset;
+    if (hasValues) {
+      parts->values = std::make_shared<HashMapOfCacheable>();
+    }
+    if (hasExceptions) {
+      parts->exceptions = std::make_shared<HashMapOfException>();
+    }
+    if (hasResultKeys) {
+      parts->resultKeys =
+          std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+    }
+    parts->objectList = std::unique_ptr<VersionedCacheableObjectPartList>(
+        new VersionedCacheableObjectPartList(
+            keys, &parts->keysOffset, parts->values, parts->exceptions,
+            parts->resultKeys, region, trackerMap, destroyTracker,
+            addToLocalCache, dsmemId, responseLock));
+    parts->objectList->readParts(partsInput);
+    return [this, parts]() { addParts(*parts); };
+  });
+  return true;
+}
+
+void ChunkedGetAllResponse::addParts(DecodedParts& parts) {
+  std::lock_guard<decltype(m_responseLock)> guard(m_responseLock);
+  parts.objectList->updateRegion();
+
+  if (m_values) {
+    for (const auto& entry : *parts.values) {
+      (*m_values)[entry.first] = entry.second;
+    }
+  }
+  if (m_exceptions) {
+    m_exceptions->insert(parts.exceptions->begin(), parts.exceptions->end());
+  }
+  if (m_resultKeys) {
+    m_resultKeys->insert(m_resultKeys->end(), parts.resultKeys->begin(),
+                         parts.resultKeys->end());
+  }
+}
+
 void ChunkedGetAllResponse::add(const ChunkedGetAllResponse* other) {
   if (m_values) {
     for (const auto& iter : *m_values) {
@@ -20,6 +20,7 @@
 #ifndef GEODE_THINCLIENTREGION_H_
 #define GEODE_THINCLIENTREGION_H_
 
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -32,7 +33,10 @@
 
 #include "CacheableObjectPartList.hpp"
 #include "ClientMetadataService.hpp"
+#include "ColumnarResultsImpl.hpp"
+#include "DeadlineExecution.hpp"
 #include "LocalRegion.hpp"
+#include "PreparedFunction.hpp"
 #include "Queue.hpp"
 #include "RegionGlobalLocks.hpp"
 #include "TcrChunkedContext.hpp"
@@ -153,23 +157,41 @@ class APACHE_GEODE_EXPORT ThinClientRegion : public LocalRegion {
   inline ThinClientBaseDM* getDistMgr() const { return m_tcrdm; }
 
   std::shared_ptr<CacheableVector> reExecuteFunction(
-      const std::string& func, const std::shared_ptr<Cacheable>& args,
+      const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
       std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
       std::shared_ptr<ResultCollector> rc, int32_t retryAttempts,
       std::shared_ptr<CacheableHashSet>& failedNodes,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
 
+  /**
+   * Executes the function on the servers of the location map. The keys or
+   * buckets of the servers that fail are sent again, up to retryAttempts
+   * times, to the servers hosting them after a metadata refresh; returns true
+   * if they still failed, or a server failed after adding results, and the
+   * whole function has to be executed again.
+   */
   bool executeFunctionSH(
-      const std::string& func, const std::shared_ptr<Cacheable>& args,
+      const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
       uint8_t getResult, std::shared_ptr<ResultCollector> rc,
       const std::shared_ptr<ClientMetadataService::ServerToKeysMap>&
           locationMap,
-      std::shared_ptr<CacheableHashSet>& failedNodes,
+      std::shared_ptr<CacheableHashSet>& failedNodes, int32_t retryAttempts,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
       bool allBuckets = false);
 
+  /**
+   * Sends the function to the servers of the location map without waiting
+   * for the replies, which are collected by the given execution.
+   */
+  void executeFunctionSH(
+      const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
+      uint8_t getResult,
+      const std::shared_ptr<ClientMetadataService::ServerToKeysMap>&
+          locationMap,
+      DeadlineExecution& execution, bool allBuckets);
+
   void executeFunction(
-      const std::string&, const std::shared_ptr<Cacheable>& args,
+      const PreparedFunction& func, const std::shared_ptr<Cacheable>& args,
       std::shared_ptr<CacheableVector> routingObj, uint8_t getResult,
       std::shared_ptr<ResultCollector> rc, int32_t retryAttempts,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
@@ -432,16 +454,40 @@ class ChunkedQueryResponse : public TcrChunkedResult {
 
   void skipClass(DataInput& input);
 
+  /** read the results part of a chunk after its header */
+  void readChunkResults(DataInput& input, bool isResultSet);
+
   // disabled
   ChunkedQueryResponse(const ChunkedQueryResponse&);
   ChunkedQueryResponse& operator=(const ChunkedQueryResponse&);
 
+ protected:
+  /** add a decoded value of the results; overridden to stream results */
+  virtual void addQueryResult(std::shared_ptr<Serializable> value) {
+    m_queryResults->push_back(std::move(value));
+  }
+
+  /** decode the next serialized value of the results and add it */
+  virtual void readQueryResult(DataInput& input) {
+    std::shared_ptr<Serializable> value;
+    input.readObject(value);
+    addQueryResult(std::move(value));
+  }
+
+  /**
+   * Whether the values of a chunk can be decoded apart from this response and
+   * added later; false if readQueryResult does more than readObject.
+   */
+  virtual bool canDecodeResultsSeparately() const { return true; }
+
  public:
   inline explicit ChunkedQueryResponse(TcrMessage& msg)
       : TcrChunkedResult(),
         m_msg(msg),
         m_queryResults(CacheableVector::create()) {}
 
+  virtual ~ChunkedQueryResponse() = default;
+
   inline const std::shared_ptr<CacheableVector>& getQueryResults() const {
     return m_queryResults;
   }
@@ -458,6 +504,34 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   void readObjectPartList(DataInput& input, bool isResultSet);
 };
 
+/**
+ * Handle each chunk of the chunked query response decoding the values
+ * directly into the columns of ColumnarResults.
+ */
+class ColumnarQueryResponse : public ChunkedQueryResponse {
+ private:
+  std::shared_ptr<ColumnarResultsImpl> m_columnarResults;
+
+  ColumnarResultsImpl& getResults();
+
+ protected:
+  void addQueryResult(std::shared_ptr<Serializable> value) override;
+
+  void readQueryResult(DataInput& input) override;
+
+  bool canDecodeResultsSeparately() const override { return false; }
+
+ public:
+  inline explicit ColumnarQueryResponse(TcrMessage& msg)
+      : ChunkedQueryResponse(msg) {}
+
+  ~ColumnarQueryResponse() override = default;
+
+  std::shared_ptr<ColumnarResultsImpl> getColumnarResults();
+
+  void reset() override;
+};
+
 /**
  * Handle each chunk of the chunked function execution response.
  *
@@ -470,6 +544,14 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
   bool m_getResult;
   std::shared_ptr<ResultCollector> m_rc;
   std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
+  std::atomic<bool> m_addedResults;
+
+  static std::shared_ptr<Serializable> readValue(
+      DataInput& input, bool serializedResults,
+      const std::shared_ptr<const uint8_t>& chunk, const CacheImpl* cacheImpl,
+      Pool* pool);
+
+  void addResult(const std::shared_ptr<Cacheable>& result);
 
   // disabled
   ChunkedFunctionExecutionResponse(const ChunkedFunctionExecutionResponse&);
@@ -479,7 +561,11 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
  public:
   inline ChunkedFunctionExecutionResponse(TcrMessage& msg, bool getResult,
                                           std::shared_ptr<ResultCollector> rc)
-      : TcrChunkedResult(), m_msg(msg), m_getResult(getResult), m_rc(rc) {}
+      : TcrChunkedResult(),
+        m_msg(msg),
+        m_getResult(getResult),
+        m_rc(rc),
+        m_addedResults(false) {}
 
   inline ChunkedFunctionExecutionResponse(
       TcrMessage& msg, bool getResult, std::shared_ptr<ResultCollector> rc,
@@ -488,7 +574,8 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
         m_msg(msg),
         m_getResult(getResult),
         m_rc(rc),
-        m_resultCollectorLock(resultCollectorLock) {}
+        m_resultCollectorLock(resultCollectorLock),
+        m_addedResults(false) {}
 
   /* inline const std::shared_ptr<CacheableVector>&
    getFunctionExecutionResults() const
@@ -502,6 +589,9 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
   // inline const bool getResult() const
   inline bool getResult() const { return m_getResult; }
 
+  /** true once a result was added to the result collector */
+  inline bool hasAddedResults() const { return m_addedResults; }
+
   virtual void handleChunk(const uint8_t* chunk, int32_t chunkLen,
                            uint8_t isLastChunkWithSecurity,
                            const CacheImpl* cacheImpl);
@@ -526,6 +616,18 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
   std::recursive_mutex& m_responseLock;
+
+  struct DecodedParts;
+
+  /**
+   * Decodes the rest of the chunk on the chunk decode pool; false if the
+   * chunk has to be read by this thread.
+   */
+  bool decodeInParallel(DataInput& input, int32_t chunkLen,
+                        const CacheImpl* cacheImpl);
+
+  void addParts(DecodedParts& parts);
+
   // disabled
   ChunkedGetAllResponse(const ChunkedGetAllResponse&);
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&);
@@ -20,8 +20,10 @@
 #ifndef GEODE_THREADPOOL_H_
 #define GEODE_THREADPOOL_H_
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <memory>
 #include <mutex>
 
 #include <ace/Activation_Queue.h>
@@ -41,20 +43,29 @@ class PooledWork : public ACE_Method_Request {
   std::recursive_mutex m_mutex;
   std::condition_variable_any m_cond;
   bool m_done;
+  bool m_abandoned;
+  std::shared_ptr<PooledWork> m_self;
 
  public:
-  PooledWork() : m_mutex(), m_cond(), m_done(false) {}
+  PooledWork() : m_mutex(), m_cond(), m_done(false), m_abandoned(false) {}
 
   virtual ~PooledWork() {}
 
   virtual int call(void) {
-    T res = execute();
+    // released after the lock, last use of this work once abandoned
+    std::shared_ptr<PooledWork> self;
 
-    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
-
-    m_retVal = res;
+    std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+    if (!m_abandoned) {
+      lock.unlock();
+      T res = execute();
+      lock.lock();
+      m_retVal = res;
+    }
     m_done = true;
+    self = std::move(m_self);
     m_cond.notify_all();
+    lock.unlock();
 
     return 0;
   }
@@ -69,6 +80,35 @@ class PooledWork : public ACE_Method_Request {
     return m_retVal;
   }
 
+  /**
+   * Waits for the result until the deadline.
+   * @return false if the work had not completed by the deadline
+   */
+  bool getResult(T& result, std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<decltype(m_mutex)> lock(m_mutex);
+
+    if (!m_cond.wait_until(lock, deadline, [this] { return m_done; })) {
+      return false;
+    }
+
+    result = m_retVal;
+    return true;
+  }
+
+  /**
+   * Gives up on the result of a work that may still be queued or running. A
+   * queued work is not executed anymore, and self keeps the work alive until
+   * the thread pool is done with it.
+   */
+  void abandon(std::shared_ptr<PooledWork> self) {
+    std::lock_guard<decltype(m_mutex)> lock(m_mutex);
+
+    m_abandoned = true;
+    if (!m_done) {
+      m_self = std::move(self);
+    }
+  }
+
  protected:
   virtual T execute(void) = 0;
 };
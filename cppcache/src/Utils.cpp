@@ -26,6 +26,8 @@
 #include <ace/INET_Addr.h>
 #include <ace/OS.h>
 
+#include "statistics/StatisticHistogram.hpp"
+
 namespace apache {
 namespace geode {
 namespace client {
@@ -175,6 +177,14 @@ void Utils::updateStatOpTime(statistics::Statistics* m_regionStats,
   m_regionStats->incLong(statId, startStatOpTime() - start);
 }
 
+void Utils::updateStatOpTime(statistics::Statistics* m_regionStats,
+                             int32_t statId, int32_t histogramId,
+                             int64_t start) {
+  auto elapsed = startStatOpTime() - start;
+  m_regionStats->incLong(statId, elapsed);
+  statistics::StatisticHistogram::record(m_regionStats, histogramId, elapsed);
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
@@ -149,6 +149,12 @@ class APACHE_GEODE_EXPORT Utils {
   static void updateStatOpTime(statistics::Statistics* m_regionStats,
                                int32_t statId, int64_t start);
 
+  // Like updateStatOpTime, and also counts the operation in the latency
+  // histogram whose first bucket is histogramId.
+  static void updateStatOpTime(statistics::Statistics* m_regionStats,
+                               int32_t statId, int32_t histogramId,
+                               int64_t start);
+
   static void parseEndpointNamesString(
       std::string endpoints, std::unordered_set<std::string>& endpointNames);
 
@@ -89,22 +89,28 @@ void VersionedCacheableObjectPartList::readObjectPart(
 void VersionedCacheableObjectPartList::fromData(DataInput& input) {
   std::lock_guard<decltype(m_responseLock)> guard(m_responseLock);
   LOGDEBUG("VersionedCacheableObjectPartList::fromData");
+  readParts(input);
+  updateRegion();
+}
+
+void VersionedCacheableObjectPartList::readParts(DataInput& input) {
   uint8_t flags = input.read();
   m_hasKeys = (flags & 0x01) == 0x01;
-  bool hasObjects = (flags & 0x02) == 0x02;
+  m_hasObjects = (flags & 0x02) == 0x02;
+  const auto hasObjects = m_hasObjects;
   m_hasTags = (flags & 0x04) == 0x04;
   m_regionIsVersioned = (flags & 0x08) == 0x08;
   m_serializeValues = (flags & 0x10) == 0x10;
   bool persistent = (flags & 0x20) == 0x20;
   std::shared_ptr<CacheableString> exMsgPtr;
   int32_t len = 0;
-  bool valuesNULL = false;
+  m_valuesNull = false;
   int32_t keysOffset = (m_keysOffset != nullptr ? *m_keysOffset : 0);
   // bool readObjLen = false;
   // int32_t lenOfObjects = 0;
   if (m_values == nullptr) {
     m_values = std::make_shared<HashMapOfCacheable>();
-    valuesNULL = true;
+    m_valuesNull = true;
   }
 
   if (!m_hasKeys && !hasObjects && !m_hasTags) {
@@ -113,8 +119,8 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
         "data. Returning,");
   }
 
-  auto localKeys =
-      std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+  m_localKeys = std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+  const auto& localKeys = m_localKeys;
   if (m_hasKeys) {
     len = static_cast<int32_t>(input.readUnsignedVL());
 
@@ -243,8 +249,13 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
       m_versionTags[index] = versionTag;
     }
   }
+  m_length = len;
+}
 
-  if (hasObjects) {
+void VersionedCacheableObjectPartList::updateRegion() {
+  const auto len = m_length;
+  const int32_t keysOffset = (m_keysOffset != nullptr ? *m_keysOffset : 0);
+  if (m_hasObjects) {
     std::shared_ptr<CacheableKey> key;
     std::shared_ptr<VersionTag> versionTag;
     std::shared_ptr<Cacheable> value;
@@ -253,7 +264,7 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
       if (m_keys != nullptr && !m_hasKeys) {
         key = m_keys->at(index + keysOffset);
       } else /*if (m_resultKeys != nullptr && m_resultKeys->size() > 0)*/ {
-        key = localKeys->at(index);
+        key = m_localKeys->at(index);
       } /*else{
          LOGERROR("VersionedCacheableObjectPartList::fromData: hasObjects = true
        but m_keys is nullptr AND m_resultKeys=nullptr or m_resultKeys->size=0"
@@ -293,7 +304,7 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
     }
   }
   if (m_keysOffset != nullptr) *m_keysOffset += len;
-  if (valuesNULL) m_values = nullptr;
+  if (m_valuesNull) m_values = nullptr;
 }
 
 }  // namespace client
@@ -55,6 +55,12 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
   std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> m_tempKeys;
   std::recursive_mutex& m_responseLock;
 
+  // state of readParts needed by updateRegion
+  std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> m_localKeys;
+  int32_t m_length = 0;
+  bool m_hasObjects = false;
+  bool m_valuesNull = false;
+
   static const uint8_t FLAG_NULL_TAG;
   static const uint8_t FLAG_FULL_TAG;
   static const uint8_t FLAG_TAG_WITH_NEW_ID;
@@ -248,6 +254,18 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
 
   void fromData(DataInput& input) override;
 
+  /**
+   * The first part of fromData, reading the keys, values and version tags
+   * without touching the region or taking the response lock.
+   */
+  void readParts(DataInput& input);
+
+  /**
+   * The second part of fromData, updating the region with the entries read
+   * by readParts.
+   */
+  void updateRegion();
+
   DSFid getDSFID() const override { return DSFid::VersionedObjectPartList; }
 };
 
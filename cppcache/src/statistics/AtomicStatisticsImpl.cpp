@@ -74,22 +74,10 @@ AtomicStatisticsImpl::AtomicStatisticsImpl(StatisticsType* typeArg,
     int32_t doubleCount = statsType->getDoubleStatCount();
 
     if (intCount > 0) {
-      intStorage = new std::atomic<int32_t>[intCount];
-      for (int32_t i = 0; i < intCount; i++) {
-        intStorage[i] = 0;  // Un-initialized state
-      }
-
-    } else {
-      intStorage = nullptr;
+      intStorage.reset(new StripedCounters<int32_t>(intCount));
     }
     if (longCount > 0) {
-      longStorage = new std::atomic<int64_t>[longCount];
-      for (int32_t i = 0; i < longCount; i++) {
-        longStorage[i] = 0;  // Un-initialized state
-      }
-
-    } else {
-      longStorage = nullptr;
+      longStorage.reset(new StripedCounters<int64_t>(longCount));
     }
     if (doubleCount > 0) {
       doubleStorage = new std::atomic<double>[doubleCount];
@@ -107,14 +95,6 @@ AtomicStatisticsImpl::AtomicStatisticsImpl(StatisticsType* typeArg,
 AtomicStatisticsImpl::~AtomicStatisticsImpl() noexcept {
   try {
     statsType = nullptr;
-    if (intStorage != nullptr) {
-      delete[] intStorage;
-      intStorage = nullptr;
-    }
-    if (longStorage != nullptr) {
-      delete[] longStorage;
-      longStorage = nullptr;
-    }
     if (doubleStorage != nullptr) {
       delete[] doubleStorage;
       doubleStorage = nullptr;
@@ -143,7 +123,7 @@ void AtomicStatisticsImpl::_setInt(int32_t offset, int32_t value) {
         offset);
     throw IllegalArgumentException(s);
   }
-  intStorage[offset] = value;
+  intStorage->set(offset, value);
 }
 
 void AtomicStatisticsImpl::_setLong(int32_t offset, int64_t value) {
@@ -156,7 +136,7 @@ void AtomicStatisticsImpl::_setLong(int32_t offset, int64_t value) {
     throw IllegalArgumentException(s);
   }
 
-  longStorage[offset] = value;
+  longStorage->set(offset, value);
 }
 
 void AtomicStatisticsImpl::_setDouble(int32_t offset, double value) {
@@ -181,7 +161,7 @@ int32_t AtomicStatisticsImpl::_getInt(int32_t offset) const {
     throw IllegalArgumentException(s);
   }
 
-  return intStorage[offset];
+  return intStorage->get(offset);
 }
 
 int64_t AtomicStatisticsImpl::_getLong(int32_t offset) const {
@@ -192,7 +172,7 @@ int64_t AtomicStatisticsImpl::_getLong(int32_t offset) const {
         offset);
     throw IllegalArgumentException(s);
   }
-  return longStorage[offset];
+  return longStorage->get(offset);
 }
 
 double AtomicStatisticsImpl::_getDouble(int32_t offset) const {
@@ -247,7 +227,7 @@ int32_t AtomicStatisticsImpl::_incInt(int32_t offset, int32_t delta) {
     throw IllegalArgumentException(s);
   }
 
-  return (intStorage[offset] += delta);
+  return intStorage->add(offset, delta);
 }
 
 int64_t AtomicStatisticsImpl::_incLong(int32_t offset, int64_t delta) {
@@ -257,7 +237,7 @@ int64_t AtomicStatisticsImpl::_incLong(int32_t offset, int64_t delta) {
         " of the Statistic Descriptor is not valid.");
   }
 
-  return (longStorage[offset] += delta);
+  return longStorage->add(offset, delta);
 }
 
 double AtomicStatisticsImpl::_incDouble(int32_t offset, double delta) {
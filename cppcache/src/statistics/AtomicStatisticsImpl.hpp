@@ -21,6 +21,7 @@
 #define GEODE_STATISTICS_ATOMICSTATISTICSIMPL_H_
 
 #include <atomic>
+#include <memory>
 #include <string>
 
 #include <geode/internal/geode_globals.hpp>
@@ -29,6 +30,7 @@
 #include "Statistics.hpp"
 #include "StatisticsFactory.hpp"
 #include "StatisticsTypeImpl.hpp"
+#include "StripedCounters.hpp"
 
 /** @file
  */
@@ -41,6 +43,10 @@ namespace statistics {
  * An implementation of {@link Statistics} that stores its statistics
  * in local memory and support atomic operations
  *
+ * The int and long statistics are striped: every thread increments its own
+ * stripe, and the stripes are only added up when a statistic is read, which
+ * is mostly when the sampler archives it. The inc methods for them return
+ * the calling thread's stripe rather than the statistic's value.
  */
 class AtomicStatisticsImpl : public Statistics, private client::NonCopyable {
  private:
@@ -61,11 +67,11 @@ class AtomicStatisticsImpl : public Statistics, private client::NonCopyable {
   int64_t uniqueId;
 
   /****************************************************************************/
-  /** An array containing the values of the int32_t statistics */
-  std::atomic<int32_t>* intStorage;
+  /** The striped values of the int32_t statistics */
+  std::unique_ptr<StripedCounters<int32_t>> intStorage;
 
-  /** An array containing the values of the int64_t statistics */
-  std::atomic<int64_t>* longStorage;
+  /** The striped values of the int64_t statistics */
+  std::unique_ptr<StripedCounters<int64_t>> longStorage;
 
   /** An array containing the values of the double statistics */
   std::atomic<double>* doubleStorage;
@@ -0,0 +1,351 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpenMetricsExporter.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+#include <ace/INET_Addr.h>
+#include <ace/SOCK_Stream.h>
+
+#include "../DistributedSystemImpl.hpp"
+#include "../util/Log.hpp"
+#include "StatisticDescriptorImpl.hpp"
+#include "StatisticHistogram.hpp"
+#include "StatisticsManager.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+const char* OpenMetricsExporter::NC_OME_Thread = "NC OME Thread";
+
+namespace {
+
+// Requests are a request line and a few headers; anything longer is refused.
+const size_t MaxRequestSize = 8192;
+
+const std::chrono::seconds ClientTimeout(5);
+
+void appendMetricName(std::string& out, const std::string& name) {
+  for (auto c : name) {
+    auto valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                 (c >= '0' && c <= '9') || c == '_' || c == ':';
+    out += valid ? c : '_';
+  }
+}
+
+void appendEscaped(std::string& out, const std::string& text) {
+  for (auto c : text) {
+    switch (c) {
+      case '\\':
+        out += "\\\\";
+        break;
+      case '"':
+        out += "\\\"";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      default:
+        out += c;
+    }
+  }
+}
+
+void appendValue(std::string& out, FieldType typeCode, int64_t rawBits) {
+  char buffer[32];
+  if (typeCode == DOUBLE_TYPE) {
+    double value;
+    std::memcpy(&value, &rawBits, sizeof(value));
+    if (std::isnan(value)) {
+      out += "NaN";
+      return;
+    } else if (std::isinf(value)) {
+      out += value > 0 ? "+Inf" : "-Inf";
+      return;
+    }
+    std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  } else {
+    std::snprintf(buffer, sizeof(buffer), "%" PRId64, rawBits);
+  }
+  out += buffer;
+}
+
+void appendLabels(std::string& out,
+                  const OpenMetricsExporter::InstanceSnapshot& instance) {
+  out += "name=\"";
+  appendEscaped(out, instance.textId);
+  out += "\",id=\"" + std::to_string(instance.numericId) + '"';
+}
+
+// Bucket bounds are whole nanoseconds under 1000 seconds, so 12 significant
+// digits of seconds represent them exactly.
+std::string formatBucketBound(int32_t bucket) {
+  if (bucket == StatisticHistogram::BucketCount - 1) {
+    return "+Inf";
+  }
+  char buffer[32];
+  std::snprintf(
+      buffer, sizeof(buffer), "%.12g",
+      static_cast<double>(StatisticHistogram::getBucketUpperBound(bucket)) /
+          1e9);
+  return buffer;
+}
+
+// Exports the bucket counters of a StatisticHistogram as one histogram with
+// cumulative buckets, from which Prometheus computes quantiles.
+void appendHistogram(
+    std::string& out, const std::string& family, const std::string& help,
+    int32_t firstBucketId,
+    std::vector<OpenMetricsExporter::InstanceSnapshot>::const_iterator begin,
+    std::vector<OpenMetricsExporter::InstanceSnapshot>::const_iterator end) {
+  out += "# TYPE " + family + " histogram\n";
+  out += "# UNIT " + family + " seconds\n";
+  out += "# HELP " + family + ' ';
+  appendEscaped(out, help);
+  out += '\n';
+
+  for (auto instance = begin; instance != end; ++instance) {
+    int64_t count = 0;
+    for (int32_t bucket = 0; bucket < StatisticHistogram::BucketCount;
+         bucket++) {
+      count += instance->values[firstBucketId + bucket];
+      out += family + "_bucket{";
+      appendLabels(out, *instance);
+      out += ",le=\"" + formatBucketBound(bucket) + "\"} " +
+             std::to_string(count) + '\n';
+    }
+    out += family + "_count{";
+    appendLabels(out, *instance);
+    out += "} " + std::to_string(count) + '\n';
+  }
+}
+
+bool sendAll(ACE_SOCK_Stream& stream, const std::string& data) {
+  ACE_Time_Value timeout(ClientTimeout);
+  size_t sent = 0;
+  return stream.send_n(data.data(), data.size(), &timeout, &sent) != -1 &&
+         sent == data.size();
+}
+
+}  // namespace
+
+OpenMetricsExporter::OpenMetricsExporter(StatisticsManager* statisticsManager,
+                                         std::string bindAddress,
+                                         uint16_t port)
+    : m_statisticsManager(statisticsManager),
+      m_bindAddress(std::move(bindAddress)),
+      m_port(port),
+      m_running(false),
+      m_stopRequested(false) {}
+
+void OpenMetricsExporter::start() {
+  if (m_running) {
+    return;
+  }
+  ACE_INET_Addr address(m_port, m_bindAddress.c_str());
+  if (m_acceptor.open(address, 1) == -1) {
+    LOGERROR("Unable to export statistics on %s:%d: %s",
+             m_bindAddress.c_str(), m_port,
+             ACE_OS::strerror(ACE_OS::last_error()));
+    return;
+  }
+  LOGINFO("Exporting statistics in OpenMetrics format on %s:%d",
+          m_bindAddress.c_str(), m_port);
+  m_running = true;
+  m_stopRequested = false;
+  this->activate();
+}
+
+void OpenMetricsExporter::stop() {
+  if (!m_running) {
+    return;
+  }
+  m_stopRequested = true;
+  this->wait();
+  m_acceptor.close();
+  m_running = false;
+}
+
+int32_t OpenMetricsExporter::svc() {
+  client::DistributedSystemImpl::setThreadName(NC_OME_Thread);
+  while (!m_stopRequested) {
+    ACE_SOCK_Stream stream;
+    // Wake up regularly to notice stop requests.
+    ACE_Time_Value timeout(1);
+    if (m_acceptor.accept(stream, nullptr, &timeout) == -1) {
+      continue;
+    }
+    try {
+      serve(stream);
+    } catch (const std::exception& ex) {
+      LOGWARN("Failed to serve statistics: %s", ex.what());
+    }
+    stream.close();
+  }
+  return 0;
+}
+
+void OpenMetricsExporter::serve(ACE_SOCK_Stream& stream) {
+  // Read the request head, which is all a GET has.
+  std::string request;
+  char buffer[1024];
+  while (request.find("\r\n\r\n") == std::string::npos) {
+    if (request.size() >= MaxRequestSize) {
+      sendAll(stream,
+              "HTTP/1.1 431 Request Header Fields Too Large\r\n"
+              "Content-Length: 0\r\nConnection: close\r\n\r\n");
+      return;
+    }
+    ACE_Time_Value timeout(ClientTimeout);
+    auto received = stream.recv(buffer, sizeof(buffer), &timeout);
+    if (received <= 0) {
+      return;
+    }
+    request.append(buffer, static_cast<size_t>(received));
+  }
+
+  auto requestLine = request.substr(0, request.find("\r\n"));
+  if (requestLine.compare(0, 4, "GET ") != 0) {
+    sendAll(stream,
+            "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\n"
+            "Content-Length: 0\r\nConnection: close\r\n\r\n");
+    return;
+  }
+  auto path = requestLine.substr(4, requestLine.find(' ', 4) - 4);
+  if (path != "/" && path != "/metrics") {
+    sendAll(stream,
+            "HTTP/1.1 404 Not Found\r\n"
+            "Content-Length: 0\r\nConnection: close\r\n\r\n");
+    return;
+  }
+
+  auto body = scrape();
+  sendAll(stream,
+          "HTTP/1.1 200 OK\r\n"
+          "Content-Type: application/openmetrics-text; version=1.0.0; "
+          "charset=utf-8\r\n"
+          "Content-Length: " +
+              std::to_string(body.size()) +
+              "\r\n"
+              "Connection: close\r\n\r\n" +
+              body);
+}
+
+std::string OpenMetricsExporter::scrape() {
+  std::vector<InstanceSnapshot> snapshots;
+  {
+    std::lock_guard<decltype(m_statisticsManager->getListMutex())> guard(
+        m_statisticsManager->getListMutex());
+    auto& statsList = m_statisticsManager->getStatsList();
+    snapshots.reserve(statsList.size());
+    for (auto statistics : statsList) {
+      if (statistics == nullptr || statistics->isClosed()) {
+        continue;
+      }
+      auto type = statistics->getType();
+      auto descriptors = type->getStatistics();
+      auto count = type->getDescriptorsCount();
+      snapshots.push_back(InstanceSnapshot{type, statistics->getTextId(),
+                                           statistics->getNumericId(),
+                                           std::vector<int64_t>()});
+      auto& values = snapshots.back().values;
+      values.reserve(count);
+      for (int32_t i = 0; i < count; i++) {
+        values.push_back(statistics->getRawBits(descriptors[i]));
+      }
+    }
+  }
+  return format(snapshots);
+}
+
+std::string OpenMetricsExporter::format(
+    std::vector<InstanceSnapshot>& snapshots) {
+  // The samples of a metric family must be contiguous.
+  std::stable_sort(
+      snapshots.begin(), snapshots.end(),
+      [](const InstanceSnapshot& a, const InstanceSnapshot& b) {
+        return a.type->getName() < b.type->getName() ||
+               (a.type == b.type && a.textId < b.textId);
+      });
+
+  std::string out;
+  auto typeBegin = snapshots.begin();
+  while (typeBegin != snapshots.end()) {
+    auto type = typeBegin->type;
+    auto typeEnd = std::find_if(
+        typeBegin, snapshots.end(),
+        [type](const InstanceSnapshot& s) { return s.type != type; });
+
+    auto descriptors = type->getStatistics();
+    auto count = type->getDescriptorsCount();
+    for (int32_t i = 0; i < count; i++) {
+      std::string family = "geode_";
+      appendMetricName(family, type->getName());
+      family += '_';
+
+      std::string histogramName;
+      std::string histogramDescription;
+      if (StatisticHistogram::findHistogram(type, i, histogramName,
+                                            histogramDescription)) {
+        appendMetricName(family, histogramName);
+        family += "_seconds";
+        appendHistogram(out, family, histogramDescription, i, typeBegin,
+                        typeEnd);
+        i += StatisticHistogram::BucketCount - 1;
+        continue;
+      }
+
+      auto descriptor = dynamic_cast<StatisticDescriptorImpl*>(descriptors[i]);
+      if (descriptor == nullptr) {
+        continue;
+      }
+      appendMetricName(family, descriptor->getName());
+      auto isCounter = descriptor->isCounter();
+
+      out += "# TYPE " + family + (isCounter ? " counter\n" : " gauge\n");
+      out += "# HELP " + family + ' ';
+      appendEscaped(out, descriptor->getDescription());
+      out += '\n';
+
+      for (auto instance = typeBegin; instance != typeEnd; ++instance) {
+        out += family;
+        if (isCounter) {
+          out += "_total";
+        }
+        out += '{';
+        appendLabels(out, *instance);
+        out += "} ";
+        appendValue(out, descriptor->getTypeCode(), instance->values[i]);
+        out += '\n';
+      }
+    }
+    typeBegin = typeEnd;
+  }
+  out += "# EOF\n";
+  return out;
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STATISTICS_OPENMETRICSEXPORTER_H_
+#define GEODE_STATISTICS_OPENMETRICSEXPORTER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ace/SOCK_Acceptor.h>
+#include <ace/Task.h>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "StatisticsType.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+class StatisticsManager;
+
+/**
+ * Serves the current values of all statistics in OpenMetrics text format
+ * over HTTP, for scraping by Prometheus and compatible collectors.
+ *
+ * Every descriptor of a statistics type becomes a metric family named
+ * geode_<type>_<statistic>, with one sample per statistics instance labeled
+ * with the text and numeric ids of the instance. The bucket counters of a
+ * StatisticHistogram become a single histogram family in seconds instead.
+ *
+ * A scrape copies the values of all instances while holding the statistics
+ * list lock, which only serializes it with creation of statistics and the
+ * sampler, and formats them after releasing it. Threads updating statistics
+ * are never blocked.
+ */
+class APACHE_GEODE_EXPORT OpenMetricsExporter : public ACE_Task_Base {
+ public:
+  /** The values of one statistics instance at the time of a scrape. */
+  struct InstanceSnapshot {
+    const StatisticsType* type;
+    std::string textId;
+    int64_t numericId;
+    /** Raw bits of each statistic, in descriptor order. */
+    std::vector<int64_t> values;
+  };
+
+  OpenMetricsExporter(StatisticsManager* statisticsManager,
+                      std::string bindAddress, uint16_t port);
+  OpenMetricsExporter(const OpenMetricsExporter&) = delete;
+  OpenMetricsExporter& operator=(const OpenMetricsExporter&) = delete;
+  ~OpenMetricsExporter() noexcept override {}
+
+  /**
+   * Starts listening on the port. Logs an error and does nothing else if the
+   * port can't be bound.
+   */
+  void start();
+  void stop();
+  int32_t svc(void) override;
+
+  /** @return the exposition of the current values of all statistics. */
+  std::string scrape();
+
+  /** @return the exposition of snapshots. */
+  static std::string format(std::vector<InstanceSnapshot>& snapshots);
+
+ private:
+  void serve(ACE_SOCK_Stream& stream);
+
+  StatisticsManager* m_statisticsManager;
+  std::string m_bindAddress;
+  uint16_t m_port;
+  ACE_SOCK_Acceptor m_acceptor;
+  std::atomic<bool> m_running;
+  std::atomic<bool> m_stopRequested;
+  static const char* NC_OME_Thread;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_OPENMETRICSEXPORTER_H_
@@ -0,0 +1,156 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StatisticHistogram.hpp"
+
+#include <limits>
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+constexpr int32_t StatisticHistogram::BucketCount;
+
+void StatisticHistogram::createDescriptors(StatisticsFactory* factory,
+                                           const std::string& name,
+                                           const std::string& description,
+                                           StatisticDescriptor** descriptors) {
+  for (int32_t bucket = 0; bucket < BucketCount - 1; bucket++) {
+    descriptors[bucket] = factory->createLongCounter(
+        getBucketName(name, bucket),
+        description + " that took less than " +
+            std::to_string(getBucketUpperBound(bucket)) + " nanoseconds",
+        "operations", false);
+  }
+  descriptors[BucketCount - 1] = factory->createLongCounter(
+      getBucketName(name, BucketCount - 1),
+      description + " that took " +
+          std::to_string(getBucketUpperBound(BucketCount - 2)) +
+          " nanoseconds or longer",
+      "operations", false);
+}
+
+int32_t StatisticHistogram::nameToId(const StatisticsType* type,
+                                     const std::string& name) {
+  return type->nameToId(getBucketName(name, 0));
+}
+
+bool StatisticHistogram::findHistogram(const StatisticsType* type,
+                                       int32_t firstBucketId,
+                                       std::string& name,
+                                       std::string& description) {
+  if (firstBucketId < 0 ||
+      firstBucketId + BucketCount > type->getDescriptorsCount()) {
+    return false;
+  }
+  auto descriptors = type->getStatistics() + firstBucketId;
+
+  const auto& firstName = descriptors[0]->getName();
+  const auto nameSuffix = getBucketName("", 0);
+  if (firstName.size() <= nameSuffix.size() ||
+      firstName.compare(firstName.size() - nameSuffix.size(),
+                        nameSuffix.size(), nameSuffix) != 0) {
+    return false;
+  }
+  auto histogramName =
+      firstName.substr(0, firstName.size() - nameSuffix.size());
+  for (int32_t bucket = 1; bucket < BucketCount; bucket++) {
+    if (descriptors[bucket]->getName() !=
+        getBucketName(histogramName, bucket)) {
+      return false;
+    }
+  }
+
+  const auto& firstDescription = descriptors[0]->getDescription();
+  const auto descriptionSuffix = getFirstBucketDescriptionSuffix();
+  if (firstDescription.size() >= descriptionSuffix.size() &&
+      firstDescription.compare(
+          firstDescription.size() - descriptionSuffix.size(),
+          descriptionSuffix.size(), descriptionSuffix) == 0) {
+    description = firstDescription.substr(
+        0, firstDescription.size() - descriptionSuffix.size());
+  } else {
+    description = firstDescription;
+  }
+  name = std::move(histogramName);
+  return true;
+}
+
+std::string StatisticHistogram::getFirstBucketDescriptionSuffix() {
+  return " that took less than " + std::to_string(getBucketUpperBound(0)) +
+         " nanoseconds";
+}
+
+std::string StatisticHistogram::getBucketName(const std::string& name,
+                                              int32_t bucket) {
+  if (bucket < BucketCount - 1) {
+    return name + "_lt_" + std::to_string(getBucketUpperBound(bucket)) + "ns";
+  }
+  return name + "_ge_" + std::to_string(getBucketUpperBound(bucket - 1)) +
+         "ns";
+}
+
+int32_t StatisticHistogram::getFirstBucket(int octave) {
+  const int32_t quarterBuckets = 4 * (LastQuarterOctave + 1 - FirstOctave);
+  const int32_t halfBuckets = 2 * (LastHalfOctave - LastQuarterOctave);
+  if (octave <= LastQuarterOctave + 1) {
+    return 1 + 4 * (octave - FirstOctave);
+  }
+  if (octave <= LastHalfOctave + 1) {
+    return 1 + quarterBuckets + 2 * (octave - LastQuarterOctave - 1);
+  }
+  return 1 + quarterBuckets + halfBuckets + (octave - LastHalfOctave - 1);
+}
+
+int32_t StatisticHistogram::getBucket(int64_t nanos) {
+  if (nanos < (int64_t{1} << FirstOctave)) {
+    return 0;
+  }
+  if (nanos >= (int64_t{1} << (LastOctave + 1))) {
+    return BucketCount - 1;
+  }
+  auto value = static_cast<uint64_t>(nanos);
+  int octave = LastOctave;
+  while (!(value & (uint64_t{1} << octave))) {
+    octave--;
+  }
+  auto subBucketBits = getSubBucketBits(octave);
+  auto subBucket = static_cast<int32_t>((value >> (octave - subBucketBits)) &
+                                        ((1 << subBucketBits) - 1));
+  return getFirstBucket(octave) + subBucket;
+}
+
+int64_t StatisticHistogram::getBucketUpperBound(int32_t bucket) {
+  if (bucket <= 0) {
+    return int64_t{1} << FirstOctave;
+  }
+  if (bucket >= BucketCount - 1) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  auto octave = LastOctave;
+  while (getFirstBucket(octave) > bucket) {
+    octave--;
+  }
+  auto subBucketBits = getSubBucketBits(octave);
+  auto subBucket = bucket - getFirstBucket(octave);
+  return int64_t{(1 << subBucketBits) + subBucket + 1}
+         << (octave - subBucketBits);
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
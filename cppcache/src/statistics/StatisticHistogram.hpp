@@ -0,0 +1,134 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STATISTICS_STATISTICHISTOGRAM_H_
+#define GEODE_STATISTICS_STATISTICHISTOGRAM_H_
+
+#include <cstdint>
+#include <string>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "StatisticDescriptor.hpp"
+#include "Statistics.hpp"
+#include "StatisticsFactory.hpp"
+#include "StatisticsType.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+/**
+ * A latency histogram kept as a run of consecutive long counters of a
+ * statistics type, one counter per bucket. Recording a sample increments a
+ * single counter, and the sampler archives the buckets like any other
+ * counter, so archive readers need no knowledge of histograms.
+ *
+ * Buckets are log-linear in nanoseconds: everything under 2 microseconds
+ * lands in the first bucket, and each power of two from there is split into
+ * four buckets up to about 16.8 milliseconds, into two buckets up to about
+ * 1.07 seconds and kept whole up to about 275 seconds. The last bucket holds
+ * everything longer. A bucket is thus at most 25%, 50% and 100% wider than
+ * its lower bound in those ranges, which keeps the resolution where
+ * operation latencies usually are while function executions and connection
+ * waits still fit. The bucket count is capped because every bucket is a
+ * striped counter in each statistics instance, and three histograms have to
+ * fit in the MAX_DESCRIPTORS_PER_TYPE of the pool statistics.
+ */
+class APACHE_GEODE_EXPORT StatisticHistogram {
+ public:
+  /** Number of descriptors, and thus statistic ids, used by a histogram. */
+  static constexpr int32_t BucketCount = 74;
+
+  /**
+   * Creates the bucket descriptors of the histogram name into descriptors,
+   * which must have room for BucketCount entries. The bucket counters are
+   * named after the histogram and the upper bound of the bucket, e.g.
+   * getLatency_lt_2560ns.
+   */
+  static void createDescriptors(StatisticsFactory* factory,
+                                const std::string& name,
+                                const std::string& description,
+                                StatisticDescriptor** descriptors);
+
+  /**
+   * @return the id of the first bucket of the histogram name in type.
+   * @throws IllegalArgumentException if type has no such histogram.
+   */
+  static int32_t nameToId(const StatisticsType* type, const std::string& name);
+
+  /**
+   * Checks whether the descriptor firstBucketId of type is the first bucket
+   * of a histogram, so that exporters can present the buckets as one
+   * histogram.
+   * @return true if it is, with the name and description the histogram was
+   * created with in name and description.
+   */
+  static bool findHistogram(const StatisticsType* type, int32_t firstBucketId,
+                            std::string& name, std::string& description);
+
+  /** @return the bucket a sample of nanos nanoseconds is counted in. */
+  static int32_t getBucket(int64_t nanos);
+
+  /**
+   * @return the exclusive upper bound of bucket in nanoseconds, INT64_MAX
+   * for the last bucket.
+   */
+  static int64_t getBucketUpperBound(int32_t bucket);
+
+  /**
+   * Counts a sample of nanos nanoseconds in the histogram whose first bucket
+   * has the id firstBucketId in statistics.
+   */
+  static void record(Statistics* statistics, int32_t firstBucketId,
+                     int64_t nanos) {
+    statistics->incLong(firstBucketId + getBucket(nanos), 1);
+  }
+
+ private:
+  static const int FirstOctave = 11;
+  /** last octave split into four buckets */
+  static const int LastQuarterOctave = 23;
+  /** last octave split into two buckets */
+  static const int LastHalfOctave = 29;
+  static const int LastOctave = 37;
+
+  /** @return log2 of the number of buckets octave is split into. */
+  static int getSubBucketBits(int octave) {
+    return octave <= LastQuarterOctave ? 2 : octave <= LastHalfOctave ? 1 : 0;
+  }
+
+  /** @return the bucket the samples of 2^octave nanoseconds are counted in. */
+  static int32_t getFirstBucket(int octave);
+
+  static std::string getBucketName(const std::string& name, int32_t bucket);
+  static std::string getFirstBucketDescriptionSuffix();
+
+  static_assert(BucketCount ==
+                    1 + 4 * (LastQuarterOctave - FirstOctave + 1) +
+                        2 * (LastHalfOctave - LastQuarterOctave) +
+                        (LastOctave - LastHalfOctave) + 1,
+                "BucketCount must match the octaves covered");
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_STATISTICHISTOGRAM_H_
@@ -39,6 +39,9 @@ namespace statistics {
  * methods for
  * setting, incrementing and getting individual <code>StatisticDescriptor</code>
  * values.
+ *
+ * Atomic statistics stripe their int and long values per thread, so their
+ * inc methods return the calling thread's stripe, not the summed value.
  */
 class APACHE_GEODE_EXPORT Statistics {
  public:
@@ -373,7 +376,8 @@ class APACHE_GEODE_EXPORT Statistics {
    * or {@link StatisticsType#nameToId}.
    * @param delta change value to be added
    *
-   * @return The value of the statistic after it has been incremented
+   * @return The value of the statistic after it has been incremented,
+   *         or the calling thread's stripe of it for atomic statistics
    *
    * @throws IllegalArgumentException
    *         If the id is invalid.
@@ -387,7 +391,8 @@ class APACHE_GEODE_EXPORT Statistics {
    * #nameToDescriptor}
    * or {@link StatisticsType#nameToDescriptor}.
    * @param delta change value to be added
-   * @return The value of the statistic after it has been incremented
+   * @return The value of the statistic after it has been incremented,
+   *         or the calling thread's stripe of it for atomic statistics
    *
    * @throws IllegalArgumentException
    *         If no statistic exists with the given <code>descriptor</code> or
@@ -402,7 +407,8 @@ class APACHE_GEODE_EXPORT Statistics {
    * the given name by a given amount.
    * @param name statistic name
    * @param delta change value to be added
-   * @return The value of the statistic after it has been incremented
+   * @return The value of the statistic after it has been incremented,
+   *         or the calling thread's stripe of it for atomic statistics
    *
    * @throws IllegalArgumentException
    *         If no statistic exists with name <code>name</code> or
@@ -419,7 +425,8 @@ class APACHE_GEODE_EXPORT Statistics {
    * or {@link StatisticsType#nameToId}.
    * @param delta change value to be added
    *
-   * @return The value of the statistic after it has been incremented
+   * @return The value of the statistic after it has been incremented,
+   *         or the calling thread's stripe of it for atomic statistics
    *
    * @throws IllegalArgumentException
    *         If the id is invalid.
@@ -434,7 +441,8 @@ class APACHE_GEODE_EXPORT Statistics {
    * #nameToDescriptor}
    * or {@link StatisticsType#nameToDescriptor}.
    * @param delta change value to be added
-   * @return The value of the statistic after it has been incremented
+   * @return The value of the statistic after it has been incremented,
+   *         or the calling thread's stripe of it for atomic statistics
    *
    * @throws IllegalArgumentException
    *         If no statistic exists with the given <code>descriptor</code> or
@@ -449,7 +457,8 @@ class APACHE_GEODE_EXPORT Statistics {
    *
    * @param name statistic name
    * @param delta change value to be added
-   * @return The value of the statistic after it has been incremented
+   * @return The value of the statistic after it has been incremented,
+   *         or the calling thread's stripe of it for atomic statistics
    *
    * @throws IllegalArgumentException
    *         If no statistic exists with name <code>name</code> or
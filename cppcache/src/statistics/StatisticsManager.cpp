@@ -37,7 +37,8 @@ using client::Log;
 StatisticsManager::StatisticsManager(
     const char* filePath, const std::chrono::milliseconds sampleInterval,
     bool enabled, CacheImpl* cache, int64_t statFileLimit,
-    int64_t statDiskSpaceLimit)
+    int64_t statDiskSpaceLimit, uint16_t exporterPort,
+    const std::string& exporterBindAddress)
     : m_sampleIntervalMs(sampleInterval),
       m_sampler(nullptr),
       m_adminRegion(nullptr) {
@@ -51,6 +52,11 @@ StatisticsManager::StatisticsManager(
                                       statFileLimit, statDiskSpaceLimit);
       m_sampler->start();
     }
+    if (exporterPort != 0) {
+      m_exporter = std::unique_ptr<OpenMetricsExporter>(
+          new OpenMetricsExporter(this, exporterBindAddress, exporterPort));
+      m_exporter->start();
+    }
   } catch (...) {
     delete m_sampler;
     throw;
@@ -63,8 +69,11 @@ void StatisticsManager::forceSample() {
 
 StatisticsManager::~StatisticsManager() {
   try {
-    // Stop the sampler
+    // Stop the sampler and the exporter
     closeSampler();
+    if (m_exporter) {
+      m_exporter->stop();
+    }
 
     // List should be empty if close() is called on each Stats object
     // If this is not done, delete all the pointers
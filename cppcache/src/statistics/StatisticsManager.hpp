@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include <geode/ExceptionTypes.hpp>
@@ -30,6 +31,7 @@
 #include "../AdminRegion.hpp"
 #include "GeodeStatisticsFactory.hpp"
 #include "HostStatSampler.hpp"
+#include "OpenMetricsExporter.hpp"
 #include "Statistics.hpp"
 #include "StatisticsTypeImpl.hpp"
 
@@ -53,6 +55,9 @@ class StatisticsManager {
   // Statistics sampler
   HostStatSampler* m_sampler;
 
+  // Serves statistics for scraping, if an exporter port is configured
+  std::unique_ptr<OpenMetricsExporter> m_exporter;
+
   // Vector containing all the Stats objects
   std::vector<Statistics*> m_statsList;
 
@@ -72,7 +77,9 @@ class StatisticsManager {
   StatisticsManager(const char* filePath,
                     std::chrono::milliseconds sampleIntervalMs, bool enabled,
                     client::CacheImpl* cache, int64_t statFileLimit = 0,
-                    int64_t statDiskSpaceLimit = 0);
+                    int64_t statDiskSpaceLimit = 0,
+                    uint16_t exporterPort = 0,
+                    const std::string& exporterBindAddress = "");
 
   void RegisterAdminRegion(std::shared_ptr<AdminRegion> adminRegPtr) {
     m_adminRegion = adminRegPtr;
@@ -0,0 +1,62 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StripedCounters.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+constexpr size_t StripedCountersBase::CacheLineSize;
+
+namespace {
+
+// Enough stripes to spread the cores of a large host, without making every
+// statistics instance of a small one much bigger.
+const size_t MaxStripes = 16;
+
+size_t computeStripeCount() {
+  auto threads = std::min<size_t>(
+      std::max(std::thread::hardware_concurrency(), 1u), MaxStripes);
+  size_t stripes = 1;
+  while (stripes < threads) {
+    stripes <<= 1;
+  }
+  return stripes;
+}
+
+}  // namespace
+
+size_t StripedCountersBase::getStripeCount() {
+  static const size_t stripeCount = computeStripeCount();
+  return stripeCount;
+}
+
+size_t StripedCountersBase::getCurrentStripe() {
+  static std::atomic<size_t> nextStripe(0);
+  static thread_local size_t stripe =
+      nextStripe.fetch_add(1, std::memory_order_relaxed) &
+      (getStripeCount() - 1);
+  return stripe;
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
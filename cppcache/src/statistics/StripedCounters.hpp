@@ -0,0 +1,142 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STATISTICS_STRIPEDCOUNTERS_H_
+#define GEODE_STATISTICS_STRIPEDCOUNTERS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+class APACHE_GEODE_EXPORT StripedCountersBase {
+ public:
+  /** Size of the cache lines the stripes are aligned to. */
+  static constexpr size_t CacheLineSize = 64;
+
+  /**
+   * @return the number of stripes of every counter array, a power of two
+   * derived from the number of hardware threads.
+   */
+  static size_t getStripeCount();
+
+ protected:
+  /**
+   * @return the stripe of the calling thread. Threads are assigned stripes
+   * round robin on first use.
+   */
+  static size_t getCurrentStripe();
+};
+
+/**
+ * An array of counters each of which is split into one stripe per group of
+ * threads. A thread only adds to its own stripe, so threads running on
+ * different cores don't contend for the cache line of a shared counter.
+ * The stripes of a counter are added up when it is read.
+ *
+ * The counters of a stripe are contiguous and each stripe starts on its own
+ * cache line.
+ */
+template <class T>
+class StripedCounters : public StripedCountersBase {
+ public:
+  explicit StripedCounters(size_t count)
+      : m_stride(strideFor(count)), m_counters(nullptr) {
+    if (count == 0) {
+      return;
+    }
+    auto stripeCount = getStripeCount();
+    m_memory.reset(
+        new uint8_t[stripeCount * m_stride * sizeof(Counter) + CacheLineSize]);
+    auto address = reinterpret_cast<uintptr_t>(m_memory.get());
+    auto aligned = (address + CacheLineSize - 1) & ~(CacheLineSize - 1);
+    m_counters = reinterpret_cast<Counter*>(aligned);
+    for (size_t i = 0; i < stripeCount * m_stride; i++) {
+      new (&m_counters[i]) Counter(0);
+    }
+  }
+
+  StripedCounters(const StripedCounters&) = delete;
+  StripedCounters& operator=(const StripedCounters&) = delete;
+
+  /**
+   * Adds delta to the calling thread's stripe of the counter.
+   * @return the new value of the stripe.
+   */
+  T add(size_t index, T delta) {
+    auto previous = m_counters[getCurrentStripe() * m_stride + index].fetch_add(
+        delta, std::memory_order_relaxed);
+    return static_cast<T>(static_cast<Unsigned>(previous) +
+                          static_cast<Unsigned>(delta));
+  }
+
+  /** @return the sum of the stripes of the counter. */
+  T get(size_t index) const {
+    // Stripes wrap around like a single atomic counter would.
+    Unsigned value = 0;
+    auto stripeCount = getStripeCount();
+    for (size_t stripe = 0; stripe < stripeCount; stripe++) {
+      value += static_cast<Unsigned>(
+          m_counters[stripe * m_stride + index].load(
+              std::memory_order_relaxed));
+    }
+    return static_cast<T>(value);
+  }
+
+  /**
+   * Sets the counter to value. Increments made by other threads while the
+   * stripes are reset may be lost.
+   */
+  void set(size_t index, T value) {
+    auto stripeCount = getStripeCount();
+    for (size_t stripe = 1; stripe < stripeCount; stripe++) {
+      m_counters[stripe * m_stride + index].store(0,
+                                                  std::memory_order_relaxed);
+    }
+    m_counters[index].store(value, std::memory_order_relaxed);
+  }
+
+ private:
+  typedef std::atomic<T> Counter;
+  typedef typename std::make_unsigned<T>::type Unsigned;
+
+  static constexpr size_t CountersPerLine = CacheLineSize / sizeof(Counter);
+
+  static size_t strideFor(size_t count) {
+    return (count + CountersPerLine - 1) / CountersPerLine * CountersPerLine;
+  }
+
+  size_t m_stride;
+  std::unique_ptr<uint8_t[]> m_memory;
+  Counter* m_counters;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_STRIPEDCOUNTERS_H_
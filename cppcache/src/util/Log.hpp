@@ -20,7 +20,9 @@
 #ifndef GEODE_LOG_H_
 #define GEODE_LOG_H_
 
+#include <chrono>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 
@@ -29,8 +31,16 @@
 
 /******************************************************************************/
 
+/* Log statements of levels above this one are compiled out. Set with the
+ * GEODE_HIGHEST_LOG_LEVEL CMake option. */
 #ifndef GEODE_HIGHEST_LOG_LEVEL
-#define GEODE_HIGHEST_LOG_LEVEL LogLevel::All
+#define GEODE_HIGHEST_LOG_LEVEL ::apache::geode::client::LogLevel::All
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GEODE_LOG_UNLIKELY(expr) __builtin_expect(!!(expr), 0)
+#else
+#define GEODE_LOG_UNLIKELY(expr) (expr)
 #endif
 
 #ifndef GEODE_MAX_LOG_FILE_LIMIT
@@ -52,6 +62,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class AsyncLogWriter;
 class Exception;
 
 /******************************************************************************/
@@ -172,6 +183,22 @@ class APACHE_GEODE_EXPORT Log {
    */
   static void close();
 
+  /**
+   * Moves formatting and writing of log lines, including rolling of log
+   * files, to a background thread. Logging threads only add their messages
+   * to a queue holding up to queueSize lines. When the queue is full they
+   * wait for the background thread, or if dropWhenFull is set discard the
+   * line; the background thread logs how many lines were dropped.
+   * Asynchronous logging lasts until the next close().
+   */
+  static void startAsync(uint32_t queueSize, bool dropWhenFull);
+
+  /**
+   * Returns the number of log lines discarded because the asynchronous log
+   * queue was full.
+   */
+  static uint64_t droppedLineCount();
+
   /**
    * returns character string for given log level. The string will be
    * identical to the enum declaration above, except it will be all
@@ -205,13 +232,21 @@ class APACHE_GEODE_EXPORT Log {
 
   /******/
 
+  /**
+   * Returns whether log messages at given level are compiled in, that is
+   * whether level is at most GEODE_HIGHEST_LOG_LEVEL. Debug messages are
+   * always compiled into debug builds.
+   */
+  static constexpr bool compiledIn(LogLevel level) {
+    return (s_doingDebug && level == LogLevel::Debug) ||
+           GEODE_HIGHEST_LOG_LEVEL >= level;
+  }
+
   /**
    * Returns whether log messages at given level are enabled.
    */
   static bool enabled(LogLevel level) {
-    return (((s_doingDebug && level == LogLevel::Debug) ||
-             GEODE_HIGHEST_LOG_LEVEL >= level) &&
-            s_logLevel >= level);
+    return compiledIn(level) && s_logLevel >= level;
   }
 
   /**
@@ -534,6 +569,21 @@ class APACHE_GEODE_EXPORT Log {
 
   static void writeBanner();
 
+  static void stopAsync();
+
+  static char* formatLogLine(char* buf, LogLevel level,
+                             std::chrono::system_clock::time_point time,
+                             uint64_t threadId);
+
+  // Writes a log-line, rolling the log file if needed. The caller must hold
+  // the log mutex.
+  static void write(LogLevel level, std::chrono::system_clock::time_point time,
+                    uint64_t threadId, const char* msg, bool flush);
+
+  static void flush();
+
+  friend class AsyncLogWriter;
+
   /******/
  public:
   static void put(LogLevel level, const std::string& msg);
@@ -621,60 +671,62 @@ class APACHE_GEODE_EXPORT LogVarargs {
 }  // namespace geode
 }  // namespace apache
 
+/* Runs the statement that follows if messages at level are compiled in and
+ * enabled. A level above GEODE_HIGHEST_LOG_LEVEL folds the condition to a
+ * constant, so the statement is removed; otherwise the arguments of the
+ * statement are only evaluated once the level is known to be enabled. */
+#define GEODE_LOG_IF_ENABLED(level)                                      \
+  if (!(::apache::geode::client::Log::compiledIn(level) &&               \
+        GEODE_LOG_UNLIKELY(level <=                                      \
+                           ::apache::geode::client::Log::logLevel()))) { \
+  } else
+
 /************************ LOGDEBUG ***********************************/
 
-#define LOGDEBUG                                  \
-  if (::apache::geode::client::LogLevel::Debug <= \
-      ::apache::geode::client::Log::logLevel())   \
+#define LOGDEBUG                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Debug) \
   ::apache::geode::client::LogVarargs::debug
 
 /************************ LOGERROR ***********************************/
 
-#define LOGERROR                                  \
-  if (::apache::geode::client::LogLevel::Error <= \
-      ::apache::geode::client::Log::logLevel())   \
+#define LOGERROR                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Error) \
   ::apache::geode::client::LogVarargs::error
 
 /************************ LOGWARN ***********************************/
 
-#define LOGWARN                                     \
-  if (::apache::geode::client::LogLevel::Warning <= \
-      ::apache::geode::client::Log::logLevel())     \
+#define LOGWARN                                                    \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Warning) \
   ::apache::geode::client::LogVarargs::warn
 
 /************************ LOGINFO ***********************************/
 
-#define LOGINFO                                  \
-  if (::apache::geode::client::LogLevel::Info <= \
-      ::apache::geode::client::Log::logLevel())  \
+#define LOGINFO                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Info) \
   ::apache::geode::client::LogVarargs::info
 
 /************************ LOGCONFIG ***********************************/
 
-#define LOGCONFIG                                  \
-  if (::apache::geode::client::LogLevel::Config <= \
-      ::apache::geode::client::Log::logLevel())    \
+#define LOGCONFIG                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Config) \
   ::apache::geode::client::LogVarargs::config
 
 /************************ LOGFINE ***********************************/
 
-#define LOGFINE                                  \
-  if (::apache::geode::client::LogLevel::Fine <= \
-      ::apache::geode::client::Log::logLevel())  \
+#define LOGFINE                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Fine) \
   ::apache::geode::client::LogVarargs::fine
 
 /************************ LOGFINER ***********************************/
 
-#define LOGFINER                                  \
-  if (::apache::geode::client::LogLevel::Finer <= \
-      ::apache::geode::client::Log::logLevel())   \
+#define LOGFINER                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Finer) \
   ::apache::geode::client::LogVarargs::finer
 
 /************************ LOGFINEST ***********************************/
 
-#define LOGFINEST                                  \
-  if (::apache::geode::client::LogLevel::Finest <= \
-      ::apache::geode::client::Log::logLevel())    \
+#define LOGFINEST                                                 \
+  GEODE_LOG_IF_ENABLED(::apache::geode::client::LogLevel::Finest) \
   ::apache::geode::client::LogVarargs::finest
 
 /******************************************************************************/
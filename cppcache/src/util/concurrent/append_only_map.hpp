@@ -0,0 +1,242 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_APPEND_ONLY_MAP_H_
+#define GEODE_UTIL_CONCURRENT_APPEND_ONLY_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Hash map for read mostly data that is only ever added to, or cleared as a
+ * whole. Lookups take no lock and walk immutable nodes; inserts are
+ * serialized by a mutex and publish them.
+ *
+ * Growing copies the nodes into a table of twice the size, and clear()
+ * publishes an empty table. The replaced table is freed after a grace
+ * period, RCU style: a lookup counts itself in its thread's stripe of reader
+ * counts, under the parity of the current epoch, so lookups on different
+ * cores don't share a cache line. After publishing, the writer advances the
+ * epoch twice, each time waiting for the lookups counted under the previous
+ * parity. Lookups started later load the new table, so the writer never
+ * waits on them, and the old table is then unreachable.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class append_only_map final {
+ private:
+  struct node {
+    node(const Key &key, Value value, node *next)
+        : key(key), value(std::move(value)), next(next) {}
+
+    const Key key;
+    const Value value;
+    node *const next;
+  };
+
+  struct table {
+    explicit table(size_t size)
+        : buckets(new std::atomic<node *>[size]), mask(size - 1), count(0) {
+      for (size_t i = 0; i < size; i++) {
+        buckets[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    std::unique_ptr<std::atomic<node *>[]> buckets;
+    const size_t mask;
+    size_t count;
+    std::vector<std::unique_ptr<node>> nodes;
+  };
+
+  static constexpr size_t initial_size = 16;
+  static constexpr size_t cache_line_size = 64;
+  static constexpr size_t max_stripes = 64;
+
+  /** lookups in progress of a group of threads, by epoch parity */
+  struct stripe {
+    std::atomic<size_t> readers[2];
+  };
+
+  static constexpr size_t stripe_size =
+      (sizeof(stripe) + cache_line_size - 1) / cache_line_size *
+      cache_line_size;
+
+  Hash hash_;
+  std::atomic<table *> current_;
+  std::unique_ptr<table> owned_;
+  std::atomic<size_t> epoch_;
+  size_t stripe_mask_;
+  std::unique_ptr<uint8_t[]> stripe_memory_;
+  uint8_t *stripes_;
+  std::mutex write_mutex_;
+
+  static size_t stripe_count() {
+    auto threads = static_cast<size_t>(std::thread::hardware_concurrency());
+    size_t count = 1;
+    while (count < threads && count < max_stripes) {
+      count <<= 1;
+    }
+    return count;
+  }
+
+  /** @return the stripe of the calling thread, assigned round robin */
+  stripe &current_stripe() const {
+    static std::atomic<size_t> next_stripe(0);
+    static thread_local size_t thread_stripe = next_stripe++;
+    return *reinterpret_cast<stripe *>(
+        stripes_ + (thread_stripe & stripe_mask_) * stripe_size);
+  }
+
+  node *lookup(const table &t, const Key &key) const {
+    auto &bucket = t.buckets[hash_(key) & t.mask];
+    for (auto n = bucket.load(std::memory_order_acquire); n; n = n->next) {
+      if (n->key == key) {
+        return n;
+      }
+    }
+    return nullptr;
+  }
+
+  static void link(table &t, size_t bucket, const Key &key, Value value) {
+    auto &head = t.buckets[bucket];
+    t.nodes.emplace_back(new node(key, std::move(value),
+                                  head.load(std::memory_order_relaxed)));
+    head.store(t.nodes.back().get(), std::memory_order_release);
+    t.count++;
+  }
+
+  /** waits until no lookup can still see a table replaced before the call */
+  void synchronize() {
+    for (int phase = 0; phase < 2; phase++) {
+      auto parity = epoch_.fetch_add(1, std::memory_order_seq_cst) & 1;
+      for (size_t i = 0; i <= stripe_mask_; i++) {
+        auto &s = *reinterpret_cast<stripe *>(stripes_ + i * stripe_size);
+        while (s.readers[parity].load(std::memory_order_seq_cst) != 0) {
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+  table *publish(std::unique_ptr<table> t) {
+    auto published = t.get();
+    std::unique_ptr<table> replaced = std::move(owned_);
+    owned_ = std::move(t);
+    current_.store(published, std::memory_order_seq_cst);
+    if (replaced) {
+      synchronize();
+    }
+    return published;
+  }
+
+  table *grow(const table &old) {
+    std::unique_ptr<table> t(new table((old.mask + 1) * 2));
+    for (auto &&n : old.nodes) {
+      link(*t, hash_(n->key) & t->mask, n->key, n->value);
+    }
+    return publish(std::move(t));
+  }
+
+ public:
+  append_only_map()
+      : current_(nullptr),
+        epoch_(0),
+        stripe_mask_(stripe_count() - 1),
+        stripe_memory_(
+            new uint8_t[(stripe_mask_ + 1) * stripe_size + cache_line_size]),
+        stripes_(nullptr) {
+    auto address = reinterpret_cast<uintptr_t>(stripe_memory_.get());
+    stripes_ = reinterpret_cast<uint8_t *>(
+        (address + cache_line_size - 1) & ~(cache_line_size - 1));
+    for (size_t i = 0; i <= stripe_mask_; i++) {
+      auto s = new (stripes_ + i * stripe_size) stripe;
+      s->readers[0].store(0, std::memory_order_relaxed);
+      s->readers[1].store(0, std::memory_order_relaxed);
+    }
+    publish(std::unique_ptr<table>(new table(initial_size)));
+  }
+
+  append_only_map(const append_only_map &) = delete;
+  append_only_map &operator=(const append_only_map &) = delete;
+
+  /**
+   * Copies the value mapped to key into value.
+   * @return true if key is mapped.
+   */
+  bool find(const Key &key, Value &value) const {
+    auto &readers = current_stripe().readers;
+    auto parity = epoch_.load(std::memory_order_seq_cst) & 1;
+    readers[parity].fetch_add(1, std::memory_order_seq_cst);
+    auto n = lookup(*current_.load(std::memory_order_seq_cst), key);
+    if (n) {
+      value = n->value;
+    }
+    readers[parity].fetch_sub(1, std::memory_order_release);
+    return n != nullptr;
+  }
+
+  /**
+   * Maps key to value unless key is already mapped.
+   * @return true if value was added.
+   */
+  bool emplace(const Key &key, Value value) {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    auto t = current_.load(std::memory_order_relaxed);
+    if (lookup(*t, key)) {
+      return false;
+    }
+    if (t->count > t->mask) {
+      t = grow(*t);
+    }
+    link(*t, hash_(key) & t->mask, key, std::move(value));
+    return true;
+  }
+
+  /** Removes all mappings. */
+  void clear() {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    publish(std::unique_ptr<table>(new table(initial_size)));
+  }
+};
+
+template <class Key, class Value, class Hash>
+constexpr size_t append_only_map<Key, Value, Hash>::initial_size;
+template <class Key, class Value, class Hash>
+constexpr size_t append_only_map<Key, Value, Hash>::cache_line_size;
+template <class Key, class Value, class Hash>
+constexpr size_t append_only_map<Key, Value, Hash>::max_stripes;
+template <class Key, class Value, class Hash>
+constexpr size_t append_only_map<Key, Value, Hash>::stripe_size;
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_APPEND_ONLY_MAP_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_CONCURRENT_BOUNDED_MPSC_QUEUE_H_
+#define GEODE_UTIL_CONCURRENT_BOUNDED_MPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace apache {
+namespace geode {
+namespace util {
+namespace concurrent {
+
+/**
+ * Fixed capacity queue for any number of producers and a single consumer.
+ * Neither side takes a lock: a producer claims a slot with one compare and
+ * swap on the tail and publishes it through the sequence number of the
+ * slot, which the consumer waits on before taking the value out.
+ *
+ * The capacity is rounded up to a power of two.
+ */
+template <class T>
+class bounded_mpsc_queue final {
+ private:
+  struct slot {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static constexpr size_t cache_line_size = 64;
+
+  // Keeps the producers' tail and the consumer's head on separate cache
+  // lines.
+  template <class U>
+  struct padded {
+    explicit padded(size_t initial) : value(initial) {}
+
+    char padding[cache_line_size];
+    U value;
+  };
+
+  static size_t round_up(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+      size <<= 1;
+    }
+    return size;
+  }
+
+  const size_t mask_;
+  std::unique_ptr<slot[]> slots_;
+  padded<std::atomic<size_t>> tail_;
+  padded<size_t> head_;
+
+ public:
+  explicit bounded_mpsc_queue(size_t capacity)
+      : mask_(round_up(capacity) - 1),
+        slots_(new slot[mask_ + 1]),
+        tail_(0),
+        head_(0) {
+    for (size_t i = 0; i <= mask_; i++) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bounded_mpsc_queue(const bounded_mpsc_queue &) = delete;
+  bounded_mpsc_queue &operator=(const bounded_mpsc_queue &) = delete;
+
+  size_t capacity() const { return mask_ + 1; }
+
+  /**
+   * Adds value at the tail unless the queue is full. May be called from any
+   * thread.
+   * @return false, leaving value untouched, if the queue is full.
+   */
+  bool try_push(T &value) {
+    auto position = tail_.value.load(std::memory_order_relaxed);
+    for (;;) {
+      auto &s = slots_[position & mask_];
+      auto sequence = s.sequence.load(std::memory_order_acquire);
+      auto difference =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (tail_.value.compare_exchange_weak(position, position + 1,
+                                              std::memory_order_relaxed)) {
+          s.value = std::move(value);
+          s.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = tail_.value.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * Moves the value at the head into value. Must only be called from the
+   * consumer thread.
+   * @return false if the queue is empty, or the producer of the head has
+   * not finished publishing it yet.
+   */
+  bool try_pop(T &value) {
+    auto head = head_.value;
+    auto &s = slots_[head & mask_];
+    if (s.sequence.load(std::memory_order_acquire) != head + 1) {
+      return false;
+    }
+    value = std::move(s.value);
+    s.sequence.store(head + mask_ + 1, std::memory_order_release);
+    head_.value = head + 1;
+    return true;
+  }
+
+  /**
+   * @return true if try_pop would find nothing to pop. Must only be called
+   * from the consumer thread.
+   */
+  bool empty() const {
+    auto head = head_.value;
+    return slots_[head & mask_].sequence.load(std::memory_order_acquire) !=
+           head + 1;
+  }
+};
+
+template <class T>
+constexpr size_t bounded_mpsc_queue<T>::cache_line_size;
+
+} /* namespace concurrent */
+} /* namespace util */
+} /* namespace geode */
+} /* namespace apache */
+
+#endif /* GEODE_UTIL_CONCURRENT_BOUNDED_MPSC_QUEUE_H_ */
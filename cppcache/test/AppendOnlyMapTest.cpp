@@ -0,0 +1,210 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/append_only_map.hpp"
+
+namespace {
+
+using apache::geode::util::concurrent::append_only_map;
+
+// Counts its live instances, to check that replaced tables are freed.
+class Tracked {
+ public:
+  static std::atomic<int> live;
+
+  explicit Tracked(int32_t value = 0) : value(value) { live++; }
+  Tracked(const Tracked& other) : value(other.value) { live++; }
+  Tracked& operator=(const Tracked&) = default;
+  ~Tracked() { live--; }
+
+  int32_t value;
+};
+
+std::atomic<int> Tracked::live(0);
+
+TEST(AppendOnlyMapTest, findsWhatWasAdded) {
+  append_only_map<std::string, int> map;
+  int value = 0;
+  EXPECT_FALSE(map.find("a", value));
+
+  EXPECT_TRUE(map.emplace("a", 1));
+  EXPECT_TRUE(map.emplace("b", 2));
+
+  ASSERT_TRUE(map.find("a", value));
+  EXPECT_EQ(1, value);
+  ASSERT_TRUE(map.find("b", value));
+  EXPECT_EQ(2, value);
+  EXPECT_FALSE(map.find("c", value));
+}
+
+TEST(AppendOnlyMapTest, keepsFirstValueOfKey) {
+  append_only_map<int32_t, int> map;
+  EXPECT_TRUE(map.emplace(7, 1));
+  EXPECT_FALSE(map.emplace(7, 2));
+  int value = 0;
+  ASSERT_TRUE(map.find(7, value));
+  EXPECT_EQ(1, value);
+}
+
+TEST(AppendOnlyMapTest, growsPastInitialSize) {
+  append_only_map<int32_t, int32_t> map;
+  for (int32_t i = 0; i < 1000; i++) {
+    EXPECT_TRUE(map.emplace(i, i * 2));
+  }
+  for (int32_t i = 0; i < 1000; i++) {
+    int32_t value = -1;
+    ASSERT_TRUE(map.find(i, value));
+    EXPECT_EQ(i * 2, value);
+  }
+}
+
+TEST(AppendOnlyMapTest, clearRemovesMappings) {
+  append_only_map<int32_t, std::string> map;
+  map.emplace(1, "one");
+
+  map.clear();
+
+  std::string value;
+  EXPECT_FALSE(map.find(1, value));
+  EXPECT_TRUE(map.emplace(1, "uno"));
+  ASSERT_TRUE(map.find(1, value));
+  EXPECT_EQ("uno", value);
+}
+
+TEST(AppendOnlyMapTest, freesReplacedTables) {
+  {
+    append_only_map<int32_t, Tracked> map;
+    for (int round = 0; round < 100; round++) {
+      for (int32_t i = 0; i < 100; i++) {
+        map.emplace(i, Tracked(i));
+      }
+      map.clear();
+      EXPECT_EQ(0, Tracked::live.load());
+    }
+
+    for (int32_t i = 0; i < 100; i++) {
+      map.emplace(i, Tracked(i));
+    }
+    EXPECT_EQ(100, Tracked::live.load());
+  }
+  EXPECT_EQ(0, Tracked::live.load());
+}
+
+TEST(AppendOnlyMapTest, freesReplacedTablesDuringConcurrentLookups) {
+  {
+    append_only_map<int32_t, Tracked> map;
+    std::atomic<bool> done(false);
+    const int readerCount = 4;
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; r++) {
+      readers.emplace_back([&]() {
+        while (!done.load()) {
+          Tracked value;
+          map.find(1, value);
+        }
+      });
+    }
+
+    for (int round = 0; round < 200; round++) {
+      for (int32_t i = 0; i < 100; i++) {
+        map.emplace(i, Tracked(i));
+      }
+      map.clear();
+      // only the values the readers hold remain
+      EXPECT_LE(Tracked::live.load(), readerCount);
+    }
+    done = true;
+    for (auto&& reader : readers) {
+      reader.join();
+    }
+  }
+  EXPECT_EQ(0, Tracked::live.load());
+}
+
+TEST(AppendOnlyMapTest, readersSeeConcurrentInserts) {
+  append_only_map<int32_t, int32_t> map;
+  std::atomic<int32_t> inserted(0);
+  std::atomic<bool> mismatch(false);
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; r++) {
+    readers.emplace_back([&]() {
+      while (inserted.load() < 5000) {
+        auto last = inserted.load() - 1;
+        if (last >= 0) {
+          int32_t value = -1;
+          if (!map.find(last, value) || value != last) {
+            mismatch = true;
+          }
+        }
+      }
+    });
+  }
+
+  for (int32_t i = 0; i < 5000; i++) {
+    map.emplace(i, i);
+    inserted = i + 1;
+  }
+  for (auto&& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_FALSE(mismatch);
+}
+
+TEST(AppendOnlyMapTest, readersSeeValuesAcrossConcurrentClears) {
+  append_only_map<int32_t, std::string> map;
+  std::atomic<bool> done(false);
+  std::atomic<bool> mismatch(false);
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; r++) {
+    readers.emplace_back([&]() {
+      while (!done.load()) {
+        for (int32_t i = 0; i < 64; i++) {
+          std::string value;
+          if (map.find(i, value) && value != std::to_string(i)) {
+            mismatch = true;
+          }
+        }
+      }
+    });
+  }
+
+  for (int round = 0; round < 500; round++) {
+    for (int32_t i = 0; i < 64; i++) {
+      map.emplace(i, std::to_string(i));
+    }
+    map.clear();
+  }
+  done = true;
+  for (auto&& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_FALSE(mismatch);
+}
+
+}  // namespace
@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "util/concurrent/bounded_mpsc_queue.hpp"
+
+namespace {
+
+using apache::geode::util::concurrent::bounded_mpsc_queue;
+
+TEST(BoundedMpscQueueTest, popsInPushOrder) {
+  bounded_mpsc_queue<std::string> queue(4);
+  EXPECT_TRUE(queue.empty());
+
+  std::string a = "a";
+  std::string b = "b";
+  EXPECT_TRUE(queue.try_push(a));
+  EXPECT_TRUE(queue.try_push(b));
+  EXPECT_FALSE(queue.empty());
+
+  std::string value;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ("a", value);
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ("b", value);
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(BoundedMpscQueueTest, rejectsPushWhenFull) {
+  bounded_mpsc_queue<int> queue(3);
+  ASSERT_EQ(4u, queue.capacity());
+
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(queue.try_push(i));
+  }
+  int value = 4;
+  EXPECT_FALSE(queue.try_push(value));
+  EXPECT_EQ(4, value);
+
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(0, value);
+  value = 4;
+  EXPECT_TRUE(queue.try_push(value));
+}
+
+TEST(BoundedMpscQueueTest, deliversEveryValueOfConcurrentProducers) {
+  const int producers = 4;
+  const int valuesPerProducer = 20000;
+  bounded_mpsc_queue<int> queue(64);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([&queue, p]() {
+      for (int i = 0; i < valuesPerProducer; i++) {
+        int value = p * valuesPerProducer + i;
+        while (!queue.try_push(value)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<int> last(producers, -1);
+  int popped = 0;
+  while (popped < producers * valuesPerProducer) {
+    int value;
+    if (!queue.try_pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    auto producer = value / valuesPerProducer;
+    EXPECT_LT(last[producer], value);
+    last[producer] = value;
+    popped++;
+  }
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+}  // namespace
@@ -0,0 +1,106 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ColumnarResultsImpl.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableInt64;
+using apache::geode::client::CacheableString;
+using apache::geode::client::ColumnarResultsImpl;
+using apache::geode::client::ColumnType;
+using apache::geode::client::IllegalStateException;
+
+TEST(ColumnarResultsTest, valuesAreSplitIntoColumns) {
+  ColumnarResultsImpl results({"id", "price", "name"});
+  results.appendInt64(1);
+  results.appendDouble(1.5);
+  results.appendString("one");
+  results.appendInt64(2);
+  results.appendDouble(2.5);
+  results.appendString("two");
+
+  EXPECT_TRUE(results.isComplete());
+  EXPECT_EQ(2, results.size());
+  EXPECT_EQ(3, results.getColumnCount());
+  EXPECT_EQ(2, results.getFieldIndex("name"));
+  EXPECT_THROW(results.getFieldIndex("other"), std::invalid_argument);
+
+  EXPECT_EQ(ColumnType::INT64, results.getColumnType(0));
+  EXPECT_EQ(ColumnType::DOUBLE, results.getColumnType(1));
+  EXPECT_EQ(ColumnType::STRING, results.getColumnType(2));
+  EXPECT_EQ(std::vector<int64_t>({1, 2}), results.getInt64Column(0));
+  EXPECT_EQ(std::vector<double>({1.5, 2.5}), results.getDoubleColumn(1));
+  EXPECT_EQ(std::vector<std::string>({"one", "two"}),
+            results.getStringColumn(2));
+  EXPECT_THROW(results.getDoubleColumn(0), IllegalStateException);
+  EXPECT_THROW(results.getColumnType(3), std::out_of_range);
+}
+
+TEST(ColumnarResultsTest, boxedValuesAreUnboxed) {
+  ColumnarResultsImpl results({});
+  results.appendObject(CacheableInt32::create(7));
+  results.appendObject(nullptr);
+
+  EXPECT_EQ(1, results.getColumnCount());
+  EXPECT_EQ(2, results.size());
+  EXPECT_EQ(ColumnType::INT64, results.getColumnType(0));
+  EXPECT_EQ(std::vector<int64_t>({7, 0}), results.getInt64Column(0));
+  EXPECT_FALSE(results.isNull(0, 0));
+  EXPECT_TRUE(results.isNull(1, 0));
+}
+
+TEST(ColumnarResultsTest, leadingNullsTakeTypeOfFirstValue) {
+  ColumnarResultsImpl results({"name"});
+  results.appendNull();
+  results.appendNull();
+  results.appendString("three");
+
+  EXPECT_EQ(ColumnType::STRING, results.getColumnType(0));
+  EXPECT_EQ(std::vector<std::string>({"", "", "three"}),
+            results.getStringColumn(0));
+  EXPECT_TRUE(results.isNull(1, 0));
+  EXPECT_FALSE(results.isNull(2, 0));
+}
+
+TEST(ColumnarResultsTest, mixedTypesAreBoxedIntoObjectColumn) {
+  ColumnarResultsImpl results({"value"});
+  results.appendInt64(1);
+  results.appendNull();
+  results.appendString("three");
+
+  EXPECT_EQ(ColumnType::OBJECT, results.getColumnType(0));
+  const auto& objects = results.getObjectColumn(0);
+  ASSERT_EQ(3, objects.size());
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt64>(objects[0])->value());
+  EXPECT_EQ(nullptr, objects[1]);
+  EXPECT_EQ("three",
+            std::dynamic_pointer_cast<CacheableString>(objects[2])->value());
+  EXPECT_TRUE(results.isNull(1, 0));
+}
+
+TEST(ColumnarResultsTest, partialRowIsIncomplete) {
+  ColumnarResultsImpl results({"a", "b"});
+  results.appendInt64(1);
+  EXPECT_FALSE(results.isComplete());
+  EXPECT_EQ(0, results.size());
+}
@@ -0,0 +1,150 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <DeadlineExecution.hpp>
+
+#include <gtest/gtest.h>
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::DeadlineExecution;
+using apache::geode::client::ServerFunctionExecution;
+using apache::geode::client::ServerResultBuffer;
+
+namespace {
+
+class FakeServerExecution : public ServerFunctionExecution {
+ public:
+  FakeServerExecution(std::string server, GfErrType err, std::string failure,
+                      std::shared_ptr<ServerResultBuffer> buffer)
+      : server_(std::move(server)),
+        err_(err),
+        failure_(std::move(failure)),
+        buffer_(std::move(buffer)),
+        executed_(false) {}
+
+  std::string getServer() override { return server_; }
+
+  std::string getFailure(GfErrType) override { return failure_; }
+
+  bool wasExecuted() const { return executed_; }
+
+ protected:
+  GfErrType execute(void) override {
+    executed_ = true;
+    buffer_->addResult(CacheableInt32::create(1));
+    buffer_->addResult(CacheableInt32::create(2));
+    return err_;
+  }
+
+ private:
+  std::string server_;
+  GfErrType err_;
+  std::string failure_;
+  std::shared_ptr<ServerResultBuffer> buffer_;
+  bool executed_;
+};
+
+std::shared_ptr<FakeServerExecution> addServer(DeadlineExecution& execution,
+                                               std::string server,
+                                               GfErrType err = GF_NOERR,
+                                               std::string failure = "") {
+  auto buffer = execution.createBuffer();
+  auto server_execution = std::make_shared<FakeServerExecution>(
+      std::move(server), err, std::move(failure), buffer);
+  execution.add(server_execution, buffer);
+  return server_execution;
+}
+
+}  // namespace
+
+TEST(DeadlineExecutionTest, resultsOfCompletedServersAreCollected) {
+  auto rc = std::make_shared<ServerResultBuffer>(false);
+  DeadlineExecution execution(std::chrono::seconds(10), rc);
+  addServer(execution, "a:1")->call();
+  addServer(execution, "b:2")->call();
+
+  auto result = execution.await();
+
+  EXPECT_TRUE(result.isComplete());
+  EXPECT_EQ(rc, result.getCollector());
+  EXPECT_EQ(4, rc->getResult()->size());
+}
+
+TEST(DeadlineExecutionTest, pendingServerIsReportedAsTimedOut) {
+  auto rc = std::make_shared<ServerResultBuffer>(false);
+  DeadlineExecution execution(std::chrono::milliseconds(10), rc);
+  addServer(execution, "a:1")->call();
+  auto pending = addServer(execution, "b:2");
+  std::weak_ptr<FakeServerExecution> pendingRef = pending;
+  auto raw = pending.get();
+  pending = nullptr;
+
+  auto result = execution.await();
+
+  EXPECT_FALSE(result.isComplete());
+  ASSERT_EQ(1, result.getTimedOutServers().size());
+  EXPECT_EQ("b:2", result.getTimedOutServers()[0]);
+  EXPECT_TRUE(result.getFailedServers().empty());
+  EXPECT_EQ(2, rc->getResult()->size());
+
+  // the abandoned execution is kept alive until the thread pool calls it, and
+  // is not executed anymore
+  ASSERT_FALSE(pendingRef.expired());
+  EXPECT_FALSE(pendingRef.lock()->wasExecuted());
+  raw->call();
+  EXPECT_TRUE(pendingRef.expired());
+  EXPECT_EQ(2, rc->getResult()->size());
+}
+
+TEST(DeadlineExecutionTest, failedServerIsReportedWithoutResults) {
+  auto rc = std::make_shared<ServerResultBuffer>(false);
+  DeadlineExecution execution(std::chrono::seconds(10), rc);
+  addServer(execution, "a:1")->call();
+  addServer(execution, "b:2", GF_CACHESERVER_EXCEPTION, "boom")->call();
+
+  auto result = execution.await();
+
+  EXPECT_FALSE(result.isComplete());
+  EXPECT_TRUE(result.getTimedOutServers().empty());
+  ASSERT_EQ(1, result.getFailedServers().size());
+  EXPECT_EQ("boom", result.getFailedServers().at("b:2"));
+  EXPECT_EQ(2, rc->getResult()->size());
+}
+
+TEST(DeadlineExecutionTest, requestTimeoutIsReportedAsTimedOut) {
+  auto rc = std::make_shared<ServerResultBuffer>(false);
+  DeadlineExecution execution(std::chrono::seconds(10), rc);
+  addServer(execution, "a:1", GF_TIMOUT, "timed out")->call();
+
+  auto result = execution.await();
+
+  ASSERT_EQ(1, result.getTimedOutServers().size());
+  EXPECT_TRUE(result.getFailedServers().empty());
+  EXPECT_EQ(0, rc->getResult()->size());
+}
+
+TEST(DeadlineExecutionTest, remainingTimeIsAtLeastOneMillisecond) {
+  DeadlineExecution execution(std::chrono::milliseconds(0), nullptr);
+  EXPECT_EQ(std::chrono::milliseconds(1), execution.getRemaining());
+  EXPECT_FALSE(execution.createBuffer()->isSerializedResults());
+}
+
+TEST(DeadlineExecutionTest, describeNamesTheException) {
+  EXPECT_EQ("", DeadlineExecution::describe(GF_NOERR));
+  EXPECT_NE(std::string::npos,
+            DeadlineExecution::describe(GF_NOTCON).find("Exception"));
+}
@@ -0,0 +1,168 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "statistics/OpenMetricsExporter.hpp"
+#include "statistics/StatisticDescriptorImpl.hpp"
+#include "statistics/StatisticHistogram.hpp"
+#include "statistics/StatisticsTypeImpl.hpp"
+
+namespace {
+
+using apache::geode::statistics::OpenMetricsExporter;
+using apache::geode::statistics::StatisticDescriptor;
+using apache::geode::statistics::StatisticDescriptorImpl;
+using apache::geode::statistics::StatisticHistogram;
+using apache::geode::statistics::StatisticsTypeImpl;
+
+int64_t toRawBits(double value) {
+  int64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+class OpenMetricsExporterTest : public ::testing::Test {
+ protected:
+  OpenMetricsExporterTest()
+      : descriptors_{StatisticDescriptorImpl::createIntCounter(
+                         "puts", "Number of puts.", "operations", true),
+                     StatisticDescriptorImpl::createLongGauge(
+                         "entries", "Number of \"entries\".", "entries", true),
+                     StatisticDescriptorImpl::createDoubleGauge(
+                         "load", "Current load.", "load", false)},
+        type_("Region-Stats", "Region statistics.", descriptors_, 3) {}
+
+  StatisticDescriptor* descriptors_[3];
+  StatisticsTypeImpl type_;
+};
+
+TEST_F(OpenMetricsExporterTest, formatsEmptySnapshotsAsEof) {
+  std::vector<OpenMetricsExporter::InstanceSnapshot> snapshots;
+  EXPECT_EQ("# EOF\n", OpenMetricsExporter::format(snapshots));
+}
+
+TEST_F(OpenMetricsExporterTest, formatsOneFamilyPerDescriptor) {
+  std::vector<OpenMetricsExporter::InstanceSnapshot> snapshots{
+      {&type_, "/b", 2, {3, 40, toRawBits(0.5)}},
+      {&type_, "/a", 1, {7, 0, toRawBits(2)}}};
+
+  EXPECT_EQ(
+      "# TYPE geode_Region_Stats_puts counter\n"
+      "# HELP geode_Region_Stats_puts Number of puts.\n"
+      "geode_Region_Stats_puts_total{name=\"/a\",id=\"1\"} 7\n"
+      "geode_Region_Stats_puts_total{name=\"/b\",id=\"2\"} 3\n"
+      "# TYPE geode_Region_Stats_entries gauge\n"
+      "# HELP geode_Region_Stats_entries Number of \\\"entries\\\".\n"
+      "geode_Region_Stats_entries{name=\"/a\",id=\"1\"} 0\n"
+      "geode_Region_Stats_entries{name=\"/b\",id=\"2\"} 40\n"
+      "# TYPE geode_Region_Stats_load gauge\n"
+      "# HELP geode_Region_Stats_load Current load.\n"
+      "geode_Region_Stats_load{name=\"/a\",id=\"1\"} 2\n"
+      "geode_Region_Stats_load{name=\"/b\",id=\"2\"} 0.5\n"
+      "# EOF\n",
+      OpenMetricsExporter::format(snapshots));
+}
+
+TEST_F(OpenMetricsExporterTest, formatsNonFiniteDoubles) {
+  std::vector<OpenMetricsExporter::InstanceSnapshot> snapshots{
+      {&type_,
+       "x",
+       1,
+       {0, 0, toRawBits(std::numeric_limits<double>::infinity())}},
+      {&type_,
+       "y",
+       2,
+       {0, 0, toRawBits(-std::numeric_limits<double>::infinity())}},
+      {&type_,
+       "z",
+       3,
+       {0, 0, toRawBits(std::numeric_limits<double>::quiet_NaN())}}};
+
+  auto out = OpenMetricsExporter::format(snapshots);
+  EXPECT_NE(std::string::npos,
+            out.find("geode_Region_Stats_load{name=\"x\",id=\"1\"} +Inf\n"));
+  EXPECT_NE(std::string::npos,
+            out.find("geode_Region_Stats_load{name=\"y\",id=\"2\"} -Inf\n"));
+  EXPECT_NE(std::string::npos,
+            out.find("geode_Region_Stats_load{name=\"z\",id=\"3\"} NaN\n"));
+}
+
+TEST_F(OpenMetricsExporterTest, formatsHistogramWithCumulativeBuckets) {
+  // named as StatisticHistogram::createDescriptors names them
+  const auto bucketCount = StatisticHistogram::BucketCount;
+  std::vector<StatisticDescriptor*> descriptors;
+  for (int32_t bucket = 0; bucket < bucketCount - 1; bucket++) {
+    auto bound =
+        std::to_string(StatisticHistogram::getBucketUpperBound(bucket));
+    descriptors.push_back(StatisticDescriptorImpl::createLongCounter(
+        "opLatency_lt_" + bound + "ns",
+        "Operations that took less than " + bound + " nanoseconds",
+        "operations", false));
+  }
+  descriptors.push_back(StatisticDescriptorImpl::createLongCounter(
+      "opLatency_ge_" +
+          std::to_string(
+              StatisticHistogram::getBucketUpperBound(bucketCount - 2)) +
+          "ns",
+      "Operations that took longer", "operations", false));
+  descriptors.push_back(StatisticDescriptorImpl::createIntGauge(
+      "connections", "Current connections.", "connections", false));
+  StatisticsTypeImpl type("Pool-Stats", "Pool statistics.", descriptors.data(),
+                          static_cast<int32_t>(descriptors.size()));
+
+  std::vector<int64_t> values(descriptors.size(), 0);
+  values[StatisticHistogram::getBucket(100)] = 2;
+  values[StatisticHistogram::getBucket(3000)] = 3;
+  values[bucketCount - 1] = 1;
+  values[bucketCount] = 4;
+  std::vector<OpenMetricsExporter::InstanceSnapshot> snapshots{
+      {&type, "pool", 1, values}};
+
+  auto out = OpenMetricsExporter::format(snapshots);
+
+  EXPECT_EQ(
+      0u,
+      out.find("# TYPE geode_Pool_Stats_opLatency_seconds histogram\n"
+               "# UNIT geode_Pool_Stats_opLatency_seconds seconds\n"
+               "# HELP geode_Pool_Stats_opLatency_seconds Operations\n"
+               "geode_Pool_Stats_opLatency_seconds_bucket{name=\"pool\","
+               "id=\"1\",le=\"2.048e-06\"} 2\n"
+               "geode_Pool_Stats_opLatency_seconds_bucket{name=\"pool\","
+               "id=\"1\",le=\"2.56e-06\"} 2\n"
+               "geode_Pool_Stats_opLatency_seconds_bucket{name=\"pool\","
+               "id=\"1\",le=\"3.072e-06\"} 5\n"));
+  EXPECT_NE(std::string::npos,
+            out.find("geode_Pool_Stats_opLatency_seconds_bucket{name=\"pool\","
+                     "id=\"1\",le=\"137.438953472\"} 5\n"
+                     "geode_Pool_Stats_opLatency_seconds_bucket{name=\"pool\","
+                     "id=\"1\",le=\"274.877906944\"} 5\n"
+                     "geode_Pool_Stats_opLatency_seconds_bucket{name=\"pool\","
+                     "id=\"1\",le=\"+Inf\"} 6\n"
+                     "geode_Pool_Stats_opLatency_seconds_count{name=\"pool\","
+                     "id=\"1\"} 6\n"
+                     "# TYPE geode_Pool_Stats_connections gauge\n"));
+  EXPECT_EQ(std::string::npos, out.find("_lt_"));
+}
+
+}  // namespace
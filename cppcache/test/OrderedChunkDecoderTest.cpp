@@ -0,0 +1,159 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include <OrderedChunkDecoder.hpp>
+
+#include <gtest/gtest.h>
+
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::OrderedChunkDecoder;
+using apache::geode::client::PooledWork;
+using apache::geode::client::ThreadPool;
+
+namespace {
+
+/**
+ * The decode of a chunk that blocks until the test releases it, so that
+ * tests control when chunks finish decoding instead of relying on timing.
+ */
+class GatedChunk {
+ public:
+  GatedChunk(std::vector<int>& applied, int chunk)
+      : m_applied(applied), m_chunk(chunk) {}
+
+  OrderedChunkDecoder::Decode decode() {
+    auto& applied = m_applied;
+    auto chunk = m_chunk;
+    auto released = m_released.get_future().share();
+    auto decoded = std::make_shared<std::promise<void>>();
+    m_decoded = decoded->get_future();
+    return [&applied, chunk, released, decoded]() {
+      released.wait();
+      decoded->set_value();
+      return [&applied, chunk]() { applied.push_back(chunk); };
+    };
+  }
+
+  void release() { m_released.set_value(); }
+
+  /** waits until the decode function returned */
+  void waitDecoded() { m_decoded.wait(); }
+
+ private:
+  std::vector<int>& m_applied;
+  int m_chunk;
+  std::promise<void> m_released;
+  std::future<void> m_decoded;
+};
+
+OrderedChunkDecoder::Decode decodeChunk(std::vector<int>& applied,
+                                        int chunk) {
+  return [&applied, chunk]() {
+    return [&applied, chunk]() { applied.push_back(chunk); };
+  };
+}
+
+class NoopWork : public PooledWork<bool> {
+ protected:
+  bool execute(void) override { return true; }
+};
+
+/** waits until the works queued earlier on a single threaded pool are done */
+void waitForQueuedWork(ThreadPool& pool) {
+  NoopWork work;
+  pool.perform(&work);
+  work.getResult();
+}
+
+}  // namespace
+
+TEST(OrderedChunkDecoderTest, chunksAreAppliedInSubmitOrder) {
+  ThreadPool pool(8);
+  std::vector<int> applied;
+  std::vector<std::unique_ptr<GatedChunk>> chunks;
+  {
+    OrderedChunkDecoder decoder(pool);
+    for (int chunk = 0; chunk < 8; chunk++) {
+      chunks.emplace_back(new GatedChunk(applied, chunk));
+      decoder.submit(chunks.back()->decode());
+    }
+    // the last chunks finish decoding first
+    for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) {
+      (*chunk)->release();
+      (*chunk)->waitDecoded();
+    }
+    decoder.drain();
+  }
+
+  EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), applied);
+}
+
+TEST(OrderedChunkDecoderTest, decodedChunksAreAppliedOnSubmit) {
+  ThreadPool pool(1);
+  std::vector<int> applied;
+  OrderedChunkDecoder decoder(pool);
+  decoder.submit(decodeChunk(applied, 0));
+  waitForQueuedWork(pool);
+
+  GatedChunk chunk1(applied, 1);
+  decoder.submit(chunk1.decode());
+
+  EXPECT_EQ(std::vector<int>{0}, applied);
+  chunk1.release();
+  decoder.drain();
+  EXPECT_EQ((std::vector<int>{0, 1}), applied);
+}
+
+TEST(OrderedChunkDecoderTest, drainThrowsDecodeErrorAndDropsLaterChunks) {
+  ThreadPool pool(2);
+  std::vector<int> applied;
+  OrderedChunkDecoder decoder(pool);
+  // nothing is applied on submit while the first chunk is not decoded
+  GatedChunk chunk0(applied, 0);
+  decoder.submit(chunk0.decode());
+  decoder.submit([]() -> OrderedChunkDecoder::Apply {
+    throw IllegalStateException("bad chunk");
+  });
+  decoder.submit(decodeChunk(applied, 2));
+  chunk0.release();
+
+  EXPECT_THROW(decoder.drain(), IllegalStateException);
+  EXPECT_EQ(std::vector<int>{0}, applied);
+  decoder.drain();
+  EXPECT_EQ(std::vector<int>{0}, applied);
+}
+
+TEST(OrderedChunkDecoderTest, discardDoesNotApplyChunks) {
+  ThreadPool pool(2);
+  std::vector<int> applied;
+  OrderedChunkDecoder decoder(pool);
+  GatedChunk chunk0(applied, 0);
+  decoder.submit(chunk0.decode());
+  decoder.submit(decodeChunk(applied, 1));
+  chunk0.release();
+
+  decoder.discard();
+  decoder.drain();
+
+  EXPECT_TRUE(applied.empty());
+}
@@ -0,0 +1,117 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ParallelQueryResultCollector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/UserFunctionExecutionException.hpp>
+
+using apache::geode::client::CacheableArrayList;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::FunctionExecutionException;
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::ParallelQueryResultCollector;
+using apache::geode::client::QueryException;
+using apache::geode::client::UnsupportedOperationException;
+using apache::geode::client::UserFunctionExecutionException;
+
+TEST(ParallelQueryResultCollectorTest, listsAreFlattenedIntoRows) {
+  ParallelQueryResultCollector collector;
+  auto list = CacheableArrayList::create();
+  list->push_back(CacheableInt32::create(1));
+  list->push_back(CacheableInt32::create(2));
+  collector.addResult(list);
+  collector.addResult(CacheableInt32::create(3));
+  collector.endResults();
+
+  auto rows = collector.getResult(std::chrono::milliseconds(0));
+  ASSERT_EQ(3, rows->size());
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>((*rows)[1])->value());
+  EXPECT_EQ(3, std::dynamic_pointer_cast<CacheableInt32>((*rows)[2])->value());
+}
+
+TEST(ParallelQueryResultCollectorTest, clearResultsDiscardsRows) {
+  ParallelQueryResultCollector collector;
+  collector.addResult(CacheableString::create("a"));
+  collector.clearResults();
+  collector.addResult(CacheableString::create("b"));
+  collector.endResults();
+
+  auto rows = collector.getResult(std::chrono::milliseconds(0));
+  ASSERT_EQ(1, rows->size());
+  EXPECT_EQ("b",
+            std::dynamic_pointer_cast<CacheableString>((*rows)[0])->value());
+}
+
+TEST(ParallelQueryResultCollectorTest, functionExceptionIsThrown) {
+  ParallelQueryResultCollector collector;
+  collector.addResult(std::make_shared<UserFunctionExecutionException>(
+      "query failed"));
+  collector.endResults();
+
+  EXPECT_THROW(collector.getResult(std::chrono::milliseconds(0)),
+               QueryException);
+}
+
+TEST(ParallelQueryResultCollectorTest, incompleteResultsTimeOut) {
+  ParallelQueryResultCollector collector;
+  EXPECT_THROW(collector.getResult(std::chrono::milliseconds(1)),
+               FunctionExecutionException);
+}
+
+TEST(ParallelQueryResultCollectorTest, checkQueryAcceptsFiltersOnRegion) {
+  EXPECT_NO_THROW(ParallelQueryResultCollector::checkQuery(
+      "SELECT * FROM /orders o WHERE o.id > $1", "/orders"));
+  EXPECT_NO_THROW(ParallelQueryResultCollector::checkQuery(
+      "select o.id from /root/orders.values o, o.lines l "
+      "where l.note = 'order by limit'",
+      "/root/orders"));
+  EXPECT_NO_THROW(ParallelQueryResultCollector::checkQuery(
+      "SELECT * FROM o IN /orders WHERE o.total / 2 > 1", "/orders"));
+}
+
+TEST(ParallelQueryResultCollectorTest, checkQueryRejectsMergingClauses) {
+  for (auto query : {"SELECT DISTINCT * FROM /orders",
+                     "SELECT * FROM /orders o ORDER BY o.id",
+                     "SELECT * FROM /orders LIMIT 10",
+                     "SELECT o.status FROM /orders o GROUP BY o.status",
+                     "SELECT COUNT(*) FROM /orders",
+                     "select max(o.id) from /orders o",
+                     "SELECT * FROM /orders o WHERE o.id IN "
+                     "(SELECT MIN(p.id) FROM /orders p)"}) {
+    EXPECT_THROW(ParallelQueryResultCollector::checkQuery(query, "/orders"),
+                 UnsupportedOperationException)
+        << query;
+  }
+}
+
+TEST(ParallelQueryResultCollectorTest, checkQueryRejectsOtherRegions) {
+  for (auto query : {"SELECT * FROM /customers",
+                     "SELECT * FROM /orders-archive",
+                     "SELECT * FROM /orders o, /customers c",
+                     "SELECT * FROM o IN /root/orders",
+                     "SELECT * FROM /orders o WHERE o.id IN "
+                     "(SELECT c.id FROM /customers c)"}) {
+    EXPECT_THROW(ParallelQueryResultCollector::checkQuery(query, "/orders"),
+                 IllegalArgumentException)
+        << query;
+  }
+}
@@ -0,0 +1,189 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxReader.hpp>
+#include <geode/PdxSerializable.hpp>
+#include <geode/PdxWriter.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxHelper.hpp"
+#include "PdxInstanceImpl.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::PdxHelper;
+using apache::geode::client::PdxInstanceImpl;
+using apache::geode::client::PdxReader;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxWriter;
+using apache::geode::client::PdxWriterWithTypeCollector;
+using apache::geode::client::Serializable;
+
+class Item : public PdxSerializable {
+ public:
+  Item() = default;
+
+  Item(int32_t id, std::string text, std::string tail, std::string note)
+      : m_id(id),
+        m_text(std::move(text)),
+        m_tail(std::move(tail)),
+        m_note(std::move(note)) {}
+
+  void toData(PdxWriter& writer) const override {
+    writer.writeInt("id", m_id);
+    writer.writeString("text", m_text);
+    writer.writeString("tail", m_tail);
+    writer.writeString("note", m_note);
+  }
+
+  void fromData(PdxReader& reader) override {
+    m_id = reader.readInt("id");
+    m_text = reader.readString("text");
+    m_tail = reader.readString("tail");
+    m_note = reader.readString("note");
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "Item";
+    return className;
+  }
+
+ private:
+  int32_t m_id = 0;
+  std::string m_text;
+  std::string m_tail;
+  std::string m_note;
+};
+
+class PdxInstanceImplTest : public ::testing::Test {
+ protected:
+  const int32_t typeId = 1;
+
+  PdxInstanceImplTest()
+      : cache_(CacheFactory().set("log-level", "none").create()) {
+    // register the type as a server would assign it
+    Item item;
+    auto registry =
+        CacheRegionHelper::getCacheImpl(&cache_)->getPdxTypeRegistry();
+    auto output = cache_.createDataOutput();
+    PdxWriterWithTypeCollector writer(output, item.getClassName(), registry);
+    item.toData(writer);
+    auto type = writer.getPdxLocalType();
+    type->InitializeType();
+    type->setTypeId(typeId);
+    registry->addLocalPdxType(item.getClassName(), type);
+    registry->addPdxType(typeId, type);
+  }
+
+  ~PdxInstanceImplTest() noexcept override { cache_.close(); }
+
+  std::vector<uint8_t> serialize(const std::shared_ptr<Serializable>& value) {
+    auto output = cache_.createDataOutput();
+    output.writeObject(value);
+    return std::vector<uint8_t>(output.getBuffer(),
+                                output.getBuffer() + output.getBufferLength());
+  }
+
+  // An instance read from the serialized stream of item.
+  std::shared_ptr<PdxInstanceImpl> createInstance(
+      const std::shared_ptr<Item>& item) {
+    auto bytes = serialize(item);
+    // DSCode, length and type id precede the stream
+    auto length = PdxHelper::readInt32(bytes.data() + 1);
+    EXPECT_EQ(typeId, PdxHelper::readInt32(bytes.data() + 5));
+    auto cacheImpl = CacheRegionHelper::getCacheImpl(&cache_);
+    return std::make_shared<PdxInstanceImpl>(
+        bytes.data() + 9, length, typeId, cacheImpl->getCachePerfStats(),
+        *cacheImpl->getPdxTypeRegistry(), *cacheImpl, false);
+  }
+
+  // Patches text into an instance holding from and expects the stream of an
+  // instance written with text from the start.
+  void expectPatchedStream(const std::string& from, const std::string& text) {
+    auto writer =
+        createInstance(std::make_shared<Item>(7, from, "tail", "note"))
+            ->createWriter();
+    writer->setField("text", text);
+    EXPECT_EQ(serialize(std::make_shared<Item>(7, text, "tail", "note")),
+              serialize(writer))
+        << from.length() << " to " << text.length() << " characters";
+    EXPECT_EQ(text, writer->getStringField("text"));
+    EXPECT_EQ("note", writer->getStringField("note"));
+  }
+
+  Cache cache_;
+};
+
+TEST_F(PdxInstanceImplTest, overwritesValueOfSameSize) {
+  expectPatchedStream("abc", "xyz");
+}
+
+TEST_F(PdxInstanceImplTest, splicesValueOfOtherSize) {
+  expectPatchedStream("abc", "abcdef");
+  expectPatchedStream("abcdef", "");
+}
+
+TEST_F(PdxInstanceImplTest, rebuildsOffsetsAcrossOneByteBoundary) {
+  // the fields fill 0xff bytes somewhere in this range
+  for (size_t length = 220; length < 260; length++) {
+    expectPatchedStream("a", std::string(length, 'x'));
+    expectPatchedStream(std::string(length, 'x'), "a");
+  }
+}
+
+TEST_F(PdxInstanceImplTest, rebuildsOffsetsAcrossTwoByteBoundary) {
+  // the fields fill 0xffff bytes somewhere in this range
+  for (size_t length = 65490; length < 65540; length += 3) {
+    expectPatchedStream(std::string(300, 'x'), std::string(length, 'y'));
+    expectPatchedStream(std::string(length, 'y'), std::string(300, 'x'));
+  }
+  expectPatchedStream("a", std::string(70000, 'z'));
+}
+
+TEST_F(PdxInstanceImplTest, viewsKeepStreamTheyWereReadFrom) {
+  auto writer =
+      createInstance(std::make_shared<Item>(7, "abc", "tail", "note"))
+          ->createWriter();
+  auto text = writer->getStringView(writer->getFieldHandle("text"));
+  auto tail = writer->getStringView(writer->getFieldHandle("tail"));
+
+  writer->setField("text", std::string("xyz"));
+  serialize(writer);
+  EXPECT_EQ("abc", text.str());
+  EXPECT_EQ("xyz", writer->getStringField("text"));
+
+  writer->setField("text", std::string(300, 'x'));
+  serialize(writer);
+  EXPECT_EQ("tail", tail.str());
+  EXPECT_EQ("tail", writer->getStringField("tail"));
+}
+
+}  // namespace
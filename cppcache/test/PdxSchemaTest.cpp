@@ -0,0 +1,202 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheFactory.hpp>
+#include <geode/PdxReader.hpp>
+#include <geode/PdxSchema.hpp>
+#include <geode/PdxWriter.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheRegionHelper.hpp"
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+#include "PdxWriterWithTypeCollector.hpp"
+
+namespace {
+
+using apache::geode::client::Cache;
+using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheRegionHelper;
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::PdxReader;
+using apache::geode::client::PdxSchema;
+using apache::geode::client::PdxSchemaSerializable;
+using apache::geode::client::PdxSerializable;
+using apache::geode::client::PdxWriter;
+using apache::geode::client::PdxWriterWithTypeCollector;
+using apache::geode::client::Serializable;
+
+class Order : public PdxSchemaSerializable<Order> {
+ public:
+  Order() = default;
+
+  Order(int32_t id, std::string symbol, double price, std::string note,
+        bool open)
+      : m_id(id),
+        m_symbol(std::move(symbol)),
+        m_price(price),
+        m_note(std::move(note)),
+        m_open(open) {}
+
+  static const PdxSchema<Order>& getPdxSchema() {
+    static const PdxSchema<Order> schema("Order", {{"id", &Order::m_id},
+                                                   {"symbol", &Order::m_symbol},
+                                                   {"price", &Order::m_price},
+                                                   {"note", &Order::m_note},
+                                                   {"open", &Order::m_open}});
+    return schema;
+  }
+
+  static std::shared_ptr<PdxSerializable> createDeserializable() {
+    return std::make_shared<Order>();
+  }
+
+ private:
+  int32_t m_id = 0;
+  std::string m_symbol;
+  double m_price = 0;
+  std::string m_note;
+  bool m_open = false;
+};
+
+// The same class written field by field through a PdxWriter.
+class WrittenOrder : public PdxSerializable {
+ public:
+  WrittenOrder() = default;
+
+  WrittenOrder(int32_t id, std::string symbol, double price, std::string note,
+               bool open)
+      : m_id(id),
+        m_symbol(std::move(symbol)),
+        m_price(price),
+        m_note(std::move(note)),
+        m_open(open) {}
+
+  void toData(PdxWriter& writer) const override {
+    writer.writeInt("id", m_id);
+    writer.writeString("symbol", m_symbol);
+    writer.writeDouble("price", m_price);
+    writer.writeString("note", m_note);
+    writer.writeBoolean("open", m_open);
+  }
+
+  void fromData(PdxReader& reader) override {
+    m_id = reader.readInt("id");
+    m_symbol = reader.readString("symbol");
+    m_price = reader.readDouble("price");
+    m_note = reader.readString("note");
+    m_open = reader.readBoolean("open");
+  }
+
+  const std::string& getClassName() const override {
+    static const std::string className = "Order";
+    return className;
+  }
+
+ private:
+  int32_t m_id = 0;
+  std::string m_symbol;
+  double m_price = 0;
+  std::string m_note;
+  bool m_open = false;
+};
+
+class PdxSchemaTest : public ::testing::Test {
+ protected:
+  const int32_t typeId = 42;
+
+  PdxSchemaTest() : cache_(CacheFactory().set("log-level", "none").create()) {
+    // register the type as a server would assign it
+    WrittenOrder order;
+    auto registry =
+        CacheRegionHelper::getCacheImpl(&cache_)->getPdxTypeRegistry();
+    auto output = cache_.createDataOutput();
+    PdxWriterWithTypeCollector writer(output, order.getClassName(), registry);
+    order.toData(writer);
+    auto type = writer.getPdxLocalType();
+    type->InitializeType();
+    type->setTypeId(typeId);
+    registry->addLocalPdxType(order.getClassName(), type);
+    registry->addPdxType(typeId, type);
+  }
+
+  ~PdxSchemaTest() noexcept override { cache_.close(); }
+
+  std::vector<uint8_t> serialize(const std::shared_ptr<Serializable>& value) {
+    auto output = cache_.createDataOutput();
+    output.writeObject(value);
+    return std::vector<uint8_t>(output.getBuffer(),
+                                output.getBuffer() + output.getBufferLength());
+  }
+
+  // Expects Order to write the stream PdxHelper writes through a PdxWriter.
+  void expectSameStream(int32_t id, const std::string& symbol, double price,
+                        const std::string& note, bool open) {
+    auto expected = serialize(
+        std::make_shared<WrittenOrder>(id, symbol, price, note, open));
+    EXPECT_EQ(expected,
+              serialize(std::make_shared<Order>(id, symbol, price, note, open)))
+        << symbol.length() << " character symbol";
+
+    auto output = cache_.createDataOutput();
+    output.write(static_cast<int8_t>(93));
+    Order::getPdxSchema().writePdxStream(Order(id, symbol, price, note, open),
+                                         output, typeId);
+    EXPECT_EQ(expected,
+              std::vector<uint8_t>(
+                  output.getBuffer(),
+                  output.getBuffer() + output.getBufferLength()));
+  }
+
+  Cache cache_;
+};
+
+TEST_F(PdxSchemaTest, describesFieldsInOrder) {
+  auto& schema = Order::getPdxSchema();
+  EXPECT_EQ("Order", schema.getClassName());
+  EXPECT_EQ(2, schema.getNumberOfVarLenFields());
+  EXPECT_EQ("Order", Order().getClassName());
+}
+
+TEST_F(PdxSchemaTest, rejectsDuplicateFieldNames) {
+  struct Point : public PdxSchemaSerializable<Point> {
+    int32_t x;
+    int32_t y;
+  };
+  EXPECT_THROW(
+      PdxSchema<Point>("Point", {{"x", &Point::x}, {"x", &Point::y}}),
+      IllegalStateException);
+}
+
+TEST_F(PdxSchemaTest, writesSameStreamAsPdxWriter) {
+  expectSameStream(7, "GEODE", 12.5, "limit", true);
+  expectSameStream(0, "", 0, "", false);
+}
+
+TEST_F(PdxSchemaTest, widensOffsetsForLongStreams) {
+  // the streams exceed 0xff and 0xffff bytes
+  expectSameStream(7, std::string(300, 'x'), 12.5, "limit", false);
+  expectSameStream(7, std::string(70000, 'x'), 12.5, "limit", false);
+}
+
+}  // namespace
@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <PreparedFunction.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+using apache::geode::client::MessageException;
+using apache::geode::client::PreparedFunction;
+
+TEST(PreparedFunctionTest, functionPartIsEncodedStringPart) {
+  PreparedFunction function("fn");
+  std::vector<uint8_t> expected{0, 0, 0, 2, 0, 'f', 'n'};
+  EXPECT_EQ(expected, function.getFunctionPart());
+  EXPECT_EQ("fn", function.getName());
+  EXPECT_EQ(0, function.getFlags());
+}
+
+TEST(PreparedFunctionTest, toFlagsMapsServerAttributes) {
+  EXPECT_EQ(0, PreparedFunction::toFlags({0, 0, 0}));
+  EXPECT_EQ(PreparedFunction::HAS_RESULT, PreparedFunction::toFlags({1, 0, 0}));
+  EXPECT_EQ(PreparedFunction::IS_HA, PreparedFunction::toFlags({0, 1, 0}));
+  EXPECT_EQ(PreparedFunction::OPTIMIZE_FOR_WRITE,
+            PreparedFunction::toFlags({0, 0, 1}));
+  EXPECT_EQ(7, PreparedFunction::toFlags({1, 1, 1}));
+}
+
+TEST(PreparedFunctionTest, toFlagsThrowsOnMissingAttributes) {
+  EXPECT_THROW(PreparedFunction::toFlags({1, 1}), MessageException);
+}
+
+TEST(PreparedFunctionTest, attributeAccessorsReflectFlags) {
+  PreparedFunction function("fn", PreparedFunction::HAS_RESULT |
+                                      PreparedFunction::OPTIMIZE_FOR_WRITE);
+  EXPECT_TRUE(function.hasResult());
+  EXPECT_FALSE(function.isHA());
+  EXPECT_TRUE(function.isOptimizeForWrite());
+}
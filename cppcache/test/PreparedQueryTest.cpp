@@ -0,0 +1,59 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <PreparedQuery.hpp>
+
+#include <gtest/gtest.h>
+
+using apache::geode::client::PreparedQuery;
+
+TEST(PreparedQueryTest, countParametersWithoutParameters) {
+  EXPECT_EQ(0, PreparedQuery::countParameters("SELECT * FROM /region"));
+}
+
+TEST(PreparedQueryTest, countParametersReturnsHighestIndex) {
+  EXPECT_EQ(3, PreparedQuery::countParameters(
+                   "SELECT * FROM /region r WHERE r.id > $3 AND r.id < $1"));
+  EXPECT_EQ(12, PreparedQuery::countParameters(
+                    "SELECT * FROM /region r WHERE r.id = $12"));
+}
+
+TEST(PreparedQueryTest, countParametersIgnoresStringLiterals) {
+  EXPECT_EQ(1, PreparedQuery::countParameters(
+                   "SELECT * FROM /region r WHERE r.name = '$5' AND "
+                   "r.id = $1 AND r.text = 'it''s $7'"));
+}
+
+TEST(PreparedQueryTest, countParametersIgnoresComments) {
+  EXPECT_EQ(2, PreparedQuery::countParameters(
+                   "SELECT * FROM /region r -- WHERE r.id = $9\n"
+                   "WHERE r.id = $2 /* AND r.name = $4 */"));
+  EXPECT_EQ(1, PreparedQuery::countParameters(
+                   "SELECT * FROM /region r WHERE r.id = $1 /* $3"));
+}
+
+TEST(PreparedQueryTest, countParametersIgnoresQuotedIdentifiers) {
+  EXPECT_EQ(0, PreparedQuery::countParameters(
+                   "SELECT r.\"$1\" FROM /region r"));
+}
+
+TEST(PreparedQueryTest, queryPartIsEncodedStringPart) {
+  PreparedQuery query("abc");
+  std::vector<uint8_t> expected{0, 0, 0, 3, 0, 'a', 'b', 'c'};
+  EXPECT_EQ(expected, query.getQueryPart());
+  EXPECT_EQ("abc", query.getQueryString());
+}
@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <QueryScanner.hpp>
+
+#include <gtest/gtest.h>
+
+using apache::geode::client::QueryScanner;
+
+namespace {
+
+std::string join(const std::vector<QueryScanner::Token>& tokens) {
+  std::string text;
+  for (const auto& token : tokens) {
+    text += (token.type == QueryScanner::TokenType::PARAMETER ? "$" : "") +
+            token.text + " ";
+  }
+  return text;
+}
+
+}  // namespace
+
+TEST(QueryScannerTest, splitsWordsParametersAndSymbols) {
+  auto tokens = QueryScanner::scan("SELECT * FROM /r x WHERE x.id=$12");
+  EXPECT_EQ("SELECT * FROM / r x WHERE x . id = $12 ", join(tokens));
+  EXPECT_EQ(QueryScanner::TokenType::PARAMETER, tokens.back().type);
+  EXPECT_EQ("12", tokens.back().text);
+  EXPECT_EQ(14, tokens[3].position);
+}
+
+TEST(QueryScannerTest, skipsLiteralsAndComments) {
+  EXPECT_EQ("a = AND c = d ",
+            join(QueryScanner::scan("a = 'it''s $1' AND \"$2\" c /* $3 */"
+                                    "= d -- $4 ORDER BY")));
+  EXPECT_EQ("x $1 ", join(QueryScanner::scan("x -- $2\n$1 /* $3")));
+}
+
+TEST(QueryScannerTest, keywordsIgnoreCase) {
+  auto tokens = QueryScanner::scan("select From");
+  EXPECT_TRUE(QueryScanner::isKeyword(tokens[0], "SELECT"));
+  EXPECT_TRUE(QueryScanner::isKeyword(tokens[1], "FROM"));
+  EXPECT_FALSE(QueryScanner::isKeyword(tokens[1], "FRO"));
+  EXPECT_FALSE(QueryScanner::isSymbol(tokens[1], 'F'));
+}
@@ -0,0 +1,73 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <SerializedResultImpl.hpp>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "DataInputInternal.hpp"
+
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::OutOfRangeException;
+using apache::geode::client::SerializedResultImpl;
+
+namespace {
+
+size_t skip(const std::vector<uint8_t>& bytes) {
+  DataInputInternal input(bytes.data(), bytes.size());
+  if (!SerializedResultImpl::skipValue(input)) {
+    EXPECT_EQ(0, input.getBytesRead());
+    return 0;
+  }
+  return input.getBytesRead();
+}
+
+}  // namespace
+
+TEST(SerializedResultTest, skipFixedSizeValues) {
+  EXPECT_EQ(1, skip({41}));
+  EXPECT_EQ(2, skip({53, 1}));
+  EXPECT_EQ(5, skip({57, 0, 0, 0, 7, 99}));
+  EXPECT_EQ(9, skip({60, 0, 0, 0, 0, 0, 0, 0, 0, 99}));
+}
+
+TEST(SerializedResultTest, skipLengthPrefixedValues) {
+  EXPECT_EQ(5, skip({46, 3, 'a', 'b', 'c', 99}));
+  EXPECT_EQ(5, skip({87, 0, 2, 'a', 'b', 99}));
+  EXPECT_EQ(9, skip({89, 0, 0, 0, 2, 0, 'a', 0, 'b', 99}));
+  // PDX: length of the fields, type id, fields
+  EXPECT_EQ(11, skip({93, 0, 0, 0, 2, 0, 0, 0, 1, 'a', 'b', 99}));
+}
+
+TEST(SerializedResultTest, otherValuesAreNotSkipped) {
+  EXPECT_EQ(0, skip({45, 0, 0}));
+  EXPECT_EQ(0, skip({65, 0}));
+}
+
+TEST(SerializedResultTest, truncatedValueThrows) {
+  EXPECT_THROW(skip({46, 5, 'a'}), OutOfRangeException);
+}
+
+TEST(SerializedResultTest, bytesReferToBuffer) {
+  std::shared_ptr<const uint8_t> buffer(new uint8_t[4]{0, 55, 7, 0},
+                                        std::default_delete<uint8_t[]>());
+  SerializedResultImpl result(buffer, buffer.get() + 1, 2, nullptr, nullptr);
+  EXPECT_EQ(buffer.get() + 1, result.getBytes());
+  EXPECT_EQ(2, result.getLength());
+}
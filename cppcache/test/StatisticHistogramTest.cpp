@@ -0,0 +1,111 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "statistics/StatisticHistogram.hpp"
+
+namespace {
+
+using apache::geode::statistics::StatisticHistogram;
+
+TEST(StatisticHistogramTest, countsShortSamplesInFirstBucket) {
+  EXPECT_EQ(0, StatisticHistogram::getBucket(-1));
+  EXPECT_EQ(0, StatisticHistogram::getBucket(0));
+  EXPECT_EQ(0, StatisticHistogram::getBucket(2047));
+  EXPECT_EQ(1, StatisticHistogram::getBucket(2048));
+}
+
+TEST(StatisticHistogramTest, countsLongSamplesInLastBucket) {
+  const auto last = StatisticHistogram::BucketCount - 1;
+  EXPECT_EQ(last - 1, StatisticHistogram::getBucket((int64_t{1} << 38) - 1));
+  EXPECT_EQ(last, StatisticHistogram::getBucket(int64_t{1} << 38));
+  EXPECT_EQ(last, StatisticHistogram::getBucket(
+                      std::numeric_limits<int64_t>::max()));
+  EXPECT_EQ(std::numeric_limits<int64_t>::max(),
+            StatisticHistogram::getBucketUpperBound(last));
+}
+
+TEST(StatisticHistogramTest, splitsEachOctaveInFour) {
+  EXPECT_EQ(2560, StatisticHistogram::getBucketUpperBound(1));
+  EXPECT_EQ(3072, StatisticHistogram::getBucketUpperBound(2));
+  EXPECT_EQ(3584, StatisticHistogram::getBucketUpperBound(3));
+  EXPECT_EQ(4096, StatisticHistogram::getBucketUpperBound(4));
+  EXPECT_EQ(1, StatisticHistogram::getBucket(2559));
+  EXPECT_EQ(2, StatisticHistogram::getBucket(2560));
+  EXPECT_EQ(4, StatisticHistogram::getBucket(4095));
+  EXPECT_EQ(5, StatisticHistogram::getBucket(4096));
+  EXPECT_EQ(6, StatisticHistogram::getBucket(5120));
+}
+
+TEST(StatisticHistogramTest, splitsLongerOctavesInFewerBuckets) {
+  const auto quarters = StatisticHistogram::getBucket(int64_t{1} << 23);
+  EXPECT_EQ(int64_t{5} << 21,
+            StatisticHistogram::getBucketUpperBound(quarters));
+  EXPECT_EQ(int64_t{1} << 24,
+            StatisticHistogram::getBucketUpperBound(quarters + 3));
+
+  const auto halves = quarters + 4;
+  EXPECT_EQ(halves, StatisticHistogram::getBucket(int64_t{1} << 24));
+  EXPECT_EQ(int64_t{3} << 23, StatisticHistogram::getBucketUpperBound(halves));
+  EXPECT_EQ(halves + 1, StatisticHistogram::getBucket(int64_t{3} << 23));
+  EXPECT_EQ(halves + 2, StatisticHistogram::getBucket(int64_t{1} << 25));
+
+  const auto wholes = StatisticHistogram::getBucket(int64_t{1} << 30);
+  EXPECT_EQ(halves + 12, wholes);
+  EXPECT_EQ(int64_t{1} << 31, StatisticHistogram::getBucketUpperBound(wholes));
+  EXPECT_EQ(wholes, StatisticHistogram::getBucket((int64_t{1} << 31) - 1));
+  EXPECT_EQ(wholes + 1, StatisticHistogram::getBucket(int64_t{1} << 31));
+}
+
+TEST(StatisticHistogramTest, coversMinutes) {
+  // function executions and connection waits of a minute
+  const auto minute = int64_t{60} * 1000 * 1000 * 1000;
+  const auto bucket = StatisticHistogram::getBucket(minute);
+  EXPECT_LT(bucket, StatisticHistogram::BucketCount - 1);
+  EXPECT_EQ(int64_t{1} << 36, StatisticHistogram::getBucketUpperBound(bucket));
+}
+
+TEST(StatisticHistogramTest, boundsBucketWidthByRange) {
+  for (int32_t bucket = 1; bucket < StatisticHistogram::BucketCount - 1;
+       bucket++) {
+    auto lower = StatisticHistogram::getBucketUpperBound(bucket - 1);
+    auto upper = StatisticHistogram::getBucketUpperBound(bucket);
+    if (upper <= int64_t{1} << 24) {
+      EXPECT_LE((upper - lower) * 4, lower);
+    } else if (upper <= int64_t{1} << 30) {
+      EXPECT_LE((upper - lower) * 2, lower);
+    } else {
+      EXPECT_LE(upper - lower, lower);
+    }
+  }
+}
+
+TEST(StatisticHistogramTest, bucketsMatchTheirBounds) {
+  for (int32_t bucket = 0; bucket < StatisticHistogram::BucketCount - 1;
+       bucket++) {
+    auto bound = StatisticHistogram::getBucketUpperBound(bucket);
+    EXPECT_EQ(bucket, StatisticHistogram::getBucket(bound - 1));
+    EXPECT_EQ(bucket + 1, StatisticHistogram::getBucket(bound));
+    EXPECT_LT(bound, StatisticHistogram::getBucketUpperBound(bucket + 1));
+  }
+}
+
+}  // namespace
@@ -0,0 +1,109 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <StreamingResultCollectorImpl.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::FunctionExecutionException;
+using apache::geode::client::IllegalStateException;
+using apache::geode::client::StreamingResultCollectorImpl;
+
+TEST(StreamingResultCollectorTest, resultsAreConsumedInOrder) {
+  StreamingResultCollectorImpl collector(10, true);
+  collector.addResult(CacheableInt32::create(1));
+  collector.addResult(CacheableInt32::create(2));
+  collector.endResults();
+
+  ASSERT_TRUE(collector.hasNext());
+  EXPECT_EQ(1, std::dynamic_pointer_cast<CacheableInt32>(collector.next())
+                   ->value());
+  ASSERT_TRUE(collector.hasNext());
+  EXPECT_EQ(2, std::dynamic_pointer_cast<CacheableInt32>(collector.next())
+                   ->value());
+  EXPECT_FALSE(collector.hasNext());
+  EXPECT_THROW(collector.next(), IllegalStateException);
+}
+
+TEST(StreamingResultCollectorTest, addResultBlocksWhenFull) {
+  StreamingResultCollectorImpl collector(2, true);
+  std::atomic<int> added(0);
+  std::thread producer([&] {
+    for (int i = 0; i < 5; i++) {
+      collector.addResult(CacheableInt32::create(i));
+      ++added;
+    }
+    collector.endResults();
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(2, added);
+
+  int consumed = 0;
+  while (collector.hasNext()) {
+    EXPECT_EQ(consumed, std::dynamic_pointer_cast<CacheableInt32>(
+                            collector.next())
+                            ->value());
+    ++consumed;
+  }
+  producer.join();
+  EXPECT_EQ(5, consumed);
+}
+
+TEST(StreamingResultCollectorTest, closeUnblocksProducer) {
+  StreamingResultCollectorImpl collector(1, true);
+  std::thread producer([&] {
+    for (int i = 0; i < 3; i++) {
+      collector.addResult(CacheableInt32::create(i));
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  collector.close();
+  producer.join();
+  EXPECT_THROW(collector.hasNext(), IllegalStateException);
+}
+
+TEST(StreamingResultCollectorTest, clearResultsAfterConsumingThrows) {
+  StreamingResultCollectorImpl collector(10, true);
+  collector.addResult(CacheableInt32::create(1));
+  collector.addResult(CacheableInt32::create(2));
+  collector.clearResults();
+  collector.addResult(CacheableInt32::create(3));
+  ASSERT_TRUE(collector.hasNext());
+  EXPECT_EQ(3, std::dynamic_pointer_cast<CacheableInt32>(collector.next())
+                   ->value());
+  EXPECT_THROW(collector.clearResults(), FunctionExecutionException);
+}
+
+TEST(StreamingResultCollectorTest, getResultReturnsRemainingResults) {
+  StreamingResultCollectorImpl collector(10, true);
+  collector.addResult(CacheableInt32::create(1));
+  collector.addResult(CacheableInt32::create(2));
+  collector.next();
+  collector.endResults();
+
+  auto results = collector.getResult(std::chrono::milliseconds(0));
+  ASSERT_EQ(1, results->size());
+  EXPECT_EQ(2,
+            std::dynamic_pointer_cast<CacheableInt32>((*results)[0])->value());
+}
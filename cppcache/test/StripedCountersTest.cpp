@@ -0,0 +1,78 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "statistics/StripedCounters.hpp"
+
+namespace {
+
+using apache::geode::statistics::StripedCounters;
+
+TEST(StripedCountersTest, sumsIncrementsOfAllThreads) {
+  StripedCounters<int64_t> counters(3);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&counters]() {
+      for (int i = 0; i < 10000; i++) {
+        counters.add(0, 1);
+        counters.add(2, 2);
+      }
+    });
+  }
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(80000, counters.get(0));
+  EXPECT_EQ(0, counters.get(1));
+  EXPECT_EQ(160000, counters.get(2));
+}
+
+TEST(StripedCountersTest, setReplacesTheSumOfAllStripes) {
+  StripedCounters<int32_t> counters(2);
+  counters.add(1, 5);
+  std::thread([&counters]() { counters.add(1, 7); }).join();
+  EXPECT_EQ(12, counters.get(1));
+
+  counters.set(1, 3);
+  EXPECT_EQ(3, counters.get(1));
+  counters.add(1, -4);
+  EXPECT_EQ(-1, counters.get(1));
+  EXPECT_EQ(0, counters.get(0));
+}
+
+TEST(StripedCountersTest, wrapsAroundLikeAnAtomicCounter) {
+  StripedCounters<int32_t> counters(1);
+  counters.set(0, std::numeric_limits<int32_t>::max());
+  std::thread([&counters]() { counters.add(0, 1); }).join();
+  EXPECT_EQ(std::numeric_limits<int32_t>::min(), counters.get(0));
+}
+
+TEST(StripedCountersTest, stripeCountIsAPowerOfTwo) {
+  auto stripes = StripedCounters<int32_t>::getStripeCount();
+  EXPECT_LE(1u, stripes);
+  EXPECT_EQ(0u, stripes & (stripes - 1));
+}
+
+}  // namespace
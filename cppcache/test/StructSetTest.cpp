@@ -22,6 +22,7 @@
 
 using apache::geode::client::CacheableString;
 using apache::geode::client::CacheableVector;
+using apache::geode::client::Serializable;
 using apache::geode::client::Struct;
 using apache::geode::client::StructSetImpl;
 
@@ -112,3 +113,18 @@ TEST(StructSetTest, ForRange) {
     }
   }
 }
+
+TEST(StructSetTest, StructKeepsSharedParentAlive) {
+  std::vector<std::shared_ptr<Serializable>> values{
+      CacheableString::create("value0")};
+  std::shared_ptr<Struct> row;
+  {
+    auto ss = std::make_shared<StructSetImpl>(
+        CacheableVector::create(), std::vector<std::string>{"field0"});
+    row = std::make_shared<Struct>(ss, values);
+  }
+
+  EXPECT_EQ("field0", row->getFieldName(0));
+  EXPECT_EQ("value0", (*row)["field0"]->toString());
+  EXPECT_EQ(row->getStructSet(), row->getStructSet());
+}
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <PreparedFunction.hpp>
+#include <PreparedQuery.hpp>
 #include <TcrMessage.hpp>
 #include <iostream>
 
@@ -207,6 +209,47 @@ TEST_F(TcrMessageTest,
       message);
 }
 
+TEST_F(TcrMessageTest, testPreparedQueryConstructorWithQUERY) {
+  using apache::geode::client::PreparedQuery;
+  using apache::geode::client::TcrMessageQuery;
+
+  std::chrono::milliseconds messageResponseTimeout{1000};
+  ThinClientBaseDM *connectionDM = nullptr;
+  PreparedQuery query("aRegionName", nullptr);
+
+  TcrMessageQuery message(new DataOutputUnderTest(), query,
+                          messageResponseTimeout, connectionDM);
+
+  EXPECT_EQ(TcrMessage::QUERY, message.getMessageType());
+
+  EXPECT_MESSAGE_EQ(
+      "000000220000003000000003FFFFFFFF000000000B0061526567696F6E4E616D65000000"
+      "12000300000000000000010300000000000000\\h{2}0000000400000003E8",
+      message);
+}
+
+TEST_F(TcrMessageTest,
+       testPreparedQueryConstructorWithQUERY_WITH_PARAMETERS) {
+  using apache::geode::client::PreparedQuery;
+  using apache::geode::client::TcrMessageQueryWithParameters;
+
+  std::chrono::milliseconds messageResponseTimeout{1000};
+  ThinClientBaseDM *connectionDM = nullptr;
+  auto paramList = CacheableVector::create();
+  PreparedQuery query("aRegionName", nullptr);
+
+  TcrMessageQueryWithParameters message(new DataOutputUnderTest(), query,
+                                        paramList, messageResponseTimeout,
+                                        connectionDM);
+
+  EXPECT_EQ(TcrMessage::QUERY_WITH_PARAMETERS, message.getMessageType());
+
+  EXPECT_MESSAGE_EQ(
+      "000000500000002B00000004FFFFFFFF000000000B0061526567696F6E4E616D65000000"
+      "04000000000000000004000000000F0000000400000003E8",
+      message);
+}
+
 TEST_F(TcrMessageTest, testConstructorWithCONTAINS_KEY) {
   using apache::geode::client::TcrMessageContainsKey;
 
@@ -676,6 +719,38 @@ TEST_F(TcrMessageTest, testConstructorEXECUTE_REGION_FUNCTION_SINGLE_HOP) {
   EXPECT_TRUE(message.hasResult());
 }
 
+TEST_F(TcrMessageTest,
+       testPreparedFunctionConstructorEXECUTE_REGION_FUNCTION_SINGLE_HOP) {
+  using apache::geode::client::PreparedFunction;
+  using apache::geode::client::TcrMessageExecuteRegionFunctionSingleHop;
+
+  const Region *region = nullptr;
+
+  auto myHashCachePtr = CacheableHashSet::create();
+
+  std::shared_ptr<Cacheable> myPtr(CacheableString::createDeserializable());
+
+  PreparedFunction function("myFuncName", PreparedFunction::HAS_RESULT);
+
+  TcrMessageExecuteRegionFunctionSingleHop message(
+      new DataOutputUnderTest(), function, region, myPtr, myHashCachePtr,
+      function.getFlags(), myHashCachePtr,
+      false,  // allBuckets
+      std::chrono::milliseconds{1}, static_cast<ThinClientBaseDM *>(nullptr));
+
+  EXPECT_EQ(TcrMessage::EXECUTE_REGION_FUNCTION_SINGLE_HOP,
+            message.getMessageType());
+
+  EXPECT_MESSAGE_EQ(
+      "0000004F0000005E00000009FFFFFFFF00000000050002000000010000001300494E5641"
+      "4C49445F524547494F4E5F4E414D450000000A006D7946756E634E616D65000000030157"
+      "000000000001012900000001000000000004000000000000000004000000000000000002"
+      "014200",
+      message);
+
+  EXPECT_TRUE(message.hasResult());
+}
+
 TEST_F(TcrMessageTest, testConstructorEXECUTE_REGION_FUNCTION) {
   using apache::geode::client::TcrMessageExecuteRegionFunction;
 
@@ -705,6 +780,36 @@ TEST_F(TcrMessageTest, testConstructorEXECUTE_REGION_FUNCTION) {
   EXPECT_TRUE(testMessage.hasResult());
 }
 
+TEST_F(TcrMessageTest, testPreparedFunctionConstructorEXECUTE_REGION_FUNCTION) {
+  using apache::geode::client::PreparedFunction;
+  using apache::geode::client::TcrMessageExecuteRegionFunction;
+
+  const Region *region = nullptr;
+
+  auto myHashCachePtr = CacheableHashSet::create();
+  std::shared_ptr<Cacheable> myCacheablePtr(
+      CacheableString::createDeserializable());
+  auto myVectPtr = CacheableVector::create();
+
+  PreparedFunction function("ExecuteRegion", PreparedFunction::HAS_RESULT);
+
+  TcrMessageExecuteRegionFunction testMessage(
+      new DataOutputUnderTest(), function, region, myCacheablePtr, myVectPtr,
+      function.getFlags(), myHashCachePtr, std::chrono::milliseconds{10},
+      static_cast<ThinClientBaseDM *>(nullptr), 10);
+
+  EXPECT_EQ(TcrMessage::EXECUTE_REGION_FUNCTION, testMessage.getMessageType());
+
+  EXPECT_MESSAGE_EQ(
+      "0000003B0000006100000009FFFFFFFF000000000500020000000A0000001300494E5641"
+      "4C49445F524547494F4E5F4E414D450000000D0045786563757465526567696F6E000000"
+      "030157000000000001012900000001000A00000004000000000000000004000000000000"
+      "000002014200",
+      testMessage);
+
+  EXPECT_TRUE(testMessage.hasResult());
+}
+
 TEST_F(TcrMessageTest, DISABLED_testConstructorEXECUTE_FUNCTION) {
   using apache::geode::client::TcrMessageExecuteFunction;
 